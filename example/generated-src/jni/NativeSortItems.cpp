@@ -18,7 +18,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_textsort_SortItems_00024CppProxy_native
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         delete reinterpret_cast<djinni::CppProxyHandle<::textsort::SortItems>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -27,8 +29,11 @@ CJNIEXPORT void JNICALL Java_com_dropbox_textsort_SortItems_00024CppProxy_native
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
         const auto& ref = ::djinni::objectFromHandleAddress<::textsort::SortItems>(nativeRef);
-        ref->sort(::djinni_generated::NativeSortOrder::toCpp(jniEnv, j_order),
-                  ::djinni_generated::NativeItemList::toCpp(jniEnv, j_items));
+        auto c_order = ::djinni_generated::NativeSortOrder::toCpp(jniEnv, j_order);
+        auto c_items = ::djinni_generated::NativeItemList::toCpp(jniEnv, j_items);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ref->sort(c_order, c_items);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -36,7 +41,10 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_textsort_SortItems_createWithListene
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::textsort::SortItems::create_with_listener(::djinni_generated::NativeTextboxListener::toCpp(jniEnv, j_listener));
+        auto c_listener = ::djinni_generated::NativeTextboxListener::toCpp(jniEnv, j_listener);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::textsort::SortItems::create_with_listener(c_listener);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeSortItems::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -45,7 +53,10 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_textsort_SortItems_runSort(JNIEnv* j
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::textsort::SortItems::run_sort(::djinni_generated::NativeItemList::toCpp(jniEnv, j_items));
+        auto c_items = ::djinni_generated::NativeItemList::toCpp(jniEnv, j_items);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::textsort::SortItems::run_sort(c_items);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeItemList::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
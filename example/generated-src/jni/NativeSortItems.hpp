@@ -19,6 +19,8 @@ public:
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeSortItems>::get()._fromJava(jniEnv, j); }
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeSortItems>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeSortItems>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeSortItems>::get()._toJavaBatch(jniEnv, c, count, j); }
 
 private:
     NativeSortItems();
@@ -15,12 +15,16 @@ NativeTextboxListener::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGet
 NativeTextboxListener::JavaProxy::~JavaProxy() = default;
 
 void NativeTextboxListener::JavaProxy::update(const ::textsort::ItemList & c_items) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.textsort.TextboxListener.update");
     auto jniEnv = ::djinni::jniGetThreadEnv();
     ::djinni::JniLocalScope jscope(jniEnv, 10);
     const auto& data = ::djinni::JniClass<::djinni_generated::NativeTextboxListener>::get();
+    auto j_items = ::djinni_generated::NativeItemList::fromCpp(jniEnv, c_items);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
     jniEnv->CallVoidMethod(Handle::get().get(), data.method_update,
-                           ::djinni::get(::djinni_generated::NativeItemList::fromCpp(jniEnv, c_items)));
+                           ::djinni::get(j_items));
     ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
 }
 
 }  // namespace djinni_generated
@@ -278,7 +278,7 @@ class CppGenerator(spec: Spec) extends Generator(spec) {
           w.wl
           writeDoc(w, m.doc)
           val ret = marshal.returnType(m.ret)
-          val params = m.params.map(p => marshal.paramType(p.ty) + " " + idCpp.local(p.ident))
+          val params = m.params.map(p => marshal.paramType(p) + " " + idCpp.local(p.ident))
           if (m.static) {
             w.wl(s"static $ret ${idCpp.method(m.ident)}${params.mkString("(", ", ", ")")};")
           } else {
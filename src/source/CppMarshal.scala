@@ -22,6 +22,9 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
 
   override def paramType(tm: MExpr): String = toCppParamType(tm)
   override def fqParamType(tm: MExpr): String = toCppParamType(tm, Some(spec.cppNamespace))
+  // Parameters marked "move" are taken by value.
+  def paramType(p: Field): String = if (p.move) typename(p.ty) else paramType(p.ty)
+  def fqParamType(p: Field): String = if (p.move) fqTypename(p.ty) else fqParamType(p.ty)
 
   override def returnType(ret: Option[TypeRef]): String = ret.fold("void")(toCppType(_, None))
   override def fqReturnType(ret: Option[TypeRef]): String = ret.fold("void")(toCppType(_, Some(spec.cppNamespace)))
@@ -38,12 +41,20 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
       case _ => List()
     }
     case MString => List(ImportRef("<string>"))
+    case MStringView => List(ImportRef(spec.cppStringViewHeader))
     case MDate => List(ImportRef("<chrono>"))
     case MBinary => List(ImportRef("<vector>"), ImportRef("<cstdint>"))
+    case MSharedBinary => List(ImportRef("<memory>"), ImportRef("<vector>"), ImportRef("<cstdint>"))
+    case MMappedRegion => List(ImportRef("\"djinni_mapped_region.hpp\""))
+    case MOutBuffer => List(ImportRef("\"djinni_out_buffer.hpp\""))
     case MOptional => List(ImportRef(spec.cppOptionalHeader))
     case MList => List(ImportRef("<vector>"))
+    case MSpan => List(ImportRef("\"djinni_span.hpp\""))
     case MSet => List(ImportRef("<unordered_set>"))
     case MMap => List(ImportRef("<unordered_map>"))
+    case MResult => List(ImportRef(spec.cppExpectedHeader))
+    case MHandle => List(ImportRef("<memory>"))
+    case MListDelta => List(ImportRef("\"djinni_list_delta.hpp\""))
     case d: MDef => d.defType match {
       case DEnum | DRecord =>
         if (d.name != exclude) {
@@ -78,25 +89,37 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
     def base(m: Meta): String = m match {
       case p: MPrimitive => p.cName
       case MString => "std::string"
+      case MStringView => spec.cppStringViewType
       case MDate => "std::chrono::system_clock::time_point"
       case MBinary => "std::vector<uint8_t>"
+      case MSharedBinary => "std::shared_ptr<const std::vector<uint8_t>>"
+      case MMappedRegion => "::djinni::mapped_region"
+      case MOutBuffer => "::djinni::out_buffer"
       case MOptional => spec.cppOptionalTemplate
       case MList => "std::vector"
+      case MSpan => "::djinni::span"
       case MSet => "std::unordered_set"
       case MMap => "std::unordered_map"
+      case MResult => "::djinni::expected"
+      case MHandle => throw new AssertionError("handle should have been special cased")
+      case MListDelta => "::djinni::list_delta"
       case d: MDef =>
         d.defType match {
           case DEnum => withNs(namespace, idCpp.enumType(d.name))
           case DRecord => withNs(namespace, idCpp.ty(d.name))
-          case DInterface => s"std::shared_ptr<${withNs(namespace, idCpp.ty(d.name))}>"
+          case DInterface => s"${interfacePointer(d)}<${withNs(namespace, idCpp.ty(d.name))}>"
         }
       case e: MExtern => e.defType match {
-        case DInterface => s"std::shared_ptr<${e.cpp.typename}>"
+        case DInterface => s"${interfacePointer(e)}<${e.cpp.typename}>"
         case _ => e.cpp.typename
       }
       case p: MParam => idCpp.typeParam(p.name)
     }
     def expr(tm: MExpr): String = {
+      // Spans are read-only views of their elements.
+      if (tm.base == MSpan) return s"${base(tm.base)}<const ${expr(tm.args.head)}>"
+      // A handle is a plain shared_ptr to the interface, even with --cpp-nn-type.
+      if (tm.base == MHandle) return base(tm.args.head.base)
       spec.cppNnType match {
         case Some(nnType) => {
           // if we're using non-nullable pointers for interfaces, then special-case
@@ -105,7 +128,7 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
           tm.base match {
             case d: MDef =>
               d.defType match {
-                case DInterface => s"${nnType}<${withNs(namespace, idCpp.ty(d.name))}>"
+                case DInterface if !isUniqueInterface(tm) => s"${nnType}<${withNs(namespace, idCpp.ty(d.name))}>"
                 case _ => base(tm.base) + args
               }
             case MOptional =>
@@ -133,6 +156,9 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
     expr(tm)
   }
 
+  private def interfacePointer(m: Meta): String =
+    if (isUniqueInterface(MExpr(m, Seq.empty))) "std::unique_ptr" else "std::shared_ptr"
+
   def byValue(tm: MExpr): Boolean = tm.base match {
     case p: MPrimitive => true
     case d: MDef => d.defType match {
@@ -145,6 +171,7 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
       case DRecord => e.cpp.byValue
     }
     case MOptional => byValue(tm.args.head)
+    case MOutBuffer | MSpan | MStringView => true
     case _ => false
   }
 
@@ -104,9 +104,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl
         val classLookup = q(jniMarshal.undecoratedTypename(ident, r))
         w.wl(s"const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass($classLookup) };")
-        val constructorSig = q(jniMarshal.javaMethodSignature(r.fields, None))
+        val constructorSig = q(jniMarshal.javaMethodSignature(r.fields.flatMap(jniUnboxedFields), None))
         w.wl(s"const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), ${q("<init>")}, $constructorSig) };")
-        for (f <- r.fields) {
+        for (f <- r.fields.flatMap(jniUnboxedFields)) {
           val javaFieldName = idJava.field(f.ident)
           val javaSig = q(jniMarshal.fqTypename(f.ty))
           w.wl(s"const jfieldID field_$javaFieldName { ::djinni::jniGetFieldID(clazz.get(), ${q(javaFieldName)}, $javaSig) };")
@@ -133,11 +133,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.w(call + "data.clazz.get(), data.jconstructor")
         if(r.fields.nonEmpty) {
           w.wl(",")
-          writeAlignedCall(w, " " * call.length(), r.fields, ")}", f => {
-            val name = idCpp.field(f.ident)
-            val param = jniMarshal.fromCpp(f.ty, s"c.$name")
-            s"::djinni::get($param)"
-          })
+          val params = r.fields.flatMap(f => jniUnboxedFromCpp(f, s"c.${idCpp.field(f.ident)}"))
+          val args = params.map { case (f, param) => f.ident.name -> s"::djinni::get($param)" }.toMap
+          writeAlignedCall(w, " " * call.length(), params.map(_._1), ")}", f => args(f.ident.name))
         }
         else
           w.w(")}")
@@ -154,10 +152,13 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
           w.wl("(void)j; // Suppress warnings in release builds for empty records")
         else
           w.wl(s"const auto& data = ::djinni::JniClass<$jniHelper>::get();")
-        writeAlignedCall(w, "return {", r.fields, "}", f => {
+        def jniFieldAccess(f: Field) = {
           val fieldId = "data.field_" + idJava.field(f.ident)
-          val jniFieldAccess = toJniCall(f.ty, (jt: String) => s"jniEnv->Get${jt}Field(j, $fieldId)")
-          jniMarshal.toCpp(f.ty, jniFieldAccess)
+          toJniCall(f.ty, (jt: String) => s"jniEnv->Get${jt}Field(j, $fieldId)")
+        }
+        writeAlignedCall(w, "return {", r.fields, "}", f => jniUnboxedFields(f) match {
+          case Seq(has, value) => jniMarshal.unboxedOptionalHelper(f.ty.resolved) + s"::toCpp(jniEnv, ${jniFieldAccess(has)}, ${jniFieldAccess(value)})"
+          case _ => jniMarshal.toCpp(f.ty, jniFieldAccess(f))
         })
         w.wl(";")
       }
@@ -179,21 +180,35 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
     val cppSelf = cppMarshal.fqTypename(ident, i) + cppTypeArgs(typeParams)
 
     val classLookup = jniMarshal.undecoratedTypename(ident, i)
-    val baseType = s"::djinni::JniInterface<$cppSelf, $jniSelf>"
+    val baseType =
+      if (i.ext.cppUnique) s"::djinni::JniUniqueInterface<$cppSelf, $jniSelf>"
+      else s"::djinni::JniInterface<$cppSelf, $jniSelf>"
+    // The JavaProxy's base, which holds the Java object; also the name it's accessed through.
+    val (javaProxyBase, javaProxyHandle) =
+      if (i.ext.javaNoCache) ("::djinni::JavaProxyUncachedEntry", "JavaProxyUncachedEntry")
+      else ("::djinni::JavaProxyCacheEntry", "Handle")
 
     def writeJniPrototype(w: IndentWriter) {
       writeJniTypeParams(w, typeParams)
       w.w(s"class $jniSelf final : $baseType").bracedSemi {
         w.wlOutdent(s"public:")
-        w.wl(s"using CppType = std::shared_ptr<$cppSelf>;")
+        val cppPointer = if (i.ext.cppUnique) "std::unique_ptr" else "std::shared_ptr"
+        w.wl(s"using CppType = $cppPointer<$cppSelf>;")
         w.wl(s"using JniType = jobject;")
         w.wl
         w.wl(s"using Boxed = $jniSelf;")
         w.wl
         w.wl(s"~$jniSelf();")
         w.wl
-        w.wl(s"static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<$jniSelf>::get()._fromJava(jniEnv, j); }")
-        w.wl(s"static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<$jniSelf>::get()._toJava(jniEnv, c)}; }")
+        if (i.ext.cppUnique) {
+          // Unique objects are only ever returned from C++, and are moved into their CppProxy.
+          w.wl(s"static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, CppType c) { return {jniEnv, ::djinni::JniClass<$jniSelf>::get()._toJava(jniEnv, std::move(c))}; }")
+        } else {
+          w.wl(s"static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<$jniSelf>::get()._fromJava(jniEnv, j); }")
+          w.wl(s"static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<$jniSelf>::get()._toJava(jniEnv, c)}; }")
+          w.wl(s"static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<$jniSelf>::get()._fromJavaBatch(jniEnv, j, count, c); }")
+          w.wl(s"static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<$jniSelf>::get()._toJavaBatch(jniEnv, c, count, j); }")
+        }
         w.wl
         w.wlOutdent("private:")
         w.wl(s"$jniSelf();")
@@ -201,7 +216,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl(s"friend $baseType;")
         w.wl
         if (i.ext.java) {
-          w.wl(s"class JavaProxy final : ::djinni::JavaProxyCacheEntry, public $cppSelf").bracedSemi {
+          // Queued oneway calls keep their proxy alive until they've been delivered.
+          val sharedFromThis = if (i.methods.exists(_.oneway)) ", public std::enable_shared_from_this<JavaProxy>" else ""
+          w.wl(s"class JavaProxy final : $javaProxyBase, public $cppSelf$sharedFromThis").bracedSemi {
             w.wlOutdent(s"public:")
             // w.wl(s"using JavaProxyCacheEntry::JavaProxyCacheEntry;")
             w.wl(s"JavaProxy(JniType j);")
@@ -209,7 +226,7 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             w.wl
             for (m <- i.methods) {
               val ret = cppMarshal.fqReturnType(m.ret)
-              val params = m.params.map(p => cppMarshal.fqParamType(p.ty) + " " + idCpp.local(p.ident))
+              val params = m.params.map(p => cppMarshal.fqParamType(p) + " " + idCpp.local(p.ident))
               w.wl(s"$ret ${idCpp.method(m.ident)}${params.mkString("(", ", ", ")")} override;")
             }
             w.wl
@@ -220,8 +237,10 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
           w.wl(s"const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass(${q(classLookup)}) };")
           for (m <- i.methods) {
             val javaMethodName = idJava.method(m.ident)
-            val javaMethodSig = q(jniMarshal.javaMethodSignature(m.params, m.ret))
-            w.wl(s"const jmethodID method_$javaMethodName { ::djinni::jniGetMethodID(clazz.get(), ${q(javaMethodName)}, $javaMethodSig) };")
+            // With flattened arguments, the Java method to call is the one that rebuilds them.
+            val calledName = if (m.params.exists(isJniFlat)) idJava.method(m.ident.name + "_flat") else javaMethodName
+            val javaMethodSig = q(jniMarshal.javaMethodSignature(m.params.flatMap(jniFlatParams), m.ret))
+            w.wl(s"const jmethodID method_$javaMethodName { ::djinni::jniGetMethodID(clazz.get(), ${q(calledName)}, $javaMethodSig) };")
           }
         }
       }
@@ -239,35 +258,53 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
       w.wl
       if (i.ext.java) {
         writeJniTypeParams(w, typeParams)
-        w.wl(s"$jniSelfWithParams::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }")
+        w.wl(s"$jniSelfWithParams::JavaProxy::JavaProxy(JniType j) : $javaProxyHandle(::djinni::jniGetThreadEnv(), j) { }")
         w.wl
         writeJniTypeParams(w, typeParams)
         w.wl(s"$jniSelfWithParams::JavaProxy::~JavaProxy() = default;")
         w.wl
         for (m <- i.methods) {
           val ret = cppMarshal.fqReturnType(m.ret)
-          val params = m.params.map(p => cppMarshal.fqParamType(p.ty) + " c_" + idCpp.local(p.ident))
+          val params = m.params.map(p => cppMarshal.fqParamType(p) + " c_" + idCpp.local(p.ident))
           writeJniTypeParams(w, typeParams)
           val methodNameAndSignature: String = s"${idCpp.method(m.ident)}${params.mkString("(", ", ", ")")}"
           w.w(s"$ret $jniSelfWithParams::JavaProxy::$methodNameAndSignature").braced {
-            w.wl(s"auto jniEnv = ::djinni::jniGetThreadEnv();")
-            w.wl(s"::djinni::JniLocalScope jscope(jniEnv, 10);")
-            w.wl(s"const auto& data = ::djinni::JniClass<${withNs(Some(spec.jniNamespace), jniSelf)}>::get();")
-            val call = m.ret.fold("jniEnv->CallVoidMethod(")(r => "auto jret = " + toJniCall(r, (jt: String) => s"jniEnv->Call${jt}Method("))
-            w.w(call)
             val javaMethodName = idJava.method(m.ident)
-            w.w(s"Handle::get().get(), data.method_$javaMethodName")
-            if(m.params.nonEmpty){
-              w.wl(",")
-              writeAlignedCall(w, " " * call.length(), m.params, ")", p => {
-                val param = jniMarshal.fromCpp(p.ty, "c_" + idCpp.local(p.ident))
-                s"::djinni::get($param)"
-              })
+            def writeJavaCall(w: IndentWriter, self: String) {
+              w.wl(s"""DJINNI_JAVA_PROXY_PROLOGUE("${javaMarshal.fqTypename(ident, i)}.$javaMethodName");""")
+              if (!m.oneway) w.wl(s"auto jniEnv = ::djinni::jniGetThreadEnv();")
+              w.wl(s"::djinni::JniLocalScope jscope(jniEnv, 10);")
+              w.wl(s"const auto& data = ::djinni::JniClass<${withNs(Some(spec.jniNamespace), jniSelf)}>::get();")
+              // Convert all arguments up front so the hooks below bracket only the Java call.
+              val args = m.params.flatMap(p => jniFlatFromCpp(p, "c_" + idCpp.local(p.ident)))
+              args.foreach { case (arg, v) => w.wl(s"auto j_${idJava.local(arg.ident)} = $v;") }
+              w.wl("DJINNI_FUNCTION_BODY_BEGIN(jniEnv);")
+              val call = m.ret.fold("jniEnv->CallVoidMethod(")(r => "auto jret = " + toJniCall(r, (jt: String) => s"jniEnv->Call${jt}Method("))
+              w.w(call)
+              w.w(s"$self$javaProxyHandle::get().get(), data.method_$javaMethodName")
+              if(m.params.nonEmpty){
+                w.wl(",")
+                writeAlignedCall(w, " " * call.length(), args.map(_._1), ")", p => s"::djinni::get(j_${idJava.local(p.ident)})")
+              }
+              else
+                w.w(")")
+              w.wl(";")
+              w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
+              w.wl("DJINNI_FUNCTION_BODY_END(jniEnv);")
+            }
+            if (m.oneway) {
+              // The arguments are copied into the queued call and converted on the dispatcher thread.
+              val captures = ("self" +: m.params.map(p => "c_" + idCpp.local(p.ident))).mkString(", ")
+              val post =
+                if (m.coalesce) s"postCoalesced(this, ${i.methods.indexOf(m)}, "
+                else "post("
+              w.wl(s"auto self = shared_from_this();")
+              w.w(s"::djinni::JavaOnewayDispatcher::$post[$captures](JNIEnv * jniEnv)").bracedEnd(");") {
+                writeJavaCall(w, "self->")
+              }
+            } else {
+              writeJavaCall(w, "")
             }
-            else
-              w.w(")")
-            w.wl(";")
-            w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
             m.ret.fold()(ty => (spec.cppNnCheckExpression, isInterface(ty.resolved)) match {
               case (Some(check), true) => {
                 // We have a non-optional interface, assert that we're getting a non-null value
@@ -313,13 +350,20 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
           }
         }
         nativeHook("nativeDestroy", false, Seq.empty, None, {
-          w.wl(s"delete reinterpret_cast<djinni::CppProxyHandle<$cppSelf>*>(nativeRef);")
+          w.wl("DJINNI_FUNCTION_BODY_BEGIN(jniEnv);")
+          if (i.ext.cppUnique)
+            w.wl(s"delete ::djinni::objectFromUniqueHandleAddress<$cppSelf>(nativeRef);")
+          else
+            w.wl(s"delete reinterpret_cast<djinni::CppProxyHandle<$cppSelf>*>(nativeRef);")
+          w.wl("DJINNI_FUNCTION_BODY_END(jniEnv);")
         })
         for (m <- i.methods) {
-          val nativeAddon = if (m.static) "" else "native_"
-          nativeHook(nativeAddon + idJava.method(m.ident), m.static, m.params, m.ret, {
+          // Static methods with flattened arguments are wrapped in Java as well.
+          val nativeAddon = if (m.static && !m.params.exists(isJniFlat)) "" else "native_"
+          nativeHook(nativeAddon + idJava.method(m.ident), m.static, m.params.flatMap(jniFlatParams), m.ret, {
             //w.wl(s"::${spec.jniNamespace}::JniLocalScope jscope(jniEnv, 10);")
-            if (!m.static) w.wl(s"const auto& ref = ::djinni::objectFromHandleAddress<$cppSelf>(nativeRef);")
+            val fromHandle = if (i.ext.cppUnique) "objectFromUniqueHandleAddress" else "objectFromHandleAddress"
+            if (!m.static) w.wl(s"const auto& ref = ::djinni::$fromHandle<$cppSelf>(nativeRef);")
             m.params.foreach(p => {
               if (isInterface(p.ty.resolved) && spec.cppNnCheckExpression.nonEmpty) {
                 // We have a non-optional interface in nn mode, assert that we're getting a non-null value
@@ -331,26 +375,94 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
                 w.wl( s"""DJINNI_ASSERT_MSG(j_$paramName, jniEnv, "Got unexpected null parameter '$paramName' to function $functionString");""")
               }
             })
+            // Convert all arguments up front so the hooks below bracket only the C++ call.
+            m.params.foreach(p => {
+              val v = jniFlatToCpp(p)
+              val converted = (spec.cppNnCheckExpression, isInterface(p.ty.resolved)) match {
+                case (Some(check), true) => s"$check($v)"
+                case _ => v
+              }
+              w.wl(s"auto c_${idJava.local(p.ident)} = $converted;")
+            })
             val methodName = idCpp.method(m.ident)
             val ret = m.ret.fold("")(r => "auto r = ")
             val call = if (m.static) s"$cppSelf::$methodName(" else s"ref->$methodName("
-            writeAlignedCall(w, ret + call, m.params, ")", p => {
-                val v = jniMarshal.toCpp(p.ty, "j_" + idJava.local(p.ident))
-                (spec.cppNnCheckExpression, isInterface(p.ty.resolved)) match {
-                  case (Some(check), true) => s"$check($v)"
-                  case _ => v
-                }
-            })
-            w.wl(";")
-            m.ret.fold()(r => w.wl(s"return ::djinni::release(${jniMarshal.fromCpp(r, "r")});"))
+            w.wl("DJINNI_FUNCTION_BODY_BEGIN(jniEnv);")
+            val args = m.params.map(p => if (p.move) s"std::move(c_${idJava.local(p.ident)})" else "c_" + idJava.local(p.ident))
+            w.wl(ret + call + args.mkString(", ") + ");")
+            w.wl("DJINNI_FUNCTION_BODY_END(jniEnv);")
+            // A unique object's ownership moves into its CppProxy.
+            m.ret.fold()(r => w.wl(s"return ::djinni::release(${jniMarshal.fromCpp(r, if (isUniqueInterface(r.resolved)) "std::move(r)" else "r")});"))
           })
         }
+        val batched = batchMethods(i)
+        if (batched.nonEmpty) {
+          w.wl
+          w.wl(s"CJNIEXPORT void JNICALL ${prefix}_00024Batch_nativeRun(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlongArray j_calls, jint j_size, jlongArray j_results)").braced {
+            w.w("try").bracedEnd(" JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )") {
+              w.wl("DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);")
+              w.wl(s"const auto& ref = ::djinni::objectFromHandleAddress<$cppSelf>(nativeRef);")
+              w.wl("::djinni::JniCallBatch batch(jniEnv, j_calls, j_size, j_results);")
+              w.wl("DJINNI_FUNCTION_BODY_BEGIN(jniEnv);")
+              w.w("while (!batch.done())").braced {
+                w.w("switch (batch.method())").braced {
+                  for (m <- batched) {
+                    w.w(s"case ${i.methods.indexOf(m)}:").braced {
+                      // Read the arguments in order before making the call.
+                      m.params.foreach(p => {
+                        val arg = s"batch.arg<${jniMarshal.paramType(p.ty)}>()"
+                        w.wl(s"auto c_${idJava.local(p.ident)} = ${jniMarshal.toCpp(p.ty, arg)};")
+                      })
+                      val call = s"ref->${idCpp.method(m.ident)}(" + m.params.map(p => "c_" + idJava.local(p.ident)).mkString(", ") + ")"
+                      m.ret match {
+                        case Some(r) => w.wl(s"batch.result(${jniMarshal.fromCpp(r, call)});")
+                        case None => w.wl(call + ";")
+                      }
+                      w.wl("break;")
+                    }
+                  }
+                  w.wl("default:")
+                  w.wl("    DJINNI_ASSERT_MSG(false, jniEnv, \"unknown method in call batch\");")
+                }
+              }
+              w.wl("DJINNI_FUNCTION_BODY_END(jniEnv);")
+              w.wl("batch.finish();")
+            }
+          }
+        }
       }
     }
 
     writeJniFiles(origin, typeParams.nonEmpty, ident, refs, writeJniPrototype, writeJniBody)
   }
 
+  // The JNI arguments a C++ parameter is passed to Java as, and the values to pass, see jniFlatParams.
+  def jniFlatFromCpp(p: Field, c: String): Seq[(Field, String)] = jniFlatRecord(p.ty) match {
+    case Some(r) => jniFlatParams(p).zip(r.fields.map(f => jniMarshal.fromCpp(f.ty, c + "." + idCpp.field(f.ident))))
+    case None if isJniFlatDate(p.ty) => Seq((jniFlatParams(p).head, s"::djinni::Date::toMillis($c)"))
+    case None => jniUnboxedFromCpp(p, c)
+  }
+
+  // The JNI values a C++ field or parameter is passed to Java as, see jniUnboxedFields.
+  def jniUnboxedFromCpp(f: Field, c: String): Seq[(Field, String)] = jniUnboxedFields(f) match {
+    case fields @ Seq(_, _) =>
+      val helper = jniMarshal.unboxedOptionalHelper(f.ty.resolved)
+      fields.zip(Seq(s"$helper::present($c)", s"$helper::fromCpp(jniEnv, $c)"))
+    case _ => Seq((f, jniMarshal.fromCpp(f.ty, c)))
+  }
+
+  // Converts the JNI arguments a parameter was passed as back into its C++ value.
+  def jniFlatToCpp(p: Field): String = jniFlatRecord(p.ty) match {
+    case Some(r) =>
+      val fields = r.fields.zip(jniFlatParams(p)).map { case (f, arg) => jniMarshal.toCpp(f.ty, "j_" + idJava.local(arg.ident)) }
+      cppMarshal.fqTypename(p.ty) + fields.mkString("(", ", ", ")")
+    case None if isJniFlatDate(p.ty) => s"::djinni::Date::fromMillis(j_${idJava.local(jniFlatParams(p).head.ident)})"
+    case None if isJniUnboxedOptional(p.ty) =>
+      val Seq(has, value) = jniFlatParams(p).map(f => "j_" + idJava.local(f.ident))
+      s"${jniMarshal.unboxedOptionalHelper(p.ty.resolved)}::toCpp(jniEnv, $has, $value)"
+    case None => jniMarshal.toCpp(p.ty, "j_" + idJava.local(p.ident))
+  }
+
   def writeJniFiles(origin: String, allInHeader: Boolean, ident: Ident, refs: JNIRefs, writeProto: IndentWriter => Unit, writeBody: IndentWriter => Unit) {
     if (allInHeader) {
       // Template class.  Write both parts to .hpp.
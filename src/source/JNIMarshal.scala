@@ -5,6 +5,7 @@ import djinni.generatorTools._
 import djinni.meta._
 
 class JNIMarshal(spec: Spec) extends Marshal(spec) {
+  private val cppMarshal = new CppMarshal(spec)
 
   // For JNI typename() is always fully qualified and describes the mangled Java type to be used in field/method signatures
   override def typename(tm: MExpr): String = javaTypeSignature(tm)
@@ -29,6 +30,10 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
     s"${helperClass(tm)}::fromCpp(jniEnv, $expr)"
   }
 
+  // Converts an optional primitive passed as a presence flag and a value, see jniUnboxedFields.
+  def unboxedOptionalHelper(tm: MExpr): String =
+    s"::djinni::UnboxedOptional<${spec.cppOptionalTemplate}, ${helperClass(tm.args.head)}>"
+
   // Name for the autogenerated class containing field/method IDs and toJava()/fromJava() methods
   def helperClass(name: String) = spec.jniClassIdentStyle(name)
   private def helperClass(tm: MExpr): String = {
@@ -51,9 +56,10 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
   def toJniType(ty: TypeRef): String = toJniType(ty.resolved, false)
   def toJniType(m: MExpr, needRef: Boolean): String = m.base match {
     case p: MPrimitive => if (needRef) "jobject" else p.jniName
-    case MString => "jstring"
+    case MString | MStringView => "jstring"
     case MOptional => toJniType(m.args.head, true)
     case MBinary => "jbyteArray"
+    case MSpan => s"j${m.args.head.base.asInstanceOf[MPrimitive].jName}Array"
     case tp: MParam => helperClass(tp.name) + "::JniType"
     case e: MExtern => helperClass(m) + (if(needRef) "::Boxed" else "") + "::JniType"
     case _ => "jobject"
@@ -68,17 +74,24 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
   private def javaTypeSignature(tm: MExpr): String = tm.base match {
     case o: MOpaque => o match {
       case p: MPrimitive => p.jSig
-      case MString => "Ljava/lang/String;"
+      case MString | MStringView => "Ljava/lang/String;"
       case MDate => "Ljava/util/Date;"
       case MBinary => "[B"
+      case MSharedBinary => "Lcom/dropbox/djinni/SharedBinary;"
+      case MMappedRegion => "Lcom/dropbox/djinni/MappedRegion;"
+      case MOutBuffer => "Ljava/nio/ByteBuffer;"
       case MOptional =>  tm.args.head.base match {
         case p: MPrimitive => s"Ljava/lang/${p.jBoxed};"
         case MOptional => throw new AssertionError("nested optional?")
         case m => javaTypeSignature(tm.args.head)
       }
       case MList => "Ljava/util/ArrayList;"
+      case MSpan => "[" + javaTypeSignature(tm.args.head)
       case MSet => "Ljava/util/HashSet;"
       case MMap => "Ljava/util/HashMap;"
+      case MResult => "Lcom/dropbox/djinni/Result;"
+      case MHandle => "Lcom/dropbox/djinni/Handle;"
+      case MListDelta => "Lcom/dropbox/djinni/ListDelta;"
     }
     case e: MExtern => e.jni.typeSignature
     case MParam(_) => "Ljava/lang/Object;"
@@ -104,11 +117,19 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
       }
       case MOptional => "Optional"
       case MBinary => "Binary"
+      case MSharedBinary => "SharedBinary"
+      case MMappedRegion => "MappedRegion"
+      case MOutBuffer => "OutBuffer"
       case MString => "String"
+      case MStringView => "StringView"
       case MDate => "Date"
       case MList => "List"
+      case MSpan => "PrimitiveSpan"
       case MSet => "Set"
       case MMap => "Map"
+      case MResult => "Result"
+      case MHandle => "Handle"
+      case MListDelta => "ListDelta"
       case d: MDef => throw new AssertionError("unreachable")
       case e: MExtern => throw new AssertionError("unreachable")
       case p: MParam => throw new AssertionError("not applicable")
@@ -123,10 +144,12 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
         assert(!isInterface(tm.args.head))
         val argHelperClass = helperClass(tm.args.head)
         s"<${spec.cppOptionalTemplate}, $argHelperClass>"
-      case MList | MSet =>
+      case MStringView => s"<${spec.cppStringViewType}>"
+      case MHandle => s"<${cppMarshal.fqTypename(tm)}>"
+      case MList | MSet | MListDelta =>
         assert(tm.args.size == 1)
         f
-      case MMap =>
+      case MMap | MResult =>
         assert(tm.args.size == 2)
         f
       case _ => f
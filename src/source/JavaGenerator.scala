@@ -128,9 +128,17 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
     i.consts.map(c => {
       refs.find(c.ty)
     })
+    // Unique objects have one proxy each, so they aren't registered for reuse.
+    val registered = i.ext.cpp && !i.ext.cppUnique
     if (i.ext.cpp) {
+      if (registered) refs.java.add("com.dropbox.djinni.CppProxyRegistry")
       refs.java.add("java.util.concurrent.atomic.AtomicBoolean")
     }
+    if (batchMethods(i).nonEmpty) refs.java.add("com.dropbox.djinni.CallBatch")
+
+    // An interface that declares its own close() method keeps it as is.
+    val closeable = spec.javaCloseableInterfaces && i.ext.cpp &&
+      !i.methods.exists(m => !m.static && idJava.method(m.ident) == "close")
 
     writeJavaFile(ident, origin, refs.java, w => {
       val javaClass = marshal.typename(ident, i)
@@ -138,7 +146,8 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
       writeDoc(w, doc)
 
       javaAnnotationHeader.foreach(w.wl)
-      w.w(s"public abstract class $javaClass$typeParamList").braced {
+      val implementsCloseable = if (closeable) " implements AutoCloseable" else ""
+      w.w(s"public abstract class $javaClass$typeParamList$implementsCloseable").braced {
         val skipFirst = SkipFirst()
         generateJavaConstants(w, i.consts)
 
@@ -153,6 +162,15 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
           })
           marshal.nullityAnnotation(m.ret).foreach(w.wl)
           w.wl("public abstract " + ret + " " + idJava.method(m.ident) + params.mkString("(", ", ", ")") + throwException + ";")
+          if (i.ext.java && m.params.exists(isJniFlat)) {
+            // What the JavaProxy calls, with records and dates passed as primitives.
+            val flatParams = m.params.flatMap(jniFlatParams).map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident))
+            val returnStmt = m.ret.fold("")(_ => "return ")
+            w.wl
+            w.wl(s"private $ret ${idJava.method(m.ident.name + "_flat")}${flatParams.mkString("(", ", ", ")")}$throwException").braced {
+              w.wl(s"$returnStmt${idJava.method(m.ident)}(${m.params.map(jniUnflatArg).mkString(", ")});")
+            }
+          }
         }
         for (m <- i.methods if m.static) {
           skipFirst { w.wl }
@@ -163,7 +181,29 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             nullityAnnotation + marshal.paramType(p.ty) + " " + idJava.local(p.ident)
           })
           marshal.nullityAnnotation(m.ret).foreach(w.wl)
-          w.wl("public static native "+ ret + " " + idJava.method(m.ident) + params.mkString("(", ", ", ")") + ";")
+          if (m.params.exists(isJniFlat)) {
+            val meth = idJava.method(m.ident)
+            val returnStmt = m.ret.fold("")(_ => "return ")
+            val flatParams = m.params.flatMap(jniFlatParams).map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident))
+            w.wl("public static " + ret + " " + meth + params.mkString("(", ", ", ")")).braced {
+              w.wl(s"${returnStmt}native_$meth(${m.params.flatMap(jniFlatArgs).mkString(", ")});")
+            }
+            w.wl(s"private static native $ret native_$meth${flatParams.mkString("(", ", ", ")")};")
+          } else {
+            w.wl("public static native "+ ret + " " + idJava.method(m.ident) + params.mkString("(", ", ", ")") + ";")
+          }
+        }
+        if (closeable) {
+          skipFirst { w.wl }
+          w.wl("/**")
+          w.wl(" * Releases the C++ object behind this instance now instead of when it is")
+          w.wl(" * garbage collected. Afterwards, calling its methods throws")
+          w.wl(" * IllegalStateException, and it must not be passed to native code. Must not")
+          w.wl(" * race with calls on other threads. Closing twice does nothing, as does")
+          w.wl(" * closing an object implemented in Java unless it overrides this method.")
+          w.wl(" */")
+          w.wl("@Override")
+          w.wl("public void close() {}")
         }
         if (i.ext.cpp) {
           w.wl
@@ -175,12 +215,30 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             w.wl(s"private CppProxy(long nativeRef)").braced {
               w.wl("if (nativeRef == 0) throw new RuntimeException(\"nativeRef is zero\");")
               w.wl(s"this.nativeRef = nativeRef;")
+              if (registered) w.wl("CppProxyRegistry.register(nativeRef, this);")
+            }
+            if (registered) {
+              w.wl
+              w.wl("private static void newProxies(long[] nativeRefs, Object[] proxies)").braced {
+                w.w("for (int i = 0; i < nativeRefs.length; ++i)").braced {
+                  w.wl("proxies[i] = new CppProxy(nativeRefs[i]);")
+                }
+              }
             }
             w.wl
             w.wl("private native void nativeDestroy(long nativeRef);")
             w.wl("public void destroy()").braced {
               w.wl("boolean destroyed = this.destroyed.getAndSet(true);")
-              w.wl("if (!destroyed) nativeDestroy(this.nativeRef);")
+              w.w("if (!destroyed)").braced {
+                if (registered) w.wl("CppProxyRegistry.unregister(this.nativeRef);")
+                w.wl("nativeDestroy(this.nativeRef);")
+              }
+            }
+            if (closeable) {
+              w.wl("@Override")
+              w.wl("public void close()").braced {
+                w.wl("destroy();")
+              }
             }
             w.wl("protected void finalize() throws java.lang.Throwable").braced {
               w.wl("destroy();")
@@ -190,22 +248,105 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
               val ret = marshal.returnType(m.ret)
               val returnStmt = m.ret.fold("")(_ => "return ")
               val params = m.params.map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident)).mkString(", ")
-              val args = m.params.map(p => idJava.local(p.ident)).mkString(", ")
+              val flatParams = m.params.flatMap(jniFlatParams).map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident)).mkString(", ")
+              val args = m.params.flatMap(jniFlatArgs).mkString(", ")
               val meth = idJava.method(m.ident)
               w.wl
               w.wl(s"@Override")
               w.wl(s"public $ret $meth($params)$throwException").braced {
-                w.wl("assert !this.destroyed.get() : \"trying to use a destroyed object\";")
+                if (closeable) {
+                  w.wl("if (this.destroyed.get()) throw new IllegalStateException(\"trying to use a closed object\");")
+                } else {
+                  w.wl("assert !this.destroyed.get() : \"trying to use a destroyed object\";")
+                }
                 w.wl(s"${returnStmt}native_$meth(this.nativeRef${preComma(args)});")
               }
-              w.wl(s"private native $ret native_$meth(long _nativeRef${preComma(params)});")
+              w.wl(s"private native $ret native_$meth(long _nativeRef${preComma(flatParams)});")
+            }
+          }
+        }
+        val batched = batchMethods(i)
+        if (batched.nonEmpty) {
+          w.wl
+          w.wl("/**")
+          w.wl(" * Records calls to the methods of a C++ object that take and return only")
+          w.wl(" * primitives, and makes them all in one native call when run. Methods that")
+          w.wl(" * return a value return a ticket for looking it up in the results instead.")
+          w.wl(" */")
+          w.wl("public static final class Batch extends CallBatch").braced {
+            w.wl("private final CppProxy target;")
+            w.wl
+            w.wl(s"public Batch($javaClass target)").braced {
+              w.wl("if (!(target instanceof CppProxy)) throw new IllegalArgumentException(\"target is not implemented in C++\");")
+              w.wl("this.target = (CppProxy) target;")
+            }
+            for (m <- batched) {
+              val params = m.params.map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident)).mkString(", ")
+              val index = i.methods.indexOf(m)
+              w.wl
+              w.wl(s"public ${m.ret.fold("void")(_ => "int")} ${idJava.method(m.ident)}($params)").braced {
+                if (m.ret.isEmpty) w.wl(s"call($index);")
+                else if (m.params.isEmpty) w.wl(s"return callForResult($index);")
+                else w.wl(s"int ticket = callForResult($index);")
+                for (p <- m.params) {
+                  val put = p.ty.resolved.base.asInstanceOf[MPrimitive].idlName match {
+                    case "f32" => "putFloat"
+                    case "f64" => "putDouble"
+                    case "bool" => "putBoolean"
+                    case _ => "putLong"
+                  }
+                  w.wl(s"$put(${idJava.local(p.ident)});")
+                }
+                if (m.ret.isDefined && m.params.nonEmpty) w.wl("return ticket;")
+              }
             }
+            w.wl
+            w.wl("@Override")
+            w.wl("protected void runNative(long[] calls, int size, long[] results)").braced {
+              if (closeable) {
+                w.wl("if (target.destroyed.get()) throw new IllegalStateException(\"trying to use a closed object\");")
+              } else {
+                w.wl("assert !target.destroyed.get() : \"trying to use a destroyed object\";")
+              }
+              w.wl("nativeRun(target.nativeRef, calls, size, results);")
+            }
+            w.wl("private static native void nativeRun(long nativeRef, long[] calls, int size, long[] results);")
           }
         }
       }
     })
   }
 
+  // The arguments a parameter is passed to native code as, see jniFlatParams.
+  def jniFlatArgs(p: Field): Seq[String] = {
+    val name = idJava.local(p.ident)
+    jniFlatRecord(p.ty) match {
+      case Some(r) => r.fields.map(f => s"$name.${idJava.method("get_" + f.ident.name)}()")
+      case None if isJniFlatDate(p.ty) => Seq(s"$name.getTime()")
+      case None if isJniUnboxedOptional(p.ty) => Seq(s"$name != null", s"$name != null ? $name : ${jniUnboxedZero(p.ty)}")
+      case None => Seq(name)
+    }
+  }
+
+  // Rebuilds a parameter from the primitive arguments it was flattened into.
+  def jniUnflatArg(p: Field): String =
+    if (!isJniFlat(p)) idJava.local(p.ident)
+    else if (isJniUnboxedOptional(p.ty)) {
+      val Seq(has, value) = jniFlatParams(p).map(f => idJava.local(f.ident))
+      s"$has ? $value : null"
+    }
+    else s"new ${marshal.typename(p.ty)}(" + jniFlatParams(p).map(f => idJava.local(f.ident)).mkString(", ") + ")"
+
+  // A record field's value, rebuilding an unboxed optional from its flag and value.
+  def jniUnboxedValue(f: Field): String = jniUnboxedFields(f) match {
+    case Seq(has, value) => s"${idJava.field(has.ident)} ? ${idJava.field(value.ident)} : null"
+    case _ => idJava.field(f.ident)
+  }
+
+  // The value an absent unboxed optional is stored and passed as.
+  def jniUnboxedZero(ty: TypeRef): String =
+    if (ty.resolved.args.head.base == meta.defaults("bool")) "false" else "0"
+
   override def generateRecord(origin: String, ident: Ident, doc: Doc, params: Seq[TypeParam], r: Record) {
     val refs = new JavaRefs()
     r.fields.foreach(f => refs.find(f.ty))
@@ -228,7 +369,9 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
         // Field definitions.
         for (f <- r.fields) {
           w.wl
-          w.wl(s"/*package*/ final ${marshal.fieldType(f.ty)} ${idJava.field(f.ident)};")
+          for (u <- jniUnboxedFields(f)) {
+            w.wl(s"/*package*/ final ${marshal.fieldType(u.ty)} ${idJava.field(u.ident)};")
+          }
         }
 
         // Constructor.
@@ -244,18 +387,46 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
         }
         w.nested {
           for (f <- r.fields) {
-            w.wl(s"this.${idJava.field(f.ident)} = ${idJava.local(f.ident)};")
+            if (isJniUnboxedOptional(f.ty)) {
+              val Seq(has, value) = jniUnboxedFields(f)
+              val local = idJava.local(f.ident)
+              w.wl(s"this.${idJava.field(has.ident)} = $local != null;")
+              w.wl(s"this.${idJava.field(value.ident)} = $local != null ? $local : ${jniUnboxedZero(f.ty)};")
+            } else {
+              w.wl(s"this.${idJava.field(f.ident)} = ${idJava.local(f.ident)};")
+            }
           }
         }
         w.wl("}")
 
+        // Constructor used by native code, which passes optional primitives unboxed.
+        if (r.fields.exists(f => isJniUnboxedOptional(f.ty))) {
+          val fields = r.fields.flatMap(jniUnboxedFields)
+          w.wl
+          w.wl(s"/*package*/ $self(").nestedN(2) {
+            val skipFirst = SkipFirst()
+            for (f <- fields) {
+              skipFirst { w.wl(",") }
+              marshal.nullityAnnotation(f.ty).map(annotation => w.w(annotation + " "))
+              w.w(marshal.typename(f.ty) + " " + idJava.local(f.ident))
+            }
+            w.wl(") {")
+          }
+          w.nested {
+            for (f <- fields) {
+              w.wl(s"this.${idJava.field(f.ident)} = ${idJava.local(f.ident)};")
+            }
+          }
+          w.wl("}")
+        }
+
         // Accessors
         for (f <- r.fields) {
           w.wl
           writeDoc(w, f.doc)
           marshal.nullityAnnotation(f.ty).foreach(w.wl)
           w.w("public " + marshal.typename(f.ty) + " " + idJava.method("get_" + f.ident.name) + "()").braced {
-            w.wl("return " + idJava.field(f.ident) + ";")
+            w.wl("return " + jniUnboxedValue(f) + ";")
           }
         }
 
@@ -274,7 +445,16 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
                 skipFirst { w.wl(" &&") }
                 f.ty.resolved.base match {
                   case MBinary => w.w(s"java.util.Arrays.equals(${idJava.field(f.ident)}, other.${idJava.field(f.ident)})")
-                  case MList | MSet | MMap => w.w(s"this.${idJava.field(f.ident)}.equals(other.${idJava.field(f.ident)})")
+                  case MList | MSet | MMap | MResult => w.w(s"this.${idJava.field(f.ident)}.equals(other.${idJava.field(f.ident)})")
+                  case MOptional if isJniUnboxedOptional(f.ty) =>
+                    val Seq(has, value) = jniUnboxedFields(f).map(u => idJava.field(u.ident))
+                    // Compare floating point values the way the boxed equals() would.
+                    val same = f.ty.resolved.args.head.base.asInstanceOf[MPrimitive].jName match {
+                      case "float" => s"Float.floatToIntBits(this.$value) == Float.floatToIntBits(other.$value)"
+                      case "double" => s"Double.doubleToLongBits(this.$value) == Double.doubleToLongBits(other.$value)"
+                      case _ => s"this.$value == other.$value"
+                    }
+                    w.w(s"this.$has == other.$has && (!this.$has || $same)")
                   case MOptional =>
                     w.w(s"((this.${idJava.field(f.ident)} == null && other.${idJava.field(f.ident)} == null) || ")
                     w.w(s"(this.${idJava.field(f.ident)} != null && this.${idJava.field(f.ident)}.equals(other.${idJava.field(f.ident)})))")
@@ -311,21 +491,25 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             w.wl("int hashCode = 17;")
             // Also pick an arbitrary prime to use as the multiplier.
             val multiplier = "31"
+            def primitiveHashCode(t: MPrimitive, field: String): String = t.jName match {
+              case "byte" | "short" | "int" => field
+              case "long" => s"((int) ($field ^ ($field >>> 32)))"
+              case "float" => s"Float.floatToIntBits($field)"
+              case "double" => s"((int) (Double.doubleToLongBits($field) ^ (Double.doubleToLongBits($field) >>> 32)))"
+              case "boolean" => s"($field ? 1 : 0)"
+              case _ => throw new AssertionError("Unreachable")
+            }
             for (f <- r.fields) {
               val fieldHashCode = f.ty.resolved.base match {
                 case MBinary => s"java.util.Arrays.hashCode(${idJava.field(f.ident)})"
-                case MList | MSet | MMap | MString | MDate => s"${idJava.field(f.ident)}.hashCode()"
+                case MList | MSet | MMap | MResult | MString | MDate => s"${idJava.field(f.ident)}.hashCode()"
                 // Need to repeat this case for MDef
                 case df: MDef => s"${idJava.field(f.ident)}.hashCode()"
+                case MOptional if isJniUnboxedOptional(f.ty) =>
+                  val Seq(has, value) = jniUnboxedFields(f)
+                  s"(${idJava.field(has.ident)} ? ${primitiveHashCode(value.ty.resolved.base.asInstanceOf[MPrimitive], idJava.field(value.ident))} : 0)"
                 case MOptional => s"(${idJava.field(f.ident)} == null ? 0 : ${idJava.field(f.ident)}.hashCode())"
-                case t: MPrimitive => t.jName match {
-                  case "byte" | "short" | "int" => idJava.field(f.ident)
-                  case "long" => s"((int) (${idJava.field(f.ident)} ^ (${idJava.field(f.ident)} >>> 32)))"
-                  case "float" => s"Float.floatToIntBits(${idJava.field(f.ident)})"
-                  case "double" => s"((int) (Double.doubleToLongBits(${idJava.field(f.ident)}) ^ (Double.doubleToLongBits(${idJava.field(f.ident)}) >>> 32)))"
-                  case "boolean" => s"(${idJava.field(f.ident)} ? 1 : 0)"
-                  case _ => throw new AssertionError("Unreachable")
-                }
+                case t: MPrimitive => primitiveHashCode(t, idJava.field(f.ident))
                 case e: MExtern => e.defType match {
                   case DRecord => "(" + e.java.hash.format(idJava.field(f.ident)) + ")"
                   case DEnum => s"${idJava.field(f.ident)}.hashCode()"
@@ -347,8 +531,9 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             w.wl(s""""${self}{" +""")
             for (i <- 0 to r.fields.length-1) {
               val name = idJava.field(r.fields(i).ident)
+              val value = if (isJniUnboxedOptional(r.fields(i).ty)) "(" + jniUnboxedValue(r.fields(i)) + ")" else name
               val comma = if (i > 0) """"," + """ else ""
-              w.wl(s"""${comma}"${name}=" + ${name} +""")
+              w.wl(s"""${comma}"${name}=" + ${value} +""")
             }
           }
           w.wl(s""""}";""")
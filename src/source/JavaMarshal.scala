@@ -34,6 +34,12 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
         case MSet => List(ImportRef("java.util.HashSet"))
         case MMap => List(ImportRef("java.util.HashMap"))
         case MDate => List(ImportRef("java.util.Date"))
+        case MResult => List(ImportRef("com.dropbox.djinni.Result"))
+        case MHandle => List(ImportRef("com.dropbox.djinni.Handle"))
+        case MListDelta => List(ImportRef("com.dropbox.djinni.ListDelta"))
+        case MSharedBinary => List(ImportRef("com.dropbox.djinni.SharedBinary"))
+        case MMappedRegion => List(ImportRef("com.dropbox.djinni.MappedRegion"))
+        case MOutBuffer => List(ImportRef("java.nio.ByteBuffer"))
         case _ => List()
       }
     case _ => List()
@@ -79,17 +85,25 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
             case MOptional => throw new AssertionError("nested optional?")
             case m => f(arg, true)
           }
+        case MSpan => f(tm.args.head, false) + "[]"
         case e: MExtern => (if(needRef) e.java.boxed else e.java.typename) + (if(e.java.generic) args(tm) else "")
         case o =>
           val base = o match {
             case p: MPrimitive => if (needRef) p.jBoxed else p.jName
-            case MString => "String"
+            case MString | MStringView => "String"
             case MDate => "Date"
             case MBinary => "byte[]"
+            case MSharedBinary => "SharedBinary"
+            case MMappedRegion => "MappedRegion"
+            case MOutBuffer => "ByteBuffer"
             case MOptional => throw new AssertionError("optional should have been special cased")
             case MList => "ArrayList"
+            case MSpan => throw new AssertionError("span should have been special cased")
             case MSet => "HashSet"
             case MMap => "HashMap"
+            case MResult => "Result"
+            case MHandle => "Handle"
+            case MListDelta => "ListDelta"
             case d: MDef => withPackage(packageName, idJava.ty(d.name))
             case e: MExtern => throw new AssertionError("unreachable")
             case p: MParam => idJava.typeParam(p.name)
@@ -30,7 +30,12 @@ object Main {
     var cppFileIdentStyle: IdentConverter = IdentStyle.underLower
     var cppOptionalTemplate: String = "std::optional"
     var cppOptionalHeader: String = "<optional>"
+    var cppExpectedHeader: String = "\"djinni_expected.hpp\""
     var cppEnumHashWorkaround : Boolean = true
+    var cppSpanParams: Boolean = false
+    var cppStringViewParams: Boolean = false
+    var cppStringViewType: String = "std::string_view"
+    var cppStringViewHeader: String = "<string_view>"
     var cppNnHeader: Option[String] = None
     var cppNnType: Option[String] = None
     var cppNnCheckExpression: Option[String] = None
@@ -40,6 +45,7 @@ object Main {
     var javaAnnotation: Option[String] = None
     var javaNullableAnnotation: Option[String] = None
     var javaNonnullAnnotation: Option[String] = None
+    var javaCloseableInterfaces: Boolean = false
     var jniOutFolder: Option[File] = None
     var jniHeaderOutFolderOptional: Option[File] = None
     var jniNamespace: String = "djinni_generated"
@@ -49,6 +55,8 @@ object Main {
     var jniFileIdentStyleOptional: Option[IdentConverter] = None
     var jniBaseLibClassIdentStyleOptional: Option[IdentConverter] = None
     var jniBaseLibIncludePrefix: String = ""
+    var jniFlattenArgs: Boolean = false
+    var jniUnboxedOptionals: Boolean = false
     var cppHeaderOutFolderOptional: Option[File] = None
     var cppExt: String = "cpp"
     var cppHeaderExt: String = "hpp"
@@ -103,6 +111,8 @@ object Main {
         .text("Java annotation (@Nullable) to place on all fields and return values that are optional")
       opt[String]("java-nonnull-annotation").valueName("<nonnull-annotation-class>").foreach(x => javaNonnullAnnotation = Some(x))
         .text("Java annotation (@Nonnull) to place on all fields and return values that are not optional")
+      opt[Boolean]("java-closeable-interfaces").valueName("<true/false>").foreach(x => javaCloseableInterfaces = x)
+        .text("Make +c interfaces implement AutoCloseable, with close() releasing the C++ object (default: false)")
       note("")
       opt[File]("cpp-out").valueName("<out-folder>").foreach(x => cppOutFolder = Some(x))
         .text("The output folder for C++ files (Generator disabled if unspecified).")
@@ -120,8 +130,18 @@ object Main {
         .text("The template to use for optional values (default: \"std::optional\")")
       opt[String]("cpp-optional-header").valueName("<header>").foreach(x => cppOptionalHeader = x)
         .text("The header to use for optional values (default: \"<optional>\")")
+      opt[String]("cpp-expected-header").valueName("<header>").foreach(x => cppExpectedHeader = x)
+        .text("The header to use for result values, declaring djinni::expected (default: the support-lib's \"djinni_expected.hpp\")")
       opt[Boolean]("cpp-enum-hash-workaround").valueName("<true/false>").foreach(x => cppEnumHashWorkaround = x)
         .text("Work around LWG-2148 by generating std::hash specializations for C++ enums (default: true)")
+      opt[Boolean]("cpp-span-params").valueName("<true/false>").foreach(x => cppSpanParams = x)
+        .text("Pass list<T> parameters of primitive T to methods implemented only in C++ as djinni::span<const T>, without copying into a std::vector (default: false)")
+      opt[Boolean]("cpp-string-view-params").valueName("<true/false>").foreach(x => cppStringViewParams = x)
+        .text("Pass string parameters to methods implemented only in C++ as string views, without building a std::string (default: false)")
+      opt[String]("cpp-string-view-type").valueName("<type>").foreach(x => cppStringViewType = x)
+        .text("The type to use for string view parameters (default: \"std::string_view\")")
+      opt[String]("cpp-string-view-header").valueName("<header>").foreach(x => cppStringViewHeader = x)
+        .text("The header to use for string view parameters (default: \"<string_view>\")")
       opt[String]("cpp-nn-header").valueName("<header>").foreach(x => cppNnHeader = Some(x))
         .text("The header to use for non-nullable pointers")
       opt[String]("cpp-nn-type").valueName("<header>").foreach(x => cppNnType = Some(x))
@@ -141,6 +161,10 @@ object Main {
         .text("The namespace name to use for generated JNI C++ classes.")
       opt[String]("jni-base-lib-include-prefix").valueName("...").foreach(x => jniBaseLibIncludePrefix = x)
         .text("The JNI base library's include path, relative to the JNI C++ classes.")
+      opt[Boolean]("jni-flatten-args").valueName("<true/false>").foreach(x => jniFlattenArgs = x)
+        .text("Pass small records of primitives and dates as separate primitive JNI arguments (default: false).")
+      opt[Boolean]("jni-unboxed-optionals").valueName("<true/false>").foreach(x => jniUnboxedOptionals = x)
+        .text("Pass optional primitives in records and parameters as a flag and a value instead of boxed (default: false).")
       note("")
       opt[File]("objc-out").valueName("<out-folder>").foreach(x => objcOutFolder = Some(x))
         .text("The output folder for Objective-C files (Generator disabled if unspecified).")
@@ -253,6 +277,7 @@ object Main {
         System.exit(1); return
       case _ =>
     }
+    resolver.borrowParams(idl, cppSpanParams, cppStringViewParams)
 
     System.out.println("Generating...")
     val outFileListWriter = if (outFileListPath.isDefined) {
@@ -270,6 +295,7 @@ object Main {
       javaAnnotation,
       javaNullableAnnotation,
       javaNonnullAnnotation,
+      javaCloseableInterfaces,
       cppOutFolder,
       cppHeaderOutFolder,
       cppIncludePrefix,
@@ -278,6 +304,9 @@ object Main {
       cppFileIdentStyle,
       cppOptionalTemplate,
       cppOptionalHeader,
+      cppExpectedHeader,
+      cppStringViewType,
+      cppStringViewHeader,
       cppEnumHashWorkaround,
       cppNnHeader,
       cppNnType,
@@ -290,6 +319,8 @@ object Main {
       jniClassIdentStyle,
       jniFileIdentStyle,
       jniBaseLibIncludePrefix,
+      jniFlattenArgs,
+      jniUnboxedOptionals,
       cppExt,
       cppHeaderExt,
       objcOutFolder,
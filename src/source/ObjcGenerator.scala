@@ -68,7 +68,7 @@ class ObjcGenerator(spec: Spec) extends Generator(spec) {
   def writeObjcConstVariable(w: IndentWriter, c: Const, s: String): Unit = {
     val nullability = marshal.nullability(c.ty.resolved).fold("")(" __" + _)
     val td = marshal.fqFieldType(c.ty) + nullability
-    // MBinary | MList | MSet | MMap are not allowed for constants.
+    // MBinary | MSharedBinary | MMappedRegion | MOutBuffer | MList | MSet | MMap are not allowed for constants.
     w.w(s"${td} const $s${idObjc.const(c.ident)}")
   }
 
@@ -187,7 +187,7 @@ class ObjcGenerator(spec: Spec) extends Generator(spec) {
     def checkMutable(tm: MExpr): Boolean = tm.base match {
       case MOptional => checkMutable(tm.args.head)
       case MString => true
-      case MBinary => true
+      case MBinary | MSharedBinary | MMappedRegion => true
       case _ => false
     }
 
@@ -281,6 +281,7 @@ class ObjcGenerator(spec: Spec) extends Generator(spec) {
                 case MList => w.w(s"[self.${idObjc.field(f.ident)} isEqualToArray:typedOther.${idObjc.field(f.ident)}]")
                 case MSet => w.w(s"[self.${idObjc.field(f.ident)} isEqualToSet:typedOther.${idObjc.field(f.ident)}]")
                 case MMap => w.w(s"[self.${idObjc.field(f.ident)} isEqualToDictionary:typedOther.${idObjc.field(f.ident)}]")
+                case MResult => w.w(s"[self.${idObjc.field(f.ident)} isEqual:typedOther.${idObjc.field(f.ident)}]")
                 case MOptional =>
                   f.ty.resolved.args.head.base match {
                     case df: MDef if df.defType == DEnum =>
@@ -452,16 +453,21 @@ class ObjcGenerator(spec: Spec) extends Generator(spec) {
             case MOptional => throw new AssertionError("nested optional?")
             case m => f(arg, true)
           }
+        case MHandle => f(tm.args.head, needRef)
         case o =>
           val base = o match {
             case p: MPrimitive => if (needRef) (p.objcBoxed, true) else (p.objcName, false)
-            case MString => ("NSString", true)
+            case MString | MStringView => ("NSString", true)
             case MDate => ("NSDate", true)
-            case MBinary => ("NSData", true)
+            case MBinary | MSharedBinary | MMappedRegion => ("NSData", true)
+            case MOutBuffer => ("NSMutableData", true)
             case MOptional => throw new AssertionError("optional should have been special cased")
-            case MList => ("NSArray", true)
+            case MHandle => throw new AssertionError("handle should have been special cased")
+            case MList | MSpan => ("NSArray", true)
             case MSet => ("NSSet", true)
             case MMap => ("NSDictionary", true)
+            case MResult => ("DJIResult", true)
+            case MListDelta => ("DJIListDelta", true)
             case d: MDef => d.defType match {
               case DEnum => if (needRef) ("NSNumber", true) else (idObjc.ty(d.name), false)
               case DRecord => (idObjc.ty(d.name), true)
@@ -51,6 +51,10 @@ class ObjcMarshal(spec: Spec) extends Marshal(spec) {
   override def fromCpp(tm: MExpr, expr: String): String = throw new AssertionError("direct cpp to objc conversion not possible")
 
   def references(m: Meta, exclude: String = ""): Seq[SymbolReference] = m match {
+    case MResult =>
+      List(ImportRef("<Foundation/Foundation.h>"), ImportRef(q(spec.objcBaseLibIncludePrefix + "DJIResult.h")))
+    case MListDelta =>
+      List(ImportRef("<Foundation/Foundation.h>"), ImportRef(q(spec.objcBaseLibIncludePrefix + "DJIListDelta.h")))
     case o: MOpaque =>
       List(ImportRef("<Foundation/Foundation.h>"))
     case d: MDef => d.defType match {
@@ -104,16 +108,21 @@ class ObjcMarshal(spec: Spec) extends Marshal(spec) {
             case MOptional => throw new AssertionError("nested optional?")
             case m => f(arg, true)
           }
+        case MHandle => f(tm.args.head, needRef)
         case o =>
           val base = o match {
             case p: MPrimitive => if (needRef) (p.objcBoxed, true) else (p.objcName, false)
-            case MString => ("NSString", true)
+            case MString | MStringView => ("NSString", true)
             case MDate => ("NSDate", true)
-            case MBinary => ("NSData", true)
+            case MBinary | MSharedBinary | MMappedRegion => ("NSData", true)
+            case MOutBuffer => ("NSMutableData", true)
             case MOptional => throw new AssertionError("optional should have been special cased")
-            case MList => ("NSArray" + args(tm), true)
+            case MHandle => throw new AssertionError("handle should have been special cased")
+            case MList | MSpan => ("NSArray" + args(tm), true)
             case MSet => ("NSSet" + args(tm), true)
             case MMap => ("NSDictionary" + args(tm), true)
+            case MResult => ("DJIResult" + args(tm), true)
+            case MListDelta => ("DJIListDelta" + args(tm), true)
             case d: MDef => d.defType match {
               case DEnum => if (needRef) ("NSNumber", true) else (idObjc.ty(d.name), false)
               case DRecord => (idObjc.ty(d.name), true)
@@ -173,7 +173,9 @@ class ObjcppGenerator(spec: Spec) extends Generator(spec) {
               })
 
               w.wl(";")
-              m.ret.fold()(r => w.wl(s"return ${objcppMarshal.fromCpp(r, "r")};"))
+              // Objective-C keeps unique objects in a shared_ptr like any other, so they still
+              // go through the proxy cache.
+              m.ret.fold()(r => w.wl(s"return ${objcppMarshal.fromCpp(r, if (isUniqueInterface(r.resolved)) "std::move(r)" else "r")};"))
             }
           }
         }
@@ -191,7 +193,7 @@ class ObjcppGenerator(spec: Spec) extends Generator(spec) {
             w.wl("using Handle::Handle;")
             for (m <- i.methods) {
               val ret = cppMarshal.fqReturnType(m.ret)
-              val params = m.params.map(p => cppMarshal.fqParamType(p.ty) + " c_" + idCpp.local(p.ident))
+              val params = m.params.map(p => cppMarshal.fqParamType(p) + " c_" + idCpp.local(p.ident))
               w.wl(s"$ret ${idCpp.method(m.ident)}${params.mkString("(", ", ", ")")} override").braced {
                 w.w("@autoreleasepool").braced {
                   val ret = m.ret.fold("")(_ => "auto r = ")
@@ -297,7 +299,7 @@ class ObjcppGenerator(spec: Spec) extends Generator(spec) {
     def checkMutable(tm: MExpr): Boolean = tm.base match {
       case MOptional => checkMutable(tm.args.head)
       case MString => true
-      case MBinary => true
+      case MBinary | MSharedBinary | MMappedRegion => true
       case _ => false
     }
 
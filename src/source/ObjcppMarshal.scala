@@ -57,7 +57,8 @@ class ObjcppMarshal(spec: Spec) extends Marshal(spec) {
 
   def helperClass(name: String) = idCpp.ty(name)
   private def helperClass(tm: MExpr): String = {
-    if (isOptionalInterface(tm)) {
+    // Objective-C has no separate handle type, a handle<T> is simply a T.
+    if (isOptionalInterface(tm) || tm.base == MHandle) {
       helperClass(tm.args.head)
     } else {
       helperName(tm) + helperTemplates(tm)
@@ -84,11 +85,19 @@ class ObjcppMarshal(spec: Spec) extends Marshal(spec) {
       }
       case MOptional => "Optional"
       case MBinary => "Binary"
+      case MSharedBinary => "SharedBinary"
+      case MMappedRegion => "MappedRegion"
+      case MOutBuffer => "OutBuffer"
       case MDate => "Date"
       case MString => "String"
+      case MStringView => "StringView"
       case MList => "List"
+      case MSpan => "PrimitiveSpan"
       case MSet => "Set"
       case MMap => "Map"
+      case MResult => "Result"
+      case MHandle => throw new AssertionError("handle should have been special cased")
+      case MListDelta => "ListDelta"
       case d: MDef => throw new AssertionError("unreachable")
       case e: MExtern => throw new AssertionError("unreachable")
       case p: MParam => throw new AssertionError("not applicable")
@@ -102,10 +111,11 @@ class ObjcppMarshal(spec: Spec) extends Marshal(spec) {
         assert(tm.args.size == 1)
         val argHelperClass = helperClass(tm.args.head)
         s"<${spec.cppOptionalTemplate}, $argHelperClass>"
-      case MList | MSet =>
+      case MStringView => s"<${spec.cppStringViewType}>"
+      case MList | MSet | MListDelta =>
         assert(tm.args.size == 1)
         f
-      case MMap =>
+      case MMap | MResult =>
         assert(tm.args.size == 2)
         f
       case _ => f
@@ -92,7 +92,7 @@ class YamlGenerator(spec: Spec) extends Generator(spec) {
   )
 
   private def typeDef(td: TypeDecl) = {
-  	def ext(e: Ext): String = (if(e.cpp) " +c" else "") + (if(e.objc) " +o" else "") + (if(e.java) " +j" else "")
+  	def ext(e: Ext): String = (if(e.cpp) " +c" + (if(e.cppUnique) " unique" else if(e.cppBatch) " batch" else "") else "") + (if(e.objc) " +o" else "") + (if(e.java) " +j" + (if(e.javaNoCache) " nocache" else "") else "")
     def deriving(r: Record) = {
       if(r.derivingTypes.isEmpty) {
         ""
@@ -46,7 +46,10 @@ sealed abstract class TypeDecl {
 case class InternTypeDecl(override val ident: Ident, override val params: Seq[TypeParam], override val body: TypeDef, doc: Doc, override val origin: String) extends TypeDecl
 case class ExternTypeDecl(override val ident: Ident, override val params: Seq[TypeParam], override val body: TypeDef, properties: Map[String, Any], override val origin: String) extends TypeDecl
 
-case class Ext(java: Boolean, cpp: Boolean, objc: Boolean) {
+// javaNoCache: Java objects passed to C++ get a new JavaProxy each time ("+j nocache").
+// cppUnique: C++ returns the objects as std::unique_ptr, owned by their one proxy ("+c unique").
+// cppBatch: Java can record calls to the primitive-only methods and run them at once ("+c batch").
+case class Ext(java: Boolean, cpp: Boolean, objc: Boolean, javaNoCache: Boolean = false, cppUnique: Boolean = false, cppBatch: Boolean = false) {
   def any(): Boolean = {
     java || cpp || objc
   }
@@ -76,7 +79,11 @@ object Record {
 
 case class Interface(ext: Ext, methods: Seq[Interface.Method], consts: Seq[Const]) extends TypeDef
 object Interface {
-  case class Method(ident: Ident, params: Seq[Field], ret: Option[TypeRef], doc: Doc, static: Boolean, const: Boolean)
+  // oneway: a void method whose Java implementation is called asynchronously, see JavaOnewayDispatcher.
+  // coalesce: a oneway call still waiting to be delivered is replaced by the next one.
+  case class Method(ident: Ident, params: Seq[Field], ret: Option[TypeRef], doc: Doc, static: Boolean, const: Boolean,
+                    oneway: Boolean = false, coalesce: Boolean = false)
 }
 
-case class Field(ident: Ident, ty: TypeRef, doc: Doc)
+// move: a method parameter the C++ implementation takes by value, so callers can move into it.
+case class Field(ident: Ident, ty: TypeRef, doc: Doc, move: Boolean = false)
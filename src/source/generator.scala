@@ -35,6 +35,7 @@ package object generatorTools {
                    javaAnnotation: Option[String],
                    javaNullableAnnotation: Option[String],
                    javaNonnullAnnotation: Option[String],
+                   javaCloseableInterfaces: Boolean,
                    cppOutFolder: Option[File],
                    cppHeaderOutFolder: Option[File],
                    cppIncludePrefix: String,
@@ -43,6 +44,9 @@ package object generatorTools {
                    cppFileIdentStyle: IdentConverter,
                    cppOptionalTemplate: String,
                    cppOptionalHeader: String,
+                   cppExpectedHeader: String,
+                   cppStringViewType: String,
+                   cppStringViewHeader: String,
                    cppEnumHashWorkaround: Boolean,
                    cppNnHeader: Option[String],
                    cppNnType: Option[String],
@@ -55,6 +59,8 @@ package object generatorTools {
                    jniClassIdentStyle: IdentConverter,
                    jniFileIdentStyle: IdentConverter,
                    jniBaseLibIncludePrefix: String,
+                   jniFlattenArgs: Boolean,
+                   jniUnboxedOptionals: Boolean,
                    cppExt: String,
                    cppHeaderExt: String,
                    objcOutFolder: Option[File],
@@ -336,6 +342,59 @@ abstract class Generator(spec: Spec)
 
   def withCppNs(t: String) = withNs(Some(spec.cppNamespace), t)
 
+  // The methods of a "+c batch" interface that Java can record into a batch: instance methods
+  // taking and returning only primitives. They're identified by their index in i.methods.
+  def batchMethods(i: Interface): Seq[Interface.Method] = {
+    def primitive(ty: TypeRef) = ty.resolved.base.isInstanceOf[MPrimitive]
+    if (!i.ext.cppBatch) Seq.empty
+    else i.methods.filter(m => !m.static && m.params.forall(p => primitive(p.ty)) && m.ret.forall(primitive))
+  }
+
+  // With --jni-flatten-args, parameters that are small records of primitives or dates are passed
+  // between Java and JNI as separate primitive arguments, and the Java side builds or takes apart
+  // the object itself. Records qualify if they have one to four fields, all primitives, and no
+  // +c/+j extension or type parameters. Return values are never flattened.
+  def jniFlatRecord(ty: TypeRef): Option[Record] = ty.resolved.base match {
+    case d: MDef if spec.jniFlattenArgs && d.defType == DRecord && d.numParams == 0 => d.body match {
+      case r: Record if !r.ext.cpp && !r.ext.java && r.fields.nonEmpty && r.fields.size <= 4 &&
+        r.fields.forall(_.ty.resolved.base.isInstanceOf[MPrimitive]) => Some(r)
+      case _ => None
+    }
+    case _ => None
+  }
+  def isJniFlatDate(ty: TypeRef): Boolean = spec.jniFlattenArgs && ty.resolved.base == MDate
+  def isJniFlat(p: Field): Boolean = jniFlatRecord(p.ty).isDefined || isJniFlatDate(p.ty) || isJniUnboxedOptional(p.ty)
+
+  // The primitive arguments a parameter crosses JNI as: a flattened record's fields named
+  // "<param>_<field>", a date's milliseconds since the epoch as "<param>_millis", an unboxed
+  // optional as in jniUnboxedFields, or else the parameter itself.
+  def jniFlatParams(p: Field): Seq[Field] = jniFlatRecord(p.ty) match {
+    case Some(r) => r.fields.map(f => Field(Ident(p.ident.name + "_" + f.ident.name, p.ident.file, p.ident.loc), f.ty, Doc(Nil)))
+    case None if isJniFlatDate(p.ty) =>
+      Seq(Field(Ident(p.ident.name + "_millis", p.ident.file, p.ident.loc), primitiveTypeRef("i64", p.ident), Doc(Nil)))
+    case None => jniUnboxedFields(p)
+  }
+
+  // With --jni-unboxed-optionals, optional primitives cross JNI as a presence flag and their value
+  // (zero if absent) instead of as a boxed object, both in record fields and in parameters.
+  def isJniUnboxedOptional(ty: TypeRef): Boolean = spec.jniUnboxedOptionals &&
+    ty.resolved.base == MOptional && ty.resolved.args.head.base.isInstanceOf[MPrimitive]
+
+  // The fields an unboxed optional is split into, "has_<name>" and "<name>", or else the field itself.
+  def jniUnboxedFields(f: Field): Seq[Field] = {
+    if (!isJniUnboxedOptional(f.ty)) return Seq(f)
+    val value = TypeRef(f.ty.expr.args.head)
+    value.resolved = f.ty.resolved.args.head
+    Seq(Field(Ident("has_" + f.ident.name, f.ident.file, f.ident.loc), primitiveTypeRef("bool", f.ident), f.doc),
+        Field(f.ident, value, f.doc))
+  }
+
+  private def primitiveTypeRef(name: String, at: Ident): TypeRef = {
+    val ty = TypeRef(TypeExpr(Ident(name, at.file, at.loc), Seq.empty))
+    ty.resolved = MExpr(meta.defaults(name), Seq.empty)
+    ty
+  }
+
   def writeAlignedCall(w: IndentWriter, call: String, params: Seq[Field], delim: String, end: String, f: Field => String): IndentWriter = {
     w.w(call)
     val skipFirst = new SkipFirst
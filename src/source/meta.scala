@@ -16,7 +16,7 @@
 
 package djinni
 
-import djinni.ast.TypeDef
+import djinni.ast.{Interface, TypeDef}
 import scala.collection.immutable
 
 package object meta {
@@ -78,10 +78,20 @@ case class MPrimitive(_idlName: String, jName: String, jniName: String, cName: S
 case object MString extends MOpaque { val numParams = 0; val idlName = "string" }
 case object MDate extends MOpaque { val numParams = 0; val idlName = "date" }
 case object MBinary extends MOpaque { val numParams = 0; val idlName = "binary" }
+case object MSharedBinary extends MOpaque { val numParams = 0; val idlName = "shared_binary" }
+case object MMappedRegion extends MOpaque { val numParams = 0; val idlName = "mapped_region" }
+case object MOutBuffer extends MOpaque { val numParams = 0; val idlName = "out_buffer" }
 case object MOptional extends MOpaque { val numParams = 1; val idlName = "optional" }
 case object MList extends MOpaque { val numParams = 1; val idlName = "list" }
 case object MSet extends MOpaque { val numParams = 1; val idlName = "set" }
 case object MMap extends MOpaque { val numParams = 2; val idlName = "map" }
+case object MResult extends MOpaque { val numParams = 2; val idlName = "result" }
+case object MHandle extends MOpaque { val numParams = 1; val idlName = "handle" }
+case object MListDelta extends MOpaque { val numParams = 1; val idlName = "list_delta" }
+// Not in the IDL: list<T> parameters of primitive T with --cpp-span-params.
+case object MSpan extends MOpaque { val numParams = 1; val idlName = "list" }
+// Not in the IDL either: string parameters with --cpp-string-view-params.
+case object MStringView extends MOpaque { val numParams = 0; val idlName = "string" }
 
 val defaults: Map[String,MOpaque] = immutable.HashMap(
   ("i8",   MPrimitive("i8",   "byte",    "jbyte",    "int8_t",  "Byte",    "B", "int8_t",  "NSNumber")),
@@ -93,11 +103,17 @@ val defaults: Map[String,MOpaque] = immutable.HashMap(
   ("bool", MPrimitive("bool", "boolean", "jboolean", "bool",    "Boolean", "Z", "BOOL",    "NSNumber")),
   ("string", MString),
   ("binary", MBinary),
+  ("shared_binary", MSharedBinary),
+  ("mapped_region", MMappedRegion),
+  ("out_buffer", MOutBuffer),
   ("optional", MOptional),
   ("date", MDate),
   ("list", MList),
   ("set", MSet),
-  ("map", MMap))
+  ("map", MMap),
+  ("result", MResult),
+  ("handle", MHandle),
+  ("list_delta", MListDelta))
 
 def isInterface(ty: MExpr): Boolean = {
   ty.base match {
@@ -106,6 +122,19 @@ def isInterface(ty: MExpr): Boolean = {
   }
 }
 
+// An interface declared "+c unique", held by std::unique_ptr instead of std::shared_ptr.
+def isUniqueInterface(ty: MExpr): Boolean = {
+  val body = ty.base match {
+    case d: MDef => d.body
+    case e: MExtern => e.body
+    case _ => return false
+  }
+  body match {
+    case i: Interface => i.ext.cppUnique
+    case _ => false
+  }
+}
+
 def isOptionalInterface(ty: MExpr): Boolean = {
   ty.base == MOptional && ty.args.length == 1 && isInterface(ty.args.head)
 }
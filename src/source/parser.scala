@@ -57,16 +57,37 @@ private object IdlParser extends RegexParsers {
     case doc~ident~typeParams~_~body => InternTypeDecl(ident, typeParams, body, doc, origin)
   }
 
-  def ext(default: Ext) = (rep1("+" ~> ident) >> checkExts) | success(default)
-  def extRecord = ext(Ext(false, false, false))
+  def ext(default: Ext) = (rep1(extPart) >> checkExts) | success(default)
+  def extPart = ("+" ~> ident) ~ opt("nocache\\b".r | "unique\\b".r | "batch\\b".r) ^^ { case part~flag => (part, flag) }
+  def extRecord = ext(Ext(false, false, false)) >> { e =>
+    if (e.javaNoCache) err("\"nocache\" is only valid for interfaces.")
+    else if (e.cppUnique) err("\"unique\" is only valid for interfaces.")
+    else if (e.cppBatch) err("\"batch\" is only valid for interfaces.")
+    else success(e)
+  }
   def extInterface = ext(Ext(true, true, true))
 
-  def checkExts(parts: List[Ident]): Parser[Ext] = {
+  def checkExts(parts: List[(Ident, Option[String])]): Parser[Ext] = {
     var foundCpp = false
     var foundJava = false
     var foundObjc = false
-
-    for (part <- parts)
+    var foundNoCache = false
+    var foundUnique = false
+    var foundBatch = false
+
+    for ((part, flag) <- parts) {
+      flag match {
+        case Some("nocache") =>
+          if (part.name != "j") return err("\"nocache\" is only valid after \"+j\".")
+          foundNoCache = true
+        case Some("unique") =>
+          if (part.name != "c") return err("\"unique\" is only valid after \"+c\".")
+          foundUnique = true
+        case Some("batch") =>
+          if (part.name != "c") return err("\"batch\" is only valid after \"+c\".")
+          foundBatch = true
+        case _ =>
+      }
       part.name match {
         case "c" => {
           if (foundCpp) return err("Found multiple \"c\" modifiers.")
@@ -82,7 +103,10 @@ private object IdlParser extends RegexParsers {
         }
         case _ => return err("Invalid modifier \"" + part.name + "\"")
       }
-    success(Ext(foundJava, foundCpp, foundObjc))
+    }
+    // The one owner of a unique object is the proxy that C++ hands it to.
+    if (foundUnique && (foundJava || foundObjc)) return err("\"unique\" interfaces can't be +j or +o.")
+    success(Ext(foundJava, foundCpp, foundObjc, foundNoCache, foundUnique, foundBatch))
   }
 
   def typeDef: Parser[TypeDef] = record | enum | interface
@@ -135,8 +159,21 @@ private object IdlParser extends RegexParsers {
     case "const " => true
     case "" => false
   }
-  def method: Parser[Interface.Method] = doc ~ staticLabel ~ constLabel ~ ident ~ parens(repsepend(field, ",")) ~ opt(ret) ^^ {
-    case doc~staticLabel~constLabel~ ident~params~ret => Interface.Method(ident, params, ret, doc, staticLabel, constLabel)
+  def moveLabel: Parser[Boolean] = ("move ".r | "".r) ^^ {
+    case "move " => true
+    case "" => false
+  }
+  def onewayLabel: Parser[(Boolean, Boolean)] = ("oneway coalesce ".r | "oneway ".r | "".r) ^^ {
+    case "oneway coalesce " => (true, true)
+    case "oneway " => (true, false)
+    case "" => (false, false)
+  }
+  def param: Parser[Field] = doc ~ moveLabel ~ ident ~ ":" ~ typeRef ^^ {
+    case doc~moveLabel~ident~_~typeRef => Field(ident, typeRef, doc, moveLabel)
+  }
+  def method: Parser[Interface.Method] = doc ~ staticLabel ~ constLabel ~ onewayLabel ~ ident ~ parens(repsepend(param, ",")) ~ opt(ret) ^^ {
+    case doc~staticLabel~constLabel~onewayLabel~ident~params~ret =>
+      Interface.Method(ident, params, ret, doc, staticLabel, constLabel, onewayLabel._1, onewayLabel._2)
   }
   def ret: Parser[TypeRef] = ":" ~> typeRef
 
@@ -84,6 +84,23 @@ def resolve(metas: Scope, idl: Seq[TypeDecl]): Option[Error] = {
   None
 }
 
+// For --cpp-span-params and --cpp-string-view-params. Only interfaces implemented solely in C++
+// are changed: their parameters only ever travel into C++, so the borrowed forms never have to
+// be converted back. Parameters marked "move" are kept, since the implementation wants to own them.
+def borrowParams(idl: Seq[TypeDecl], spans: Boolean, stringViews: Boolean) {
+  for (td <- idl) td match {
+    case InternTypeDecl(_, _, i: Interface, _, _) if i.ext.cpp && !i.ext.java && !i.ext.objc =>
+      for (m <- i.methods; p <- m.params if !p.move) p.ty.resolved match {
+        case MExpr(MList, Seq(elem @ MExpr(prim: MPrimitive, _))) if spans && prim.idlName != "bool" =>
+          p.ty.resolved = MExpr(MSpan, Seq(elem))
+        case MExpr(MString, _) if stringViews =>
+          p.ty.resolved = MExpr(MStringView, Seq.empty)
+        case _ =>
+      }
+    case _ =>
+  }
+}
+
 private def resolve(scope: Scope, typeDef: TypeDef) {
   typeDef match {
     case e: Enum => resolveEnum(scope, e)
@@ -135,7 +152,7 @@ private def constTypeCheck(ty: MExpr, value: Any, resolvedConsts: Seq[Const]) {
     throw new AssertionError(s"Const ${ref.name} does not exist")
   }
   ty.base match {
-    case MBinary | MList | MSet | MMap =>
+    case MBinary | MSharedBinary | MMappedRegion | MOutBuffer | MList | MSet | MMap | MResult | MHandle | MListDelta =>
       throw new AssertionError("Type not allowed for constant")
     case MString =>
       if (!value.isInstanceOf[String] ||
@@ -224,11 +241,22 @@ private def resolveRecord(scope: Scope, r: Record) {
       case MBinary | MList | MSet | MMap =>
         if (r.derivingTypes.contains(DerivingType.Ord))
           throw new Error(f.ident.loc, "Cannot compare collections in Ord deriving (Java limitation)").toException
+      case MSharedBinary | MMappedRegion | MHandle =>
+        if (r.derivingTypes.contains(DerivingType.Eq) || r.derivingTypes.contains(DerivingType.Ord))
+          throw new Error(f.ident.loc, s"Cannot compare ${f.ty.resolved.base.asInstanceOf[MOpaque].idlName} in Eq or Ord deriving (it is a reference)").toException
+      case MListDelta =>
+        if (r.derivingTypes.contains(DerivingType.Eq) || r.derivingTypes.contains(DerivingType.Ord))
+          throw new Error(f.ident.loc, "Cannot compare list_delta in Eq or Ord deriving").toException
+      case MOutBuffer =>
+        throw new Error(f.ident.loc, "out_buffer is only allowed as a method parameter").toException
       case MString =>
       case MDate =>
       case MOptional =>
         if (r.derivingTypes.contains(DerivingType.Ord))
           throw new Error(f.ident.loc, "Cannot compare optional in Ord deriving").toException
+      case MResult =>
+        if (r.derivingTypes.contains(DerivingType.Ord))
+          throw new Error(f.ident.loc, "Cannot compare result in Ord deriving").toException
       case t: MPrimitive => t.idlName match {
         case "bool" =>
           if (r.derivingTypes.contains(DerivingType.Ord))
@@ -279,14 +307,32 @@ private def resolveInterface(scope: Scope, i: Interface) {
         throw Error(m.ident.loc, "+c method cannot be both static and const").toException
     }
   }
+  // Nobody waits for a oneway call, so there's no result to return.
+  for (m <- i.methods if m.oneway) {
+    if (!i.ext.java)
+      throw Error(m.ident.loc, "oneway methods are only allowed in +j interfaces").toException
+    if (m.ret.isDefined)
+      throw Error(m.ident.loc, "oneway methods cannot return a value").toException
+  }
   val dupeChecker = new DupeChecker("method")
   for (m <- i.methods) {
     dupeChecker.check(m.ident)
     for (p <- m.params) {
       resolveRef(scope, p.ty)
+      // The buffer is only borrowed for the duration of a call into C++.
+      if (p.ty.resolved.base == MOutBuffer && (i.ext.java || i.ext.objc))
+        throw Error(p.ident.loc, "out_buffer parameters are only allowed in +c interfaces").toException
+      // Ownership only ever moves from C++ to a proxy, so there's nothing to pass back in.
+      if (isUniqueInterface(p.ty.resolved))
+        throw Error(p.ident.loc, "unique interfaces are only allowed as a method return type").toException
     }
     m.ret match {
-      case Some(ty) => resolveRef(scope, ty)
+      case Some(ty) =>
+        resolveRef(scope, ty)
+        if (ty.resolved.base == MOutBuffer)
+          throw Error(ty.expr.ident.loc, "out_buffer is only allowed as a method parameter").toException
+        if (isUniqueInterface(ty.resolved) && (i.ext.java || i.ext.objc))
+          throw Error(ty.expr.ident.loc, "unique interfaces can only be returned from methods of +c interfaces").toException
       case _ =>
     }
   }
@@ -314,6 +360,23 @@ private def buildMExpr(scope: Scope, e: TypeExpr): MExpr = {
         // HACK: In Java, we use "null" for optionals, so we don't allow nested optionals.
         throw Error(e.ident.loc, "directly nested optionals not allowed").toException
       }
+      if (margs.exists(_.base == MOutBuffer)) {
+        throw Error(e.ident.loc, "out_buffer is only allowed as a method parameter").toException
+      }
+      if (meta == MHandle && !(margs.head.base match {
+        case d: MDef => d.defType == DInterface
+        case e: MExtern => e.defType == DInterface
+        case _ => false
+      })) {
+        throw Error(e.ident.loc, "handle<T> requires an interface type").toException
+      }
+      if (margs.exists(isUniqueInterface)) {
+        throw Error(e.ident.loc, "unique interfaces are only allowed as a method return type").toException
+      }
+      if (meta == MResult && margs.exists(_.base == MOptional)) {
+        // Java's Result only holds non-null values on either side.
+        throw Error(e.ident.loc, "optional not allowed as result value or error type").toException
+      }
       MExpr(meta, margs)
     }
     case None =>
@@ -0,0 +1,224 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace djinni {
+
+/*
+ * Wrapper marking a value as the error alternative of an `expected`. Use `make_unexpected()`
+ * to construct one with type deduction:
+ *
+ *     djinni::expected<int32_t, std::string> parse(const std::string & s) {
+ *         if (s.empty()) return djinni::make_unexpected(std::string("empty input"));
+ *         ...
+ *     }
+ */
+template <class E>
+class unexpected {
+public:
+    unexpected() = delete;
+    explicit unexpected(const E & e) : m_error(e) {}
+    explicit unexpected(E && e) : m_error(std::move(e)) {}
+
+    const E & value() const & { return m_error; }
+    E & value() & { return m_error; }
+    E && value() && { return std::move(m_error); }
+
+private:
+    E m_error;
+};
+
+template <class E>
+unexpected<typename std::decay<E>::type> make_unexpected(E && e) {
+    return unexpected<typename std::decay<E>::type>(std::forward<E>(e));
+}
+
+/*
+ * Thrown by `expected::value()` if the object holds an error, and by `expected::error()` if it
+ * holds a value.
+ */
+class bad_expected_access : public std::exception {
+public:
+    const char * what() const noexcept override { return "bad expected access"; }
+};
+
+/*
+ * Holds either a value of type T or an error of type E. This is the C++ representation of the
+ * IDL type `result<T, E>`. Errors cross the language boundary as ordinary values, so failing
+ * calls do not need to go through exception translation.
+ *
+ * The interface is a subset of the one proposed for `std::expected` (P0323): `has_value()`,
+ * `operator bool`, `value()`, `error()`, `operator*` and `operator->`.
+ */
+template <class T, class E>
+class expected {
+public:
+    using value_type = T;
+    using error_type = E;
+
+    expected() : m_has_value(true) { new (&m_value) T(); }
+    expected(const T & v) : m_has_value(true) { new (&m_value) T(v); }
+    expected(T && v) : m_has_value(true) { new (&m_value) T(std::move(v)); }
+    expected(const unexpected<E> & e) : m_has_value(false) { new (&m_error) E(e.value()); }
+    expected(unexpected<E> && e) : m_has_value(false) { new (&m_error) E(std::move(e).value()); }
+
+    expected(const expected & other) : m_has_value(other.m_has_value) {
+        if (m_has_value) {
+            new (&m_value) T(other.m_value);
+        } else {
+            new (&m_error) E(other.m_error);
+        }
+    }
+
+    expected(expected && other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                         std::is_nothrow_move_constructible<E>::value)
+        : m_has_value(other.m_has_value) {
+        if (m_has_value) {
+            new (&m_value) T(std::move(other.m_value));
+        } else {
+            new (&m_error) E(std::move(other.m_error));
+        }
+    }
+
+    ~expected() { destroy(); }
+
+    expected & operator=(const expected & other) {
+        if (this != &other) {
+            expected tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    expected & operator=(expected && other) {
+        static_assert(std::is_nothrow_move_constructible<T>::value ||
+                      std::is_nothrow_move_constructible<E>::value,
+                      "expected<T, E> assignment needs T or E to be nothrow move constructible");
+        if (this == &other) {
+            return *this;
+        }
+        if (m_has_value && other.m_has_value) {
+            m_value = std::move(other.m_value);
+        } else if (!m_has_value && !other.m_has_value) {
+            m_error = std::move(other.m_error);
+        } else if (other.m_has_value) {
+            reinit(m_value, m_error, std::move(other.m_value));
+            m_has_value = true;
+        } else {
+            reinit(m_error, m_value, std::move(other.m_error));
+            m_has_value = false;
+        }
+        return *this;
+    }
+
+    bool has_value() const noexcept { return m_has_value; }
+    explicit operator bool() const noexcept { return m_has_value; }
+
+    const T & value() const & { check_value(); return m_value; }
+    T & value() & { check_value(); return m_value; }
+    T && value() && { check_value(); return std::move(m_value); }
+
+    const E & error() const & { check_error(); return m_error; }
+    E & error() & { check_error(); return m_error; }
+    E && error() && { check_error(); return std::move(m_error); }
+
+    const T & operator*() const & { return value(); }
+    T & operator*() & { return value(); }
+    const T * operator->() const { return &value(); }
+    T * operator->() { return &value(); }
+
+private:
+    void check_value() const { if (!m_has_value) throw bad_expected_access(); }
+    void check_error() const { if (m_has_value) throw bad_expected_access(); }
+
+    /*
+     * Replaces the alternative `from` with a `To` constructed from `arg`. As with `std::expected`,
+     * if that constructor throws, `from` is still in place and the exception propagates. The
+     * strategy is picked at compile time, so only the one used has to compile for To and From.
+     */
+    template <class To, class Arg>
+    using reinit_strategy = std::integral_constant<int,
+        std::is_nothrow_constructible<To, Arg>::value ? 0 :
+        std::is_nothrow_move_constructible<To>::value ? 1 : 2>;
+
+    template <class To, class From, class Arg>
+    static void reinit(To & to, From & from, Arg && arg) {
+        reinit(to, from, std::forward<Arg>(arg), reinit_strategy<To, Arg>());
+    }
+
+    // Constructing To cannot throw, so construct it in place.
+    template <class To, class From, class Arg>
+    static void reinit(To & to, From & from, Arg && arg, std::integral_constant<int, 0>) {
+        from.~From();
+        new (&to) To(std::forward<Arg>(arg));
+    }
+
+    // Moving To cannot throw, so construct it in a temporary first.
+    template <class To, class From, class Arg>
+    static void reinit(To & to, From & from, Arg && arg, std::integral_constant<int, 1>) {
+        To tmp(std::forward<Arg>(arg));
+        from.~From();
+        new (&to) To(std::move(tmp));
+    }
+
+    // Otherwise move From aside and put it back if constructing To throws.
+    template <class To, class From, class Arg>
+    static void reinit(To & to, From & from, Arg && arg, std::integral_constant<int, 2>) {
+        From backup(std::move(from));
+        from.~From();
+        try {
+            new (&to) To(std::forward<Arg>(arg));
+        } catch (...) {
+            new (&from) From(std::move(backup));
+            throw;
+        }
+    }
+
+    void destroy() {
+        if (m_has_value) {
+            m_value.~T();
+        } else {
+            m_error.~E();
+        }
+    }
+
+    bool m_has_value;
+    union {
+        T m_value;
+        E m_error;
+    };
+};
+
+template <class T, class E>
+bool operator==(const expected<T, E> & a, const expected<T, E> & b) {
+    if (a.has_value() != b.has_value()) {
+        return false;
+    }
+    return a.has_value() ? *a == *b : a.error() == b.error();
+}
+
+template <class T, class E>
+bool operator!=(const expected<T, E> & a, const expected<T, E> & b) {
+    return !(a == b);
+}
+
+} // namespace djinni
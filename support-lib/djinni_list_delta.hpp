@@ -0,0 +1,174 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace djinni {
+
+/*
+ * An edit script for a list, used for the list_delta<T> type: a sequence of inserts, removals
+ * and replacements that turns one version of a list into the next. Passing the delta instead of
+ * the whole list makes an update cost proportional to what changed, which matters for listener
+ * callbacks on long lists that change a few elements at a time. Each op's index refers to the
+ * list as left by the ops before it.
+ *
+ *     void Inbox::mark_read(size_t i) {
+ *         m_messages[i].read = true;
+ *         m_listener->on_messages_changed(djinni::list_delta<Message>().replace(i, {m_messages[i]}));
+ *     }
+ *
+ * Consecutive inserts or replacements of adjacent ranges, and consecutive removals at the same
+ * index, are merged into a single op.
+ */
+template <class T>
+class list_delta {
+public:
+    enum class kind { insert = 0, remove = 1, replace = 2 };
+
+    struct op {
+        kind type;
+        size_t index;
+        // Number of elements inserted, removed or replaced.
+        size_t count;
+        // The new elements; empty for a removal.
+        std::vector<T> values;
+    };
+
+    list_delta & insert(size_t index, std::vector<T> values) {
+        if (!m_ops.empty() && m_ops.back().type == kind::insert
+                && m_ops.back().index + m_ops.back().count == index) {
+            append_values(m_ops.back(), std::move(values));
+        } else if (!values.empty()) {
+            m_ops.push_back(op { kind::insert, index, values.size(), std::move(values) });
+        }
+        return *this;
+    }
+
+    list_delta & remove(size_t index, size_t count = 1) {
+        if (!m_ops.empty() && m_ops.back().type == kind::remove && m_ops.back().index == index) {
+            m_ops.back().count += count;
+        } else if (count) {
+            m_ops.push_back(op { kind::remove, index, count, {} });
+        }
+        return *this;
+    }
+
+    list_delta & replace(size_t index, std::vector<T> values) {
+        if (!m_ops.empty() && m_ops.back().type == kind::replace
+                && m_ops.back().index + m_ops.back().count == index) {
+            append_values(m_ops.back(), std::move(values));
+        } else if (!values.empty()) {
+            m_ops.push_back(op { kind::replace, index, values.size(), std::move(values) });
+        }
+        return *this;
+    }
+
+    // Appends `o` as is, without merging. Used by the marshallers.
+    void push_back(op o) { m_ops.push_back(std::move(o)); }
+
+    const std::vector<op> & ops() const noexcept { return m_ops; }
+    bool empty() const noexcept { return m_ops.empty(); }
+    void clear() noexcept { m_ops.clear(); }
+
+    // Applies the ops to `list` in order. Throws std::out_of_range if an op doesn't fit.
+    void apply_to(std::vector<T> & list) const {
+        for (const auto & o : m_ops) {
+            const auto end = o.index + (o.type == kind::insert ? 0 : o.count);
+            if (o.index > list.size() || end > list.size()) {
+                throw std::out_of_range("list_delta op out of range");
+            }
+            const auto at = list.begin() + static_cast<std::ptrdiff_t>(o.index);
+            switch (o.type) {
+                case kind::insert:
+                    list.insert(at, o.values.begin(), o.values.end());
+                    break;
+                case kind::remove:
+                    list.erase(at, at + static_cast<std::ptrdiff_t>(o.count));
+                    break;
+                case kind::replace:
+                    std::copy(o.values.begin(), o.values.end(), at);
+                    break;
+            }
+        }
+    }
+
+private:
+    static void append_values(op & o, std::vector<T> values) {
+        o.values.insert(o.values.end(),
+                        std::make_move_iterator(values.begin()),
+                        std::make_move_iterator(values.end()));
+        o.count = o.values.size();
+    }
+
+    std::vector<op> m_ops;
+};
+
+/*
+ * A list that records every change made to it as a list_delta, so the owner can hand listeners
+ * the delta since the last notification instead of a copy of the list.
+ *
+ *     m_messages.push_back(std::move(message));
+ *     m_listener->on_messages_changed(m_messages.take_delta());
+ */
+template <class T>
+class observable_list {
+public:
+    observable_list() = default;
+    explicit observable_list(std::vector<T> items) : m_items(std::move(items)) {}
+
+    const std::vector<T> & items() const noexcept { return m_items; }
+    size_t size() const noexcept { return m_items.size(); }
+    bool empty() const noexcept { return m_items.empty(); }
+    const T & operator[](size_t index) const { return m_items[index]; }
+
+    void insert(size_t index, T value) {
+        m_items.insert(m_items.begin() + static_cast<std::ptrdiff_t>(index), value);
+        m_delta.insert(index, { std::move(value) });
+    }
+
+    void push_back(T value) { insert(m_items.size(), std::move(value)); }
+
+    void erase(size_t index, size_t count = 1) {
+        const auto at = m_items.begin() + static_cast<std::ptrdiff_t>(index);
+        m_items.erase(at, at + static_cast<std::ptrdiff_t>(count));
+        m_delta.remove(index, count);
+    }
+
+    void set(size_t index, T value) {
+        m_items[index] = value;
+        m_delta.replace(index, { std::move(value) });
+    }
+
+    // Returns the changes made since the last call and starts recording afresh.
+    list_delta<T> take_delta() {
+        list_delta<T> delta;
+        std::swap(delta, m_delta);
+        return delta;
+    }
+
+private:
+    std::vector<T> m_items;
+    list_delta<T> m_delta;
+};
+
+} // namespace djinni
@@ -0,0 +1,116 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace djinni {
+
+/*
+ * Read-only bytes owned by someone else, used for the mapped_region type, typically a range of a
+ * memory-mapped file. It behaves like a const span over the bytes plus a reference that keeps
+ * them alive: copies share the same owner, and the bytes stay valid until the last copy (in any
+ * language) is gone. Crossing the boundary never copies the bytes.
+ *
+ *     auto region = djinni::mapped_region::map_file(path);
+ *     parse(region.data(), region.size());
+ */
+class mapped_region {
+public:
+    mapped_region() noexcept = default;
+    mapped_region(const uint8_t * data, size_t size, std::shared_ptr<const void> owner) noexcept
+        : m_data(size ? data : nullptr), m_size(size), m_owner(std::move(owner)) {}
+
+    const uint8_t * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    const uint8_t * begin() const noexcept { return m_data; }
+    const uint8_t * end() const noexcept { return m_data + m_size; }
+    const std::shared_ptr<const void> & owner() const noexcept { return m_owner; }
+
+    /*
+     * Map `length` bytes of the file at `path`, starting at `offset`, read-only. A length of 0
+     * maps everything up to the end of the file. Throws std::out_of_range if the range is not
+     * inside the file, and std::system_error if the file can't be opened or mapped.
+     */
+    static mapped_region map_file(const std::string & path, uint64_t offset = 0, size_t length = 0) {
+#ifdef _WIN32
+        (void)path; (void)offset; (void)length;
+        throw std::runtime_error("mapped_region::map_file is not supported on this platform");
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+        struct Closer {
+            int fd;
+            ~Closer() { ::close(fd); }
+        } closer { fd };
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            throw std::system_error(errno, std::generic_category(), "fstat " + path);
+        }
+        const uint64_t fileSize = static_cast<uint64_t>(st.st_size);
+        if (offset > fileSize || length > fileSize - offset) {
+            throw std::out_of_range("mapped_region: range is outside of " + path);
+        }
+        const uint64_t size = length ? length : fileSize - offset;
+        if (size == 0) {
+            return {};
+        }
+        if (size > SIZE_MAX) {
+            throw std::out_of_range("mapped_region: range does not fit into memory");
+        }
+
+        // mmap wants a page-aligned offset; map from the page start and skip the difference.
+        const uint64_t page = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        const uint64_t skip = offset % page;
+        const size_t mapLength = static_cast<size_t>(size + skip);
+        void * base = ::mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fd,
+                             static_cast<off_t>(offset - skip));
+        if (base == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "mmap " + path);
+        }
+        std::shared_ptr<const void> owner(base, [mapLength](const void * p) {
+            ::munmap(const_cast<void *>(p), mapLength);
+        });
+        return { static_cast<const uint8_t *>(base) + skip, static_cast<size_t>(size), std::move(owner) };
+#endif
+    }
+
+private:
+    const uint8_t * m_data = nullptr;
+    size_t m_size = 0;
+    std::shared_ptr<const void> m_owner;
+};
+
+} // namespace djinni
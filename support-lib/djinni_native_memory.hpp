@@ -0,0 +1,68 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace djinni {
+
+namespace detail {
+inline std::atomic<size_t> & reportedNativeBytes() noexcept {
+    static std::atomic<size_t> bytes { 0 };
+    return bytes;
+}
+}
+
+/*
+ * Optional base class for C++ implementations of +c interfaces that retain a lot of memory,
+ * e.g. decoded images or caches. The proxy that pins such an object on the other side of the
+ * boundary is tiny, so the garbage collector has no reason to collect it soon, and the C++
+ * memory it holds stays alive. Implementations call set_native_bytes() whenever their retained
+ * size changes noticeably; the total over all live objects is reportedNativeBytes(). The JNI
+ * support library uses it to ask for a collection when it grows, see
+ * jniSetNativeMemoryThreshold() in djinni_ref_stats.hpp.
+ *
+ *     class Bitmap final : public Image, public djinni::NativeMemoryReporter { ... };
+ */
+class NativeMemoryReporter {
+public:
+    size_t native_bytes() const noexcept { return m_bytes.load(std::memory_order_relaxed); }
+
+protected:
+    NativeMemoryReporter() = default;
+    // A copy reports its own size.
+    NativeMemoryReporter(const NativeMemoryReporter &) noexcept : NativeMemoryReporter() {}
+    NativeMemoryReporter & operator=(const NativeMemoryReporter &) noexcept { return *this; }
+    ~NativeMemoryReporter() { set_native_bytes(0); }
+
+    void set_native_bytes(size_t bytes) noexcept {
+        const size_t old = m_bytes.exchange(bytes, std::memory_order_relaxed);
+        // Unsigned wraparound makes this a subtraction when the size shrinks.
+        detail::reportedNativeBytes().fetch_add(bytes - old, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<size_t> m_bytes { 0 };
+};
+
+// Bytes currently reported by all live NativeMemoryReporter objects.
+inline size_t reportedNativeBytes() noexcept {
+    return detail::reportedNativeBytes().load(std::memory_order_relaxed);
+}
+
+} // namespace djinni
@@ -0,0 +1,65 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace djinni {
+
+/*
+ * Caller-provided memory that a C++ method writes its result into, used for out_buffer
+ * parameters: a direct java.nio.ByteBuffer in Java and an NSMutableData in Objective-C. It is
+ * only valid for the duration of the call. Reusing one buffer across calls lets hot methods
+ * return bytes without allocating anything.
+ *
+ * The convention is to return the number of bytes written. If the result doesn't fit, write
+ * nothing and return the size needed instead; the caller sees a result larger than its buffer
+ * and retries with a bigger one.
+ *
+ *     int32_t Encoder::encode_frame(djinni::out_buffer out) {
+ *         const auto & frame = next_frame();
+ *         return static_cast<int32_t>(out.write(frame.data(), frame.size()));
+ *     }
+ */
+class out_buffer {
+public:
+    out_buffer(uint8_t * data, size_t capacity) noexcept : m_data(data), m_capacity(capacity) {}
+
+    uint8_t * data() const noexcept { return m_data; }
+    size_t capacity() const noexcept { return m_capacity; }
+    uint8_t * begin() const noexcept { return m_data; }
+    uint8_t * end() const noexcept { return m_data + m_capacity; }
+
+    bool fits(size_t size) const noexcept { return size <= m_capacity; }
+
+    // Copy `size` bytes to the start of the buffer if they fit. Returns `size` either way.
+    size_t write(const void * bytes, size_t size) const noexcept {
+        if (size && fits(size)) {
+            std::memcpy(m_data, bytes, size);
+        }
+        return size;
+    }
+
+private:
+    uint8_t * m_data;
+    size_t m_capacity;
+};
+
+} // namespace djinni
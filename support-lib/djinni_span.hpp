@@ -0,0 +1,123 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace djinni {
+
+/*
+ * A non-owning view of `size()` contiguous elements, like std::span in C++20. With
+ * --cpp-span-params, list<T> parameters of primitive T in methods implemented only in C++ are
+ * passed as span<const T> instead of std::vector<T>. The elements are only valid for the
+ * duration of the call; copy them if they are needed afterwards.
+ */
+template <class T>
+class span {
+public:
+    span() noexcept = default;
+    span(T * data, size_t size) noexcept : m_data(data), m_size(size) {}
+    template <class Alloc>
+    span(const std::vector<typename std::remove_const<T>::type, Alloc> & v) noexcept
+        : m_data(v.data()), m_size(v.size()) {}
+
+    T * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    T * begin() const noexcept { return m_data; }
+    T * end() const noexcept { return m_data + m_size; }
+    T & operator[](size_t i) const noexcept { assert(i < m_size); return m_data[i]; }
+
+private:
+    T * m_data = nullptr;
+    size_t m_size = 0;
+};
+
+namespace detail {
+
+/*
+ * Temporary storage for span parameters, taken from a per-thread pool so that steady-state calls
+ * don't allocate. Each live scratch_buffer on a thread has its own slot; they must be destroyed
+ * in the reverse order of construction, which locals and temporaries are.
+ */
+class scratch_buffer {
+public:
+    explicit scratch_buffer(size_t bytes) : m_slot(depth()++) {
+        auto & slots = pool();
+        if (slots.size() <= m_slot) {
+            slots.resize(m_slot + 1);
+        }
+        auto & slot = slots[m_slot];
+        if (slot.size() < bytes) {
+            slot.resize(bytes);
+        }
+        m_data = slot.data();
+    }
+    scratch_buffer(scratch_buffer && other) noexcept : m_slot(other.m_slot), m_data(other.m_data) {
+        other.m_slot = kMovedFrom;
+    }
+    scratch_buffer(const scratch_buffer &) = delete;
+    scratch_buffer & operator=(const scratch_buffer &) = delete;
+    ~scratch_buffer() {
+        if (m_slot != kMovedFrom) {
+            assert(depth() == m_slot + 1);
+            --depth();
+        }
+    }
+
+    // Aligned for any primitive type.
+    void * data() const noexcept { return m_data; }
+
+private:
+    static constexpr size_t kMovedFrom = static_cast<size_t>(-1);
+
+    // Slots are separate allocations, so growing the pool doesn't move buffers in use.
+    static std::vector<std::vector<unsigned char>> & pool() {
+        static thread_local std::vector<std::vector<unsigned char>> slots;
+        return slots;
+    }
+    static size_t & depth() {
+        static thread_local size_t d = 0;
+        return d;
+    }
+
+    size_t m_slot;
+    void * m_data;
+};
+
+// What the marshallers return for span parameters: the elements, converted into scratch memory.
+template <class T>
+class borrowed_span {
+public:
+    borrowed_span(scratch_buffer && scratch, size_t size) noexcept
+        : m_scratch(std::move(scratch)), m_span(static_cast<const T *>(m_scratch.data()), size) {}
+
+    operator span<const T>() const noexcept { return m_span; }
+
+private:
+    scratch_buffer m_scratch;
+    span<const T> m_span;
+};
+
+} // namespace detail
+
+} // namespace djinni
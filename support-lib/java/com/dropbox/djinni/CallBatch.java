@@ -0,0 +1,137 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+package com.dropbox.djinni;
+
+import java.util.Arrays;
+
+/**
+ * Base class of the Batch classes generated for "+c batch" interfaces. A
+ * batch records calls to a C++ object's methods that take and return only
+ * primitives, and {@link #run} makes them all with a single native call, so a
+ * burst of small calls pays for one JNI transition instead of one each.
+ *
+ * Methods that return a value return a ticket when recorded; pass it to the
+ * matching getter of the {@link Results} returned by run(). Calls run in the
+ * order they were recorded. If one throws, the calls after it don't run and
+ * run() throws the exception. Either way the batch is empty afterwards and
+ * can be reused. A batch is not thread-safe.
+ */
+public abstract class CallBatch {
+
+    // Each call is its method index followed by one word per argument.
+    private long[] mCalls = new long[64];
+    private int mSize;
+    private int mCallCount;
+    private int mResultCount;
+
+    /** @return the number of calls recorded since the last run. */
+    public final int size() {
+        return mCallCount;
+    }
+
+    public final boolean isEmpty() {
+        return mCallCount == 0;
+    }
+
+    public final Results run() {
+        long[] results = new long[mResultCount];
+        try {
+            if (mCallCount > 0) {
+                runNative(mCalls, mSize, results);
+            }
+        } finally {
+            mSize = 0;
+            mCallCount = 0;
+            mResultCount = 0;
+        }
+        return new Results(results);
+    }
+
+    protected abstract void runNative(long[] calls, int size, long[] results);
+
+    protected final void call(int method) {
+        putLong(method);
+        ++mCallCount;
+    }
+
+    protected final int callForResult(int method) {
+        call(method);
+        return mResultCount++;
+    }
+
+    protected final void putLong(long value) {
+        if (mSize == mCalls.length) {
+            mCalls = Arrays.copyOf(mCalls, mSize * 2);
+        }
+        mCalls[mSize++] = value;
+    }
+
+    protected final void putBoolean(boolean value) {
+        putLong(value ? 1 : 0);
+    }
+
+    protected final void putFloat(float value) {
+        putLong(Float.floatToRawIntBits(value));
+    }
+
+    protected final void putDouble(double value) {
+        putLong(Double.doubleToRawLongBits(value));
+    }
+
+    /** The values returned by the calls of one run, looked up by ticket. */
+    public static final class Results {
+
+        private final long[] mValues;
+
+        private Results(long[] values) {
+            this.mValues = values;
+        }
+
+        public int size() {
+            return mValues.length;
+        }
+
+        public boolean getBoolean(int ticket) {
+            return mValues[ticket] != 0;
+        }
+
+        public byte getByte(int ticket) {
+            return (byte) mValues[ticket];
+        }
+
+        public short getShort(int ticket) {
+            return (short) mValues[ticket];
+        }
+
+        public int getInt(int ticket) {
+            return (int) mValues[ticket];
+        }
+
+        public long getLong(int ticket) {
+            return mValues[ticket];
+        }
+
+        public float getFloat(int ticket) {
+            return Float.intBitsToFloat((int) mValues[ticket]);
+        }
+
+        public double getDouble(int ticket) {
+            return Double.longBitsToDouble(mValues[ticket]);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+/**
+ * Per-method metrics for calls crossing the JNI boundary, in both directions.
+ *
+ * Metrics are only collected if the native code was built with
+ * DJINNI_ENABLE_METRICS defined; otherwise {@link #snapshot} returns an
+ * empty array. See djinni_metrics.hpp for the C++ side of this API.
+ */
+public final class CallMetrics {
+
+    public static final class Method {
+        /** "&lt;java class&gt;.&lt;java method&gt;", e.g. "com.example.Foo.bar". */
+        public final String name;
+        /** True for calls from Java into C++, false for calls from C++ into Java. */
+        public final boolean javaToCpp;
+        public final long calls;
+        /** Calls which threw before their body completed. */
+        public final long errors;
+        /** Total time spent converting arguments and return values. */
+        public final long marshalNanos;
+        /** Total time spent in the called implementation. */
+        public final long bodyNanos;
+        /** Bucket i counts calls that took [2^i, 2^(i+1)) nanoseconds to marshal. */
+        public final long[] marshalHistogram;
+        /** Bucket i counts calls whose body took [2^i, 2^(i+1)) nanoseconds. */
+        public final long[] bodyHistogram;
+
+        // Constructed by native code only.
+        private Method(String name, boolean javaToCpp, long calls, long errors,
+                       long marshalNanos, long bodyNanos,
+                       long[] marshalHistogram, long[] bodyHistogram) {
+            this.name = name;
+            this.javaToCpp = javaToCpp;
+            this.calls = calls;
+            this.errors = errors;
+            this.marshalNanos = marshalNanos;
+            this.bodyNanos = bodyNanos;
+            this.marshalHistogram = marshalHistogram;
+            this.bodyHistogram = bodyHistogram;
+        }
+
+        @Override
+        public String toString() {
+            return name + (javaToCpp ? " (Java->C++)" : " (C++->Java)") +
+                    ": calls=" + calls + " errors=" + errors +
+                    " marshalNanos=" + marshalNanos + " bodyNanos=" + bodyNanos;
+        }
+    }
+
+    private CallMetrics() {}
+
+    /** Whether the native library collects call metrics. */
+    public static native boolean isEnabled();
+
+    /** Metrics of all methods called at least once since startup. */
+    public static native Method[] snapshot();
+
+    /** Zero all counters. */
+    public static native void reset();
+}
@@ -0,0 +1,49 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.lang.ref.WeakReference;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Weak references to the live CppProxy objects of all interfaces, keyed by
+ * the address of their native handle. Generated CppProxy classes register
+ * themselves on construction and unregister in destroy(); native code looks
+ * proxies up here to reuse them, see djinni_support.hpp.
+ */
+public final class CppProxyRegistry {
+
+    private static final ConcurrentHashMap<Long, WeakReference<Object>> proxies =
+            new ConcurrentHashMap<Long, WeakReference<Object>>();
+
+    private CppProxyRegistry() {}
+
+    public static void register(long nativeRef, Object proxy) {
+        proxies.put(nativeRef, new WeakReference<Object>(proxy));
+    }
+
+    /** Must be called before the native handle is deleted, since its address may be reused. */
+    public static void unregister(long nativeRef) {
+        proxies.remove(nativeRef);
+    }
+
+    // Called by native code only. Returns null once the proxy is no longer strongly reachable.
+    private static Object get(long nativeRef) {
+        WeakReference<Object> ref = proxies.get(nativeRef);
+        return ref == null ? null : ref.get();
+    }
+}
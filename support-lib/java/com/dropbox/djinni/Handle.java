@@ -0,0 +1,56 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+/**
+ * An opaque reference to a C++ object, used for the handle<T> type. T is the
+ * interface the object implements, but Java can't call it: a handle can only
+ * be passed back to native code or closed. In exchange it is much cheaper than
+ * an interface: C++ holds a std::shared_ptr to the object for it, and there is
+ * no proxy cache. Each time native code returns a handle, Java gets a new
+ * Handle object, so compare them through native code rather than with equals().
+ *
+ * The reference is released when this object is closed or garbage collected.
+ * Afterwards it must not be passed to native code.
+ */
+public final class Handle<T> implements AutoCloseable {
+
+    private long nativeRef;
+
+    // Called by native code.
+    private Handle(long nativeRef) {
+        if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+        this.nativeRef = nativeRef;
+    }
+
+    @Override
+    public synchronized void close() {
+        long ref = nativeRef;
+        if (ref != 0) {
+            nativeRef = 0;
+            nativeDestroy(ref);
+        }
+    }
+
+    @Override
+    protected void finalize() throws Throwable {
+        close();
+        super.finalize();
+    }
+
+    private static native void nativeDestroy(long nativeRef);
+}
@@ -0,0 +1,55 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+/**
+ * Counts of the JNI functions called by djinni's native code on the
+ * current thread, e.g. to assert a call budget in tests:
+ *
+ * <pre>
+ * long before = JniCallCounters.threadCalls();
+ * MyInterface.getRecord();
+ * assertTrue(JniCallCounters.threadCalls() - before &lt;= 12);
+ * </pre>
+ *
+ * Only available if the native code was built with
+ * DJINNI_ENABLE_JNI_CALL_COUNTERS defined; otherwise every count is 0.
+ * See djinni_jni_calls.hpp for the C++ side of this API.
+ */
+public final class JniCallCounters {
+
+    private JniCallCounters() {}
+
+    public static native boolean isEnabled();
+
+    /** Total JNI functions called on this thread so far. */
+    public static native long threadCalls();
+
+    /** Calls on this thread so far of a single JNI function, e.g. "GetObjectField". */
+    public static native long threadCallsTo(String function);
+
+    /** Most local references alive at once since the last reset. */
+    public static native long threadLocalRefHighWater();
+
+    public static native void resetThreadLocalRefHighWater();
+
+    /** Global references currently alive, across all threads. */
+    public static native long liveGlobalRefs();
+
+    /** Per-function call counts and times on this thread, most called first. */
+    public static native String threadReport();
+}
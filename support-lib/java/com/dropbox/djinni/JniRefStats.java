@@ -0,0 +1,161 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.util.Timer;
+import java.util.TimerTask;
+
+/**
+ * Counts of the JNI global references held by Djinni, and statistics of the
+ * proxy caches that hold most of them. Use this to spot proxy leaks before
+ * the JVM's global reference table overflows.
+ *
+ * See djinni_ref_stats.hpp for the C++ side of this API.
+ */
+public final class JniRefStats {
+
+    public static final class Cache {
+        /** Map entries, including proxies that died but are not yet removed. */
+        public final long entries;
+        /** Proxies still alive. */
+        public final long liveHandles;
+        /** Lookups that returned an existing proxy. */
+        public final long hits;
+        /** Lookups that allocated a new proxy. */
+        public final long misses;
+        /** Misses that also dropped an expired entry for the same object. */
+        public final long prunes;
+        /** Interface types with the most entries, largest first. */
+        public final String[] typeNames;
+        /** Entries of each type in {@link #typeNames}. */
+        public final long[] typeEntries;
+
+        // Constructed by native code only.
+        private Cache(long entries, long liveHandles, long hits, long misses, long prunes,
+                      String[] typeNames, long[] typeEntries) {
+            this.entries = entries;
+            this.liveHandles = liveHandles;
+            this.hits = hits;
+            this.misses = misses;
+            this.prunes = prunes;
+            this.typeNames = typeNames;
+            this.typeEntries = typeEntries;
+        }
+    }
+
+    public interface Listener {
+        /**
+         * Called once the threshold is exceeded, on whichever thread passed an
+         * interface across the boundary at that point. Exceptions are ignored.
+         */
+        void onThresholdExceeded(JniRefStats stats);
+    }
+
+    /** All live global references created through djinni::GlobalRef. */
+    public final long globalRefs;
+    /** Of those, the references held by C++ proxies of Java objects. */
+    public final long javaProxyRefs;
+    /** Classes, pending exceptions and references held by application code. */
+    public final long otherGlobalRefs;
+    /**
+     * References released on native threads not attached to the JVM, waiting
+     * to be deleted. Not included in globalRefs, except for those still held
+     * by cached C++ proxies of Java objects waiting to be destroyed.
+     */
+    public final long pendingReleases;
+    /** All references ever released on such threads. */
+    public final long deferredReleases;
+    /**
+     * Bytes retained by C++ objects, as reported through
+     * djinni::NativeMemoryReporter.
+     */
+    public final long nativeBytes;
+    /** Cache of C++ proxies for objects implemented in Java. */
+    public final Cache javaProxyCache;
+    /** Cache of Java proxies (CppProxy) for objects implemented in C++. */
+    public final Cache cppProxyCache;
+
+    // Constructed by native code only.
+    private JniRefStats(long globalRefs, long javaProxyRefs, long otherGlobalRefs,
+                        long pendingReleases, long deferredReleases, long nativeBytes,
+                        Cache javaProxyCache, Cache cppProxyCache) {
+        this.globalRefs = globalRefs;
+        this.javaProxyRefs = javaProxyRefs;
+        this.otherGlobalRefs = otherGlobalRefs;
+        this.pendingReleases = pendingReleases;
+        this.deferredReleases = deferredReleases;
+        this.nativeBytes = nativeBytes;
+        this.javaProxyCache = javaProxyCache;
+        this.cppProxyCache = cppProxyCache;
+    }
+
+    /** Current counts, listing at most maxTypes interface types per cache. */
+    public static native JniRefStats snapshot(int maxTypes);
+
+    /** Current counts as text suitable for a log. */
+    public static native String report(int maxTypes);
+
+    /**
+     * Call listener once more than threshold global references are alive. It
+     * fires at most once per call to this method. A threshold of zero or a
+     * null listener disables the check.
+     */
+    public static native void setThreshold(long threshold, Listener listener);
+
+    /**
+     * Request a garbage collection whenever the bytes reported by C++ objects
+     * through djinni::NativeMemoryReporter grow by more than the given amount,
+     * so the CppProxy objects pinning them are finalized sooner. Zero disables
+     * it, which is the default.
+     */
+    public static native void setNativeMemoryThreshold(long bytes);
+
+    // Called by native code only.
+    private static void onNativeMemoryPressure() {
+        System.gc();
+    }
+
+    /**
+     * Delete the references released on threads not attached to the JVM and
+     * return how many there were. This also happens whenever an attached
+     * thread calls into native code that uses Djinni, so it is only needed
+     * when those calls are rare.
+     */
+    public static native long releasePending();
+
+    private static Timer reaper;
+
+    /**
+     * Call {@link #releasePending()} every intervalMillis on a daemon thread,
+     * replacing any schedule set before. An interval of zero stops it.
+     */
+    public static synchronized void setReaperInterval(long intervalMillis) {
+        if (reaper != null) {
+            reaper.cancel();
+            reaper = null;
+        }
+        if (intervalMillis > 0) {
+            reaper = new Timer("djinni-ref-reaper", true);
+            reaper.schedule(new TimerTask() {
+                @Override
+                public void run() {
+                    releasePending();
+                }
+            }, intervalMillis, intervalMillis);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+package com.dropbox.djinni;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Java representation of the djinni IDL type `list_delta<T>`: a sequence of
+ * inserts, removals and replacements that turns one version of a list into
+ * the next. Listeners that receive a delta instead of the whole list can
+ * keep a mirror of it up to date at a cost proportional to the change, with
+ * {@link #applyTo}. Each op's index refers to the list as left by the ops
+ * before it.
+ *
+ * Consecutive inserts or replacements of adjacent ranges, and consecutive
+ * removals at the same index, are merged into a single op.
+ */
+public final class ListDelta<T> {
+
+    public enum Kind { INSERT, REMOVE, REPLACE }
+
+    public static final class Op<T> {
+
+        // The native marshaller reads these fields directly.
+        private final int mKind;
+        private final int mIndex;
+        private int mCount;
+        private final ArrayList<T> mValues;
+
+        private Op(int kind, int index, int count, ArrayList<T> values) {
+            this.mKind = kind;
+            this.mIndex = index;
+            this.mCount = count;
+            this.mValues = values;
+        }
+
+        public Kind getKind() {
+            return Kind.values()[mKind];
+        }
+
+        public int getIndex() {
+            return mIndex;
+        }
+
+        /** @return the number of elements inserted, removed or replaced. */
+        public int getCount() {
+            return mCount;
+        }
+
+        /** @return the new elements; empty for a removal. */
+        public List<T> getValues() {
+            return mValues == null ? Collections.<T>emptyList() : Collections.unmodifiableList(mValues);
+        }
+
+        @Override
+        public String toString() {
+            return getKind() + "(" + mIndex + ", " + (mValues == null ? mCount : mValues) + ")";
+        }
+    }
+
+    private final ArrayList<Op<T>> mOps = new ArrayList<Op<T>>();
+
+    public ListDelta<T> insert(int index, List<T> values) {
+        return addValues(Kind.INSERT, index, values);
+    }
+
+    public ListDelta<T> remove(int index, int count) {
+        Op<T> last = mOps.isEmpty() ? null : mOps.get(mOps.size() - 1);
+        if (last != null && last.mKind == Kind.REMOVE.ordinal() && last.mIndex == index) {
+            last.mCount += count;
+        } else if (count > 0) {
+            mOps.add(new Op<T>(Kind.REMOVE.ordinal(), index, count, null));
+        }
+        return this;
+    }
+
+    public ListDelta<T> replace(int index, List<T> values) {
+        return addValues(Kind.REPLACE, index, values);
+    }
+
+    public List<Op<T>> getOps() {
+        return Collections.unmodifiableList(mOps);
+    }
+
+    public boolean isEmpty() {
+        return mOps.isEmpty();
+    }
+
+    /**
+     * Applies the ops to {@code list} in order.
+     * @throws IndexOutOfBoundsException if an op doesn't fit the list.
+     */
+    public void applyTo(List<T> list) {
+        for (Op<T> op : mOps) {
+            switch (op.getKind()) {
+                case INSERT:
+                    list.addAll(op.mIndex, op.mValues);
+                    break;
+                case REMOVE:
+                    list.subList(op.mIndex, op.mIndex + op.mCount).clear();
+                    break;
+                case REPLACE:
+                    if (op.mIndex + op.mCount > list.size()) {
+                        throw new IndexOutOfBoundsException("list_delta op out of range");
+                    }
+                    for (int i = 0; i < op.mCount; ++i) {
+                        list.set(op.mIndex + i, op.mValues.get(i));
+                    }
+                    break;
+            }
+        }
+    }
+
+    @Override
+    public String toString() {
+        return "ListDelta" + mOps;
+    }
+
+    private ListDelta<T> addValues(Kind kind, int index, List<T> values) {
+        Op<T> last = mOps.isEmpty() ? null : mOps.get(mOps.size() - 1);
+        if (last != null && last.mKind == kind.ordinal() && last.mIndex + last.mCount == index) {
+            last.mValues.addAll(values);
+            last.mCount = last.mValues.size();
+        } else if (!values.isEmpty()) {
+            mOps.add(new Op<T>(kind.ordinal(), index, values.size(), new ArrayList<T>(values)));
+        }
+        return this;
+    }
+
+    // Called by native code: appends an op as is, without merging.
+    private void add(int kind, int index, int count, ArrayList<T> values) {
+        mOps.add(new Op<T>(kind, index, count, values));
+    }
+}
@@ -0,0 +1,89 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+package com.dropbox.djinni;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Read-only bytes owned by native code, used for the mapped_region type,
+ * typically a range of a memory-mapped file. In C++ they are a
+ * djinni::mapped_region; this object holds one reference to its owner.
+ * Passing it to or from native code moves a reference instead of copying the
+ * bytes, and asByteBuffer() reads them in place.
+ *
+ * The region is released (unmapped, once nothing in C++ uses it either) when
+ * this object is closed or garbage collected. Afterwards its methods throw
+ * IllegalStateException, and it must not be passed to native code.
+ */
+public final class MappedRegion implements AutoCloseable {
+
+    private long nativeRef;
+
+    // Also called by native code.
+    private MappedRegion(long nativeRef) {
+        if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+        this.nativeRef = nativeRef;
+    }
+
+    /**
+     * Map length bytes of the file at path, starting at offset, read-only.
+     * A length of 0 maps everything up to the end of the file.
+     */
+    public static MappedRegion map(String path, long offset, long length) {
+        return new MappedRegion(nativeMap(path, offset, length));
+    }
+
+    public long size() {
+        return nativeSize(ref());
+    }
+
+    /**
+     * A read-only view of the bytes, without copying them. It is only valid
+     * while this object is reachable and not closed.
+     */
+    public ByteBuffer asByteBuffer() {
+        ByteBuffer view = nativeView(ref());
+        // JNI can't create a direct buffer for an empty native one.
+        return view == null ? ByteBuffer.allocate(0).asReadOnlyBuffer() : view.asReadOnlyBuffer();
+    }
+
+    @Override
+    public synchronized void close() {
+        long ref = nativeRef;
+        if (ref != 0) {
+            nativeRef = 0;
+            nativeDestroy(ref);
+        }
+    }
+
+    @Override
+    protected void finalize() throws Throwable {
+        close();
+        super.finalize();
+    }
+
+    private synchronized long ref() {
+        if (nativeRef == 0) throw new IllegalStateException("MappedRegion is closed");
+        return nativeRef;
+    }
+
+    private static native long nativeMap(String path, long offset, long length);
+    private static native long nativeSize(long nativeRef);
+    private static native ByteBuffer nativeView(long nativeRef);
+    private static native void nativeDestroy(long nativeRef);
+}
@@ -0,0 +1,96 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+/**
+ * Java representation of the djinni IDL type `result<T, E>`: holds either
+ * a value of type T or an error of type E.
+ *
+ * The class is final and can only be constructed through {@link #ok} and
+ * {@link #error}, so an instance is always exactly one of the two cases.
+ * Results are marshalled like any other value; an error returned from C++
+ * does not throw.
+ */
+public final class Result<T, E> {
+
+    // The native marshaller reads and writes these fields directly.
+    private final boolean mIsOk;
+    private final T mValue;
+    private final E mError;
+
+    private Result(boolean isOk, T value, E error) {
+        this.mIsOk = isOk;
+        this.mValue = value;
+        this.mError = error;
+    }
+
+    public static <T, E> Result<T, E> ok(T value) {
+        if (value == null) throw new NullPointerException("value");
+        return new Result<T, E>(true, value, null);
+    }
+
+    public static <T, E> Result<T, E> error(E error) {
+        if (error == null) throw new NullPointerException("error");
+        return new Result<T, E>(false, null, error);
+    }
+
+    public boolean isOk() {
+        return mIsOk;
+    }
+
+    public boolean isError() {
+        return !mIsOk;
+    }
+
+    /**
+     * @return the value.
+     * @throws IllegalStateException if this result holds an error.
+     */
+    public T getValue() {
+        if (!mIsOk) throw new IllegalStateException("Result holds an error: " + mError);
+        return mValue;
+    }
+
+    /**
+     * @return the error.
+     * @throws IllegalStateException if this result holds a value.
+     */
+    public E getError() {
+        if (mIsOk) throw new IllegalStateException("Result holds a value");
+        return mError;
+    }
+
+    @Override
+    public boolean equals(Object obj) {
+        if (!(obj instanceof Result)) {
+            return false;
+        }
+        Result<?, ?> other = (Result<?, ?>) obj;
+        return mIsOk == other.mIsOk &&
+                java.util.Objects.deepEquals(mIsOk ? mValue : mError, mIsOk ? other.mValue : other.mError);
+    }
+
+    @Override
+    public int hashCode() {
+        return java.util.Arrays.deepHashCode(new Object[] { mIsOk, mIsOk ? mValue : mError });
+    }
+
+    @Override
+    public String toString() {
+        return (mIsOk ? "Ok(" + mValue : "Error(" + mError) + ")";
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+/**
+ * Records a span for every call crossing the JNI boundary, in both
+ * directions, and exports them in the Chrome trace event format.
+ *
+ * Spans are only recorded if the native code was built with
+ * DJINNI_ENABLE_TRACING defined, and only while tracing is enabled.
+ * See djinni_tracing.hpp for the C++ side of this API.
+ */
+public final class Tracing {
+
+    private Tracing() {}
+
+    public static native void setEnabled(boolean enabled);
+
+    public static native boolean isEnabled();
+
+    /**
+     * @return the spans recorded so far as Chrome trace JSON, suitable for
+     * chrome://tracing or https://ui.perfetto.dev.
+     */
+    public static native String dump();
+
+    /** Drop all spans recorded so far. */
+    public static native void clear();
+}
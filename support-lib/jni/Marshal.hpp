@@ -17,10 +17,17 @@
 #pragma once
 
 #include "djinni_support.hpp"
+#include "../djinni_expected.hpp"
+#include "../djinni_list_delta.hpp"
+#include "../djinni_mapped_region.hpp"
+#include "../djinni_out_buffer.hpp"
+#include "../djinni_span.hpp"
 #include <cassert>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -150,6 +157,40 @@ namespace djinni
 		}
 	};
 	
+	/*
+	 * A string parameter with --cpp-string-view-params. View is the configured string view
+	 * type, constructed from a pointer and a size. The UTF-8 lives in per-thread scratch memory
+	 * for the duration of the call. Only passed from Java into C++.
+	 */
+	template <class View>
+	class StringView
+	{
+	public:
+		using CppType = View;
+		using JniType = jstring;
+		
+		using Boxed = StringView;
+		
+		class Borrowed
+		{
+		public:
+			Borrowed(detail::borrowed_span<char>&& chars) noexcept : m_chars(std::move(chars)) {}
+			operator View() const
+			{
+				const span<const char> chars = m_chars;
+				return View(chars.data(), chars.size());
+			}
+		private:
+			detail::borrowed_span<char> m_chars;
+		};
+		
+		static Borrowed toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			return jniUTF8ViewFromString(jniEnv, j);
+		}
+	};
+	
 	struct Binary
 	{
 		using CppType = std::vector<uint8_t>;
@@ -208,6 +249,166 @@ namespace djinni
 		}
 	};
 	
+	/*
+	 * Immutable bytes shared by reference: Java holds the C++ buffer through a
+	 * com.dropbox.djinni.SharedBinary, so crossing the boundary never copies them.
+	 */
+	struct SharedBinary
+	{
+		using CppType = std::shared_ptr<const std::vector<uint8_t>>;
+		using JniType = jobject;
+		
+		using Boxed = SharedBinary;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const auto & data = JniClass<SharedBinary>::get();
+			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+			const jlong handle = jniEnv->GetLongField(j, data.field_nativeRef);
+			DJINNI_ASSERT_MSG(handle, jniEnv, "SharedBinary used after close()");
+			return *reinterpret_cast<const CppType*>(static_cast<uintptr_t>(handle));
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			const auto & data = JniClass<SharedBinary>::get();
+			// Owned by the Java object from here on, see SharedBinary.close().
+			std::unique_ptr<CppType> handle(new CppType(c ? c : std::make_shared<const std::vector<uint8_t>>()));
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor,
+				static_cast<jlong>(reinterpret_cast<uintptr_t>(handle.get()))));
+			jniExceptionCheck(jniEnv);
+			handle.release();
+			return j;
+		}
+		
+	private:
+		SharedBinary() = default;
+		friend ::djinni::JniClass<SharedBinary>;
+		
+		const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/SharedBinary") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(J)V") };
+		const jfieldID field_nativeRef { jniGetFieldID(clazz.get(), "nativeRef", "J") };
+	};
+	
+	/*
+	 * Read-only bytes with a shared owner, typically a memory-mapped file range. Java holds a
+	 * copy of the ::djinni::mapped_region through a com.dropbox.djinni.MappedRegion and reads
+	 * the bytes through a direct ByteBuffer, so crossing the boundary never copies them.
+	 */
+	struct MappedRegion
+	{
+		using CppType = ::djinni::mapped_region;
+		using JniType = jobject;
+		
+		using Boxed = MappedRegion;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const auto & data = JniClass<MappedRegion>::get();
+			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+			const jlong handle = jniEnv->GetLongField(j, data.field_nativeRef);
+			DJINNI_ASSERT_MSG(handle, jniEnv, "MappedRegion used after close()");
+			return *reinterpret_cast<const CppType*>(static_cast<uintptr_t>(handle));
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			const auto & data = JniClass<MappedRegion>::get();
+			// Owned by the Java object from here on, see MappedRegion.close().
+			std::unique_ptr<CppType> handle(new CppType(c));
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor,
+				static_cast<jlong>(reinterpret_cast<uintptr_t>(handle.get()))));
+			jniExceptionCheck(jniEnv);
+			handle.release();
+			return j;
+		}
+		
+	private:
+		MappedRegion() = default;
+		friend ::djinni::JniClass<MappedRegion>;
+		
+		const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/MappedRegion") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(J)V") };
+		const jfieldID field_nativeRef { jniGetFieldID(clazz.get(), "nativeRef", "J") };
+	};
+	
+	/*
+	 * An opaque reference to a C++ object for handle<T>, where Ptr is the std::shared_ptr to
+	 * T's class. Java holds a type-erased copy of the shared_ptr through a
+	 * com.dropbox.djinni.Handle; there's no proxy and no proxy cache, so every fromCpp() creates
+	 * a new Handle.
+	 */
+	class HandleClass
+	{
+	private:
+		HandleClass() = default;
+		friend ::djinni::JniClass<HandleClass>;
+		template <class Ptr> friend class Handle;
+		
+		const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/Handle") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(J)V") };
+		const jfieldID field_nativeRef { jniGetFieldID(clazz.get(), "nativeRef", "J") };
+	};
+	
+	template <class Ptr>
+	class Handle
+	{
+	public:
+		using CppType = Ptr;
+		using JniType = jobject;
+		
+		using Boxed = Handle;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const auto & data = JniClass<HandleClass>::get();
+			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+			const jlong handle = jniEnv->GetLongField(j, data.field_nativeRef);
+			DJINNI_ASSERT_MSG(handle, jniEnv, "Handle used after close()");
+			const auto & obj = *reinterpret_cast<const std::shared_ptr<void>*>(static_cast<uintptr_t>(handle));
+			return std::static_pointer_cast<typename CppType::element_type>(obj);
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			DJINNI_ASSERT_MSG(c, jniEnv, "null handle");
+			const auto & data = JniClass<HandleClass>::get();
+			// Owned by the Java object from here on, see Handle.close().
+			std::unique_ptr<std::shared_ptr<void>> handle(new std::shared_ptr<void>(c));
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor,
+				static_cast<jlong>(reinterpret_cast<uintptr_t>(handle.get()))));
+			jniExceptionCheck(jniEnv);
+			handle.release();
+			return j;
+		}
+	};
+	
+	/*
+	 * A direct java.nio.ByteBuffer that C++ writes into, see djinni_out_buffer.hpp. Its whole
+	 * capacity is used, starting at index 0; position and limit are left alone. Only passed
+	 * from Java into C++, so there is no fromCpp().
+	 */
+	struct OutBuffer
+	{
+		using CppType = ::djinni::out_buffer;
+		using JniType = jobject;
+		
+		using Boxed = OutBuffer;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			void* address = jniEnv->GetDirectBufferAddress(j);
+			const jlong capacity = jniEnv->GetDirectBufferCapacity(j);
+			DJINNI_ASSERT_MSG(capacity >= 0 && (address || capacity == 0), jniEnv,
+			                  "out_buffer must be a direct ByteBuffer");
+			return {static_cast<uint8_t*>(address), static_cast<size_t>(capacity)};
+		}
+	};
+	
 	struct Date
 	{
 		using CppType = std::chrono::system_clock::time_point;
@@ -217,25 +418,34 @@ namespace djinni
 		
 		static CppType toCpp(JNIEnv* jniEnv, JniType j)
 		{
-			static const auto POSIX_EPOCH = std::chrono::system_clock::from_time_t(0);
 			assert(j != nullptr);
 			const auto & data = JniClass<Date>::get();
 			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
-			auto time_millis = jniEnv->CallLongMethod(j, data.method_get_time);
-			return POSIX_EPOCH + std::chrono::milliseconds{time_millis};
+			return fromMillis(jniEnv->CallLongMethod(j, data.method_get_time));
 		}
 		
 		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
 		{
-			static const auto POSIX_EPOCH = std::chrono::system_clock::from_time_t(0);
 			const auto & data = JniClass<Date>::get();
-			const auto cpp_millis = std::chrono::duration_cast<std::chrono::milliseconds>(c - POSIX_EPOCH);
-			const jlong millis = static_cast<jlong>(cpp_millis.count());
-			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, millis));
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, toMillis(c)));
 			jniExceptionCheck(jniEnv);
 			return j;
 		}
 		
+		// Milliseconds since the epoch, as dates are passed with --jni-flatten-args.
+		static CppType fromMillis(jlong millis)
+		{
+			static const auto POSIX_EPOCH = std::chrono::system_clock::from_time_t(0);
+			return POSIX_EPOCH + std::chrono::milliseconds{millis};
+		}
+		
+		static jlong toMillis(const CppType& c)
+		{
+			static const auto POSIX_EPOCH = std::chrono::system_clock::from_time_t(0);
+			const auto cpp_millis = std::chrono::duration_cast<std::chrono::milliseconds>(c - POSIX_EPOCH);
+			return static_cast<jlong>(cpp_millis.count());
+		}
+		
 	private:
 		Date() = default;
 		friend ::djinni::JniClass<Date>;
@@ -264,6 +474,243 @@ namespace djinni
 		}
 	};
 	
+	/*
+	 * An optional primitive passed as a presence flag and a plain value, which is zero when the
+	 * flag is false, as done with --jni-unboxed-optionals. No boxed object is created or read.
+	 */
+	template <template <class> class OptionalType, class T>
+	struct UnboxedOptional
+	{
+		using CppType = OptionalType<typename T::CppType>;
+		using JniType = typename T::JniType;
+		
+		static CppType toCpp(JNIEnv* jniEnv, jboolean present, JniType j)
+		{
+			return present ? CppType(T::toCpp(jniEnv, j)) : CppType();
+		}
+		
+		static jboolean present(const CppType& c) noexcept { return c ? JNI_TRUE : JNI_FALSE; }
+		
+		static JniType fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			return c ? T::fromCpp(jniEnv, *c) : JniType();
+		}
+	};
+
+	struct ResultJniInfo
+	{
+		const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/Result") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(ZLjava/lang/Object;Ljava/lang/Object;)V") };
+		const jfieldID field_isOk { jniGetFieldID(clazz.get(), "mIsOk", "Z") };
+		const jfieldID field_value { jniGetFieldID(clazz.get(), "mValue", "Ljava/lang/Object;") };
+		const jfieldID field_error { jniGetFieldID(clazz.get(), "mError", "Ljava/lang/Object;") };
+	};
+
+	/*
+	 * Both alternatives are marshalled as plain (boxed) values and the error never takes the
+	 * exception path, so a failing call costs the same as a succeeding one.
+	 */
+	template <class T, class E>
+	class Result
+	{
+		using EValueJniType = typename T::Boxed::JniType;
+		using EErrorJniType = typename E::Boxed::JniType;
+
+	public:
+		using CppType = ::djinni::expected<typename T::CppType, typename E::CppType>;
+		using JniType = jobject;
+
+		using Boxed = Result;
+
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const auto& data = JniClass<ResultJniInfo>::get();
+			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+			if(jniEnv->GetBooleanField(j, data.field_isOk))
+			{
+				auto jValue = LocalRef<jobject>(jniEnv, jniEnv->GetObjectField(j, data.field_value));
+				jniExceptionCheck(jniEnv);
+				return CppType(T::Boxed::toCpp(jniEnv, static_cast<EValueJniType>(jValue.get())));
+			}
+			auto jError = LocalRef<jobject>(jniEnv, jniEnv->GetObjectField(j, data.field_error));
+			jniExceptionCheck(jniEnv);
+			return CppType(make_unexpected(E::Boxed::toCpp(jniEnv, static_cast<EErrorJniType>(jError.get()))));
+		}
+
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			const auto& data = JniClass<ResultJniInfo>::get();
+			if(c.has_value())
+			{
+				auto jValue = T::Boxed::fromCpp(jniEnv, *c);
+				auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, JNI_TRUE, get(jValue), nullptr));
+				jniExceptionCheck(jniEnv);
+				return j;
+			}
+			auto jError = E::Boxed::fromCpp(jniEnv, c.error());
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, JNI_FALSE, nullptr, get(jError)));
+			jniExceptionCheck(jniEnv);
+			return j;
+		}
+	};
+
+	/*
+	 * Interface marshallers can convert many objects at once (toCppBatch and fromCppBatch), taking
+	 * the proxy cache lock once and creating any new Java proxies with a single JNI call. The
+	 * collection marshallers pass their elements through ElementsToCpp and ElementsFromCpp, which
+	 * convert interfaces in batches and elements of any other type one at a time. Either way each
+	 * converted element is passed to `sink` in order.
+	 */
+	template <class T, class = void>
+	struct HasBatchConversion : std::false_type {};
+	template <class T>
+	struct HasBatchConversion<T, decltype(static_cast<void>(&T::Boxed::toCppBatch))> : std::true_type {};
+	
+	constexpr jint kElementBatchSize = 64;
+	
+	template <class T, bool = HasBatchConversion<T>::value>
+	class ElementsToCpp
+	{
+	public:
+		explicit ElementsToCpp(JNIEnv* jniEnv) : m_jniEnv(jniEnv) {}
+		
+		// Takes ownership of the local reference `j`.
+		template <class Sink>
+		void add(jobject j, Sink&& sink)
+		{
+			auto je = LocalRef<jobject>(m_jniEnv, j);
+			sink(T::Boxed::toCpp(m_jniEnv, static_cast<typename T::Boxed::JniType>(je.get())));
+		}
+		
+		template <class Sink>
+		void flush(Sink&&) {}
+		
+	private:
+		JNIEnv* const m_jniEnv;
+	};
+	
+	template <class T>
+	class ElementsToCpp<T, true>
+	{
+	public:
+		explicit ElementsToCpp(JNIEnv* jniEnv) : m_jniEnv(jniEnv)
+		{
+			// Room for the references held until the next flush.
+			jniEnv->EnsureLocalCapacity(kElementBatchSize);
+			jniExceptionCheck(jniEnv);
+		}
+		ElementsToCpp(const ElementsToCpp&) = delete;
+		ElementsToCpp& operator=(const ElementsToCpp&) = delete;
+		~ElementsToCpp()
+		{
+			deleteRefs();
+		}
+		
+		template <class Sink>
+		void add(jobject j, Sink&& sink)
+		{
+			m_j[m_count++] = j;
+			if(m_count == kElementBatchSize)
+			{
+				flush(sink);
+			}
+		}
+		
+		template <class Sink>
+		void flush(Sink&& sink)
+		{
+			const auto count = m_count;
+			T::Boxed::toCppBatch(m_jniEnv, m_j, static_cast<size_t>(count), m_c);
+			deleteRefs();
+			for(jint i = 0; i < count; ++i)
+			{
+				sink(std::move(m_c[i]));
+			}
+		}
+		
+	private:
+		void deleteRefs()
+		{
+			for(jint i = 0; i < m_count; ++i)
+			{
+				m_jniEnv->DeleteLocalRef(m_j[i]);
+			}
+			m_count = 0;
+		}
+		
+		JNIEnv* const m_jniEnv;
+		jobject m_j[kElementBatchSize];
+		typename T::CppType m_c[kElementBatchSize];
+		jint m_count = 0;
+	};
+	
+	template <class T, bool = HasBatchConversion<T>::value>
+	class ElementsFromCpp
+	{
+	public:
+		explicit ElementsFromCpp(JNIEnv* jniEnv) : m_jniEnv(jniEnv) {}
+		
+		// `sink` gets a reference that's only valid during the call.
+		template <class Sink>
+		void add(const typename T::CppType& c, Sink&& sink)
+		{
+			auto je = T::Boxed::fromCpp(m_jniEnv, c);
+			sink(get(je));
+		}
+		
+		template <class Sink>
+		void flush(Sink&&) {}
+		
+	private:
+		JNIEnv* const m_jniEnv;
+	};
+	
+	template <class T>
+	class ElementsFromCpp<T, true>
+	{
+	public:
+		explicit ElementsFromCpp(JNIEnv* jniEnv) : m_jniEnv(jniEnv)
+		{
+			jniEnv->EnsureLocalCapacity(kElementBatchSize);
+			jniExceptionCheck(jniEnv);
+		}
+		
+		template <class Sink>
+		void add(const typename T::CppType& c, Sink&& sink)
+		{
+			m_c[m_count++] = c;
+			if(m_count == kElementBatchSize)
+			{
+				flush(sink);
+			}
+		}
+		
+		template <class Sink>
+		void flush(Sink&& sink)
+		{
+			jobject j[kElementBatchSize];
+			const auto count = m_count;
+			m_count = 0;
+			T::Boxed::fromCppBatch(m_jniEnv, m_c, static_cast<size_t>(count), j);
+			LocalRef<jobject> refs[kElementBatchSize];
+			for(jint i = 0; i < count; ++i)
+			{
+				refs[i].reset(j[i]);
+				m_c[i] = nullptr;
+			}
+			for(jint i = 0; i < count; ++i)
+			{
+				sink(refs[i].get());
+			}
+		}
+		
+	private:
+		JNIEnv* const m_jniEnv;
+		typename T::CppType m_c[kElementBatchSize];
+		jint m_count = 0;
+	};
+	
 	struct ListJniInfo
 	{
 		const GlobalRef<jclass> clazz { jniFindClass("java/util/ArrayList") };
@@ -293,12 +740,15 @@ namespace djinni
 			auto size = jniEnv->CallIntMethod(j, data.method_size);
 			auto c = CppType();
 			c.reserve(size);
+			ElementsToCpp<T> elements(jniEnv);
+			auto sink = [&c] (ECppType&& ce) { c.push_back(std::move(ce)); };
 			for(jint i = 0; i < size; ++i)
 			{
 				auto je = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_get, i));
 				jniExceptionCheck(jniEnv);
-				c.push_back(T::Boxed::toCpp(jniEnv, static_cast<EJniType>(je.get())));
+				elements.add(je.release(), sink);
 			}
+			elements.flush(sink);
 			return c;
 		}
 		
@@ -309,16 +759,156 @@ namespace djinni
 			auto size = static_cast<jint>(c.size());
 			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
 			jniExceptionCheck(jniEnv);
+			ElementsFromCpp<T> elements(jniEnv);
+			auto sink = [jniEnv, &j, &data] (jobject je) {
+				jniEnv->CallBooleanMethod(j, data.method_add, je);
+				jniExceptionCheck(jniEnv);
+			};
 			for(const auto& ce : c)
 			{
-				auto je = T::Boxed::fromCpp(jniEnv, ce);
-				jniEnv->CallBooleanMethod(j, data.method_add, get(je));
+				elements.add(ce, sink);
+			}
+			elements.flush(sink);
+			return j;
+		}
+	};
+	
+	struct ListDeltaJniInfo
+	{
+		const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/ListDelta") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "()V") };
+		const jmethodID method_add { jniGetMethodID(clazz.get(), "add", "(IIILjava/util/ArrayList;)V") };
+		const jfieldID field_ops { jniGetFieldID(clazz.get(), "mOps", "Ljava/util/ArrayList;") };
+		const GlobalRef<jclass> opClazz { jniFindClass("com/dropbox/djinni/ListDelta$Op") };
+		const jfieldID field_opKind { jniGetFieldID(opClazz.get(), "mKind", "I") };
+		const jfieldID field_opIndex { jniGetFieldID(opClazz.get(), "mIndex", "I") };
+		const jfieldID field_opCount { jniGetFieldID(opClazz.get(), "mCount", "I") };
+		const jfieldID field_opValues { jniGetFieldID(opClazz.get(), "mValues", "Ljava/util/ArrayList;") };
+	};
+	
+	/*
+	 * Only the elements named by the ops cross the boundary, each through the List marshaller, so
+	 * the cost of a delta is independent of the size of the list it applies to.
+	 */
+	template <class T>
+	class ListDelta
+	{
+		using Op = typename ::djinni::list_delta<typename T::CppType>::op;
+		using Kind = typename ::djinni::list_delta<typename T::CppType>::kind;
+		
+	public:
+		using CppType = ::djinni::list_delta<typename T::CppType>;
+		using JniType = jobject;
+		
+		using Boxed = ListDelta;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const auto& data = JniClass<ListDeltaJniInfo>::get();
+			const auto& listData = JniClass<ListJniInfo>::get();
+			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+			auto jOps = LocalRef<jobject>(jniEnv, jniEnv->GetObjectField(j, data.field_ops));
+			jniExceptionCheck(jniEnv);
+			auto size = jniEnv->CallIntMethod(jOps.get(), listData.method_size);
+			jniExceptionCheck(jniEnv);
+			auto c = CppType();
+			for(jint i = 0; i < size; ++i)
+			{
+				auto jOp = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(jOps.get(), listData.method_get, i));
+				jniExceptionCheck(jniEnv);
+				auto jValues = LocalRef<jobject>(jniEnv, jniEnv->GetObjectField(jOp.get(), data.field_opValues));
+				jniExceptionCheck(jniEnv);
+				c.push_back(Op {
+					static_cast<Kind>(jniEnv->GetIntField(jOp.get(), data.field_opKind)),
+					static_cast<size_t>(jniEnv->GetIntField(jOp.get(), data.field_opIndex)),
+					static_cast<size_t>(jniEnv->GetIntField(jOp.get(), data.field_opCount)),
+					jValues.get() ? List<T>::toCpp(jniEnv, jValues.get()) : typename List<T>::CppType(),
+				});
+			}
+			return c;
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			const auto& data = JniClass<ListDeltaJniInfo>::get();
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor));
+			jniExceptionCheck(jniEnv);
+			for(const auto& op : c.ops())
+			{
+				assert(op.index <= std::numeric_limits<jint>::max() && op.count <= std::numeric_limits<jint>::max());
+				auto jValues = op.type == Kind::remove ? LocalRef<jobject>{} : List<T>::fromCpp(jniEnv, op.values);
+				jniEnv->CallVoidMethod(j, data.method_add, static_cast<jint>(op.type), static_cast<jint>(op.index),
+				                       static_cast<jint>(op.count), get(jValues));
 				jniExceptionCheck(jniEnv);
 			}
 			return j;
 		}
 	};
 	
+	template <class T> struct PrimitiveArray;
+	template <> struct PrimitiveArray<I8>
+	{
+		using JniType = jbyteArray;
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jbyte* out) { jniEnv->GetByteArrayRegion(j, 0, size, out); }
+	};
+	template <> struct PrimitiveArray<I16>
+	{
+		using JniType = jshortArray;
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jshort* out) { jniEnv->GetShortArrayRegion(j, 0, size, out); }
+	};
+	template <> struct PrimitiveArray<I32>
+	{
+		using JniType = jintArray;
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jint* out) { jniEnv->GetIntArrayRegion(j, 0, size, out); }
+	};
+	template <> struct PrimitiveArray<I64>
+	{
+		using JniType = jlongArray;
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jlong* out) { jniEnv->GetLongArrayRegion(j, 0, size, out); }
+	};
+	template <> struct PrimitiveArray<F32>
+	{
+		using JniType = jfloatArray;
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jfloat* out) { jniEnv->GetFloatArrayRegion(j, 0, size, out); }
+	};
+	template <> struct PrimitiveArray<F64>
+	{
+		using JniType = jdoubleArray;
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jdouble* out) { jniEnv->GetDoubleArrayRegion(j, 0, size, out); }
+	};
+	
+	/*
+	 * A list<T> parameter of primitive T with --cpp-span-params: a Java primitive array on one
+	 * side and a span<const T> on the other. The elements are copied with one region copy into
+	 * per-thread scratch memory, so steady-state calls allocate nothing. Pinning the array with
+	 * GetPrimitiveArrayCritical would save that copy, but the C++ implementation couldn't call
+	 * back into Java or block while it holds the span. Only passed from Java into C++.
+	 */
+	template <class T>
+	class PrimitiveSpan
+	{
+		using ECppType = typename T::CppType;
+		using EJniType = typename T::JniType;
+		static_assert(sizeof(ECppType) == sizeof(EJniType), "primitive layout differs between C++ and JNI");
+		
+	public:
+		using CppType = span<const ECppType>;
+		using JniType = typename PrimitiveArray<T>::JniType;
+		
+		using Boxed = PrimitiveSpan;
+		
+		static detail::borrowed_span<ECppType> toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const jsize size = jniEnv->GetArrayLength(j);
+			detail::scratch_buffer scratch(static_cast<size_t>(size) * sizeof(ECppType));
+			PrimitiveArray<T>::getRegion(jniEnv, j, size, static_cast<EJniType*>(scratch.data()));
+			jniExceptionCheck(jniEnv);
+			return {std::move(scratch), static_cast<size_t>(size)};
+		}
+	};
+	
 	struct IteratorJniInfo
 	{
 		const GlobalRef<jclass> clazz { jniFindClass("java/util/Iterator") };
@@ -355,12 +945,15 @@ namespace djinni
 			auto size = jniEnv->CallIntMethod(j, data.method_size);
 			auto c = CppType();
 			auto it = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_iterator));
+			ElementsToCpp<T> elements(jniEnv);
+			auto sink = [&c] (ECppType&& ce) { c.insert(std::move(ce)); };
 			for(jint i = 0; i < size; ++i)
 			{
 				auto je = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(it, iteData.method_next));
 				jniExceptionCheck(jniEnv);
-				c.insert(T::Boxed::toCpp(jniEnv, static_cast<EJniType>(je.get())));
+				elements.add(je.release(), sink);
 			}
+			elements.flush(sink);
 			return c;
 		}
 		
@@ -370,12 +963,16 @@ namespace djinni
 			const auto& data = JniClass<SetJniInfo>::get();
 			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor));
 			jniExceptionCheck(jniEnv);
+			ElementsFromCpp<T> elements(jniEnv);
+			auto sink = [jniEnv, &j, &data] (jobject je) {
+				jniEnv->CallBooleanMethod(j, data.method_add, je);
+				jniExceptionCheck(jniEnv);
+			};
 			for(const auto& ce : c)
 			{
-				auto je = T::fromCpp(jniEnv, ce);
-				jniEnv->CallBooleanMethod(j, data.method_add, get(je));
-				jniExceptionCheck(jniEnv);
+				elements.add(ce, sink);
 			}
+			elements.flush(sink);
 			return j;
 		}
 	};
@@ -429,15 +1026,28 @@ namespace djinni
 			auto c = CppType();
 			c.reserve(size);
 			auto it = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(entrySet, entrySetData.method_iterator));
+			// Values may be converted in batches, so keys wait here for theirs.
+			auto keys = std::vector<CppKeyType>();
+			size_t nextKey = 0;
+			ElementsToCpp<Value> values(jniEnv);
+			auto sink = [&c, &keys, &nextKey] (CppValueType&& cValue) {
+				c.emplace(std::move(keys[nextKey++]), std::move(cValue));
+				if(nextKey == keys.size())
+				{
+					keys.clear();
+					nextKey = 0;
+				}
+			};
 			for(jint i = 0; i < size; ++i)
 			{
 				auto je = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(it, iteData.method_next));
 				auto jKey = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(je, entryData.method_getKey));
 				auto jValue = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(je, entryData.method_getValue));
 				jniExceptionCheck(jniEnv);
-				c.emplace(Key::Boxed::toCpp(jniEnv, static_cast<JniKeyType>(jKey.get())),
-						  Value::Boxed::toCpp(jniEnv, static_cast<JniValueType>(jValue.get())));
+				keys.push_back(Key::Boxed::toCpp(jniEnv, static_cast<JniKeyType>(jKey.get())));
+				values.add(jValue.release(), sink);
 			}
+			values.flush(sink);
 			return c;
 		}
 		
@@ -448,13 +1058,26 @@ namespace djinni
 			auto size = c.size();
 			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
 			jniExceptionCheck(jniEnv);
+			// Values may be converted in batches, so keys are only converted once their value is.
+			auto keys = std::vector<const CppKeyType*>();
+			size_t nextKey = 0;
+			ElementsFromCpp<Value> values(jniEnv);
+			auto sink = [jniEnv, &j, &data, &keys, &nextKey] (jobject jValue) {
+				auto jKey = Key::Boxed::fromCpp(jniEnv, *keys[nextKey++]);
+				if(nextKey == keys.size())
+				{
+					keys.clear();
+					nextKey = 0;
+				}
+				jniEnv->CallObjectMethod(j, data.method_put, get(jKey), jValue);
+				jniExceptionCheck(jniEnv);
+			};
 			for(const auto& ce : c)
 			{
-				auto jKey = Key::Boxed::fromCpp(jniEnv, ce.first);
-				auto jValue = Value::Boxed::fromCpp(jniEnv, ce.second);
-				jniEnv->CallObjectMethod(j, data.method_put, get(jKey), get(jValue));
-				jniExceptionCheck(jniEnv);
+				keys.push_back(&ce.first);
+				values.add(ce.second, sink);
 			}
+			values.flush(sink);
 			return j;
 		}
 	};
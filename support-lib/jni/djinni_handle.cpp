@@ -0,0 +1,26 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Native methods of com.dropbox.djinni.Handle, see Handle in Marshal.hpp.
+
+#include "Marshal.hpp"
+#include <cstdint>
+#include <memory>
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_Handle_nativeDestroy(JNIEnv * /*env*/, jclass /*clazz*/, jlong nativeRef) {
+    assert(nativeRef);
+    delete reinterpret_cast<std::shared_ptr<void> *>(static_cast<uintptr_t>(nativeRef));
+}
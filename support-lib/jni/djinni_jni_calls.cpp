@@ -0,0 +1,439 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "djinni_jni_calls.hpp"
+#include "djinni_support.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace djinni {
+
+namespace {
+
+using JniFunctionTable = std::remove_const<std::remove_pointer<decltype(JNIEnv::functions)>::type>::type;
+
+struct ThreadState {
+    // The table this thread's JNIEnv had before we replaced it.
+    const JniFunctionTable * real = nullptr;
+    JniCallStats stats;
+    // Local reference count at each PushLocalFrame.
+    std::vector<int64_t> localFrames;
+};
+
+ThreadState & threadState() {
+    static thread_local ThreadState t;
+    return t;
+}
+
+std::atomic<int64_t> g_liveWeakGlobalRefs { 0 };
+
+#ifdef DJINNI_ENABLE_JNI_CALL_COUNTERS
+
+void addLocalRefs(JniCallStats & stats, int64_t delta) {
+    stats.localRefs += delta;
+    stats.localRefHighWater = std::max(stats.localRefHighWater, stats.localRefs);
+}
+
+class CallTimer {
+public:
+    explicit CallTimer(JniFunction f)
+        : m_stats(threadState().stats)
+        , m_index(static_cast<size_t>(f))
+        , m_start(std::chrono::steady_clock::now()) {}
+    ~CallTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_stats.calls[m_index] += 1;
+        m_stats.nanos[m_index] += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    JniCallStats & m_stats;
+    const size_t m_index;
+    const std::chrono::steady_clock::time_point m_start;
+};
+
+// Any object returned by a JNI function, other than the ones wrapped explicitly below, is a
+// new local reference.
+template <class R>
+typename std::enable_if<!std::is_convertible<R, jobject>::value>::type noteResult(R) {}
+
+template <class R>
+typename std::enable_if<std::is_convertible<R, jobject>::value>::type noteResult(R r) {
+    if (r) {
+        addLocalRefs(threadState().stats, 1);
+    }
+}
+
+template <class R>
+struct Invoke {
+    template <class F>
+    static R run(JniFunction id, F && f) {
+        R r;
+        {
+            CallTimer timer(id);
+            r = f();
+        }
+        noteResult(r);
+        return r;
+    }
+};
+
+template <>
+struct Invoke<void> {
+    template <class F>
+    static void run(JniFunction id, F && f) {
+        CallTimer timer(id);
+        f();
+    }
+};
+
+template <class Fn, Fn JniFunctionTable::* Member, JniFunction Id>
+struct Interceptor;
+
+template <class R, class... Args, R (JNICALL * JniFunctionTable::* Member)(JNIEnv *, Args...), JniFunction Id>
+struct Interceptor<R (JNICALL *)(JNIEnv *, Args...), Member, Id> {
+    static R JNICALL call(JNIEnv * env, Args... args) {
+        return Invoke<R>::run(Id, [&] { return (threadState().real->*Member)(env, args...); });
+    }
+};
+
+// Variadic functions forward to their "V" variant.
+template <class R, class Target, R (JNICALL * JniFunctionTable::* MemberV)(JNIEnv *, Target, jmethodID, va_list), JniFunction Id>
+R JNICALL callVariadic(JNIEnv * env, Target target, jmethodID method, ...) {
+    va_list args;
+    va_start(args, method);
+    struct End { va_list & args; ~End() { va_end(args); } } end { args };
+    return Invoke<R>::run(Id, [&] { return (threadState().real->*MemberV)(env, target, method, args); });
+}
+
+template <class R, R (JNICALL * JniFunctionTable::* MemberV)(JNIEnv *, jobject, jclass, jmethodID, va_list), JniFunction Id>
+R JNICALL callNonvirtualVariadic(JNIEnv * env, jobject obj, jclass clazz, jmethodID method, ...) {
+    va_list args;
+    va_start(args, method);
+    struct End { va_list & args; ~End() { va_end(args); } } end { args };
+    return Invoke<R>::run(Id, [&] { return (threadState().real->*MemberV)(env, obj, clazz, method, args); });
+}
+
+// Functions which create or destroy references other than plain local refs.
+
+jobject JNICALL newGlobalRef(JNIEnv * env, jobject obj) {
+    jobject r;
+    {
+        CallTimer timer(JniFunction::NewGlobalRef);
+        r = threadState().real->NewGlobalRef(env, obj);
+    }
+    if (r) {
+        threadState().stats.globalRefsCreated += 1;
+    }
+    return r;
+}
+
+void JNICALL deleteGlobalRef(JNIEnv * env, jobject obj) {
+    {
+        CallTimer timer(JniFunction::DeleteGlobalRef);
+        threadState().real->DeleteGlobalRef(env, obj);
+    }
+    if (obj) {
+        threadState().stats.globalRefsDeleted += 1;
+    }
+}
+
+jweak JNICALL newWeakGlobalRef(JNIEnv * env, jobject obj) {
+    jweak r;
+    {
+        CallTimer timer(JniFunction::NewWeakGlobalRef);
+        r = threadState().real->NewWeakGlobalRef(env, obj);
+    }
+    if (r) {
+        threadState().stats.weakGlobalRefsCreated += 1;
+        g_liveWeakGlobalRefs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return r;
+}
+
+void JNICALL deleteWeakGlobalRef(JNIEnv * env, jweak obj) {
+    {
+        CallTimer timer(JniFunction::DeleteWeakGlobalRef);
+        threadState().real->DeleteWeakGlobalRef(env, obj);
+    }
+    if (obj) {
+        threadState().stats.weakGlobalRefsDeleted += 1;
+        g_liveWeakGlobalRefs.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void JNICALL deleteLocalRef(JNIEnv * env, jobject obj) {
+    {
+        CallTimer timer(JniFunction::DeleteLocalRef);
+        threadState().real->DeleteLocalRef(env, obj);
+    }
+    if (obj) {
+        addLocalRefs(threadState().stats, -1);
+    }
+}
+
+jint JNICALL pushLocalFrame(JNIEnv * env, jint capacity) {
+    jint r;
+    {
+        CallTimer timer(JniFunction::PushLocalFrame);
+        r = threadState().real->PushLocalFrame(env, capacity);
+    }
+    if (r == 0) {
+        auto & t = threadState();
+        t.localFrames.push_back(t.stats.localRefs);
+    }
+    return r;
+}
+
+jobject JNICALL popLocalFrame(JNIEnv * env, jobject result) {
+    jobject r;
+    {
+        CallTimer timer(JniFunction::PopLocalFrame);
+        r = threadState().real->PopLocalFrame(env, result);
+    }
+    auto & t = threadState();
+    if (!t.localFrames.empty()) {
+        t.stats.localRefs = t.localFrames.back();
+        t.localFrames.pop_back();
+    }
+    // The result survives as a new local ref in the enclosing frame.
+    if (r) {
+        addLocalRefs(t.stats, 1);
+    }
+    return r;
+}
+
+#define DJINNI_JNI_INSTALL_PLAIN_(name_) \
+    table.name_ = &Interceptor<decltype(table.name_), &JniFunctionTable::name_, JniFunction::name_>::call;
+#define DJINNI_JNI_INSTALL_VARIADIC_(name_)
+#define DJINNI_JNI_INSTALL_(name_, kind_) DJINNI_JNI_INSTALL_##kind_##_(name_)
+
+#define DJINNI_JNI_INSTALL_CALLS_(type_, ret_) \
+    table.Call##type_##Method = &callVariadic<ret_, jobject, \
+        &JniFunctionTable::Call##type_##MethodV, JniFunction::Call##type_##Method>; \
+    table.CallNonvirtual##type_##Method = &callNonvirtualVariadic<ret_, \
+        &JniFunctionTable::CallNonvirtual##type_##MethodV, JniFunction::CallNonvirtual##type_##Method>; \
+    table.CallStatic##type_##Method = &callVariadic<ret_, jclass, \
+        &JniFunctionTable::CallStatic##type_##MethodV, JniFunction::CallStatic##type_##Method>;
+
+const JniFunctionTable & interceptTable(const JniFunctionTable & real) {
+    static JniFunctionTable table;
+    static std::once_flag once;
+    std::call_once(once, [&] {
+        // Start from a copy so reserved and newer (post-1.6) entries are passed through.
+        table = real;
+        DJINNI_JNI_FUNCTIONS(DJINNI_JNI_INSTALL_)
+        table.NewObject = &callVariadic<jobject, jclass, &JniFunctionTable::NewObjectV, JniFunction::NewObject>;
+        DJINNI_JNI_INSTALL_CALLS_(Object, jobject)
+        DJINNI_JNI_INSTALL_CALLS_(Boolean, jboolean)
+        DJINNI_JNI_INSTALL_CALLS_(Byte, jbyte)
+        DJINNI_JNI_INSTALL_CALLS_(Char, jchar)
+        DJINNI_JNI_INSTALL_CALLS_(Short, jshort)
+        DJINNI_JNI_INSTALL_CALLS_(Int, jint)
+        DJINNI_JNI_INSTALL_CALLS_(Long, jlong)
+        DJINNI_JNI_INSTALL_CALLS_(Float, jfloat)
+        DJINNI_JNI_INSTALL_CALLS_(Double, jdouble)
+        DJINNI_JNI_INSTALL_CALLS_(Void, void)
+        table.NewGlobalRef = &newGlobalRef;
+        table.DeleteGlobalRef = &deleteGlobalRef;
+        table.NewWeakGlobalRef = &newWeakGlobalRef;
+        table.DeleteWeakGlobalRef = &deleteWeakGlobalRef;
+        table.DeleteLocalRef = &deleteLocalRef;
+        table.PushLocalFrame = &pushLocalFrame;
+        table.PopLocalFrame = &popLocalFrame;
+    });
+    return table;
+}
+
+#undef DJINNI_JNI_INSTALL_PLAIN_
+#undef DJINNI_JNI_INSTALL_VARIADIC_
+#undef DJINNI_JNI_INSTALL_
+#undef DJINNI_JNI_INSTALL_CALLS_
+
+#endif // DJINNI_ENABLE_JNI_CALL_COUNTERS
+
+} // namespace
+
+const char * jniFunctionName(JniFunction f) noexcept {
+    static const char * const names[] = {
+#define DJINNI_JNI_FUNCTION_NAME_(name_, kind_) #name_,
+        DJINNI_JNI_FUNCTIONS(DJINNI_JNI_FUNCTION_NAME_)
+#undef DJINNI_JNI_FUNCTION_NAME_
+    };
+    static_assert(sizeof(names) / sizeof(names[0]) == kJniFunctionCount, "JNI function list out of sync");
+    return names[static_cast<size_t>(f)];
+}
+
+uint64_t JniCallStats::totalCalls() const noexcept {
+    uint64_t total = 0;
+    for (const auto c : calls) {
+        total += c;
+    }
+    return total;
+}
+
+uint64_t JniCallStats::totalNanos() const noexcept {
+    uint64_t total = 0;
+    for (const auto n : nanos) {
+        total += n;
+    }
+    return total;
+}
+
+std::string JniCallStats::report() const {
+    std::vector<size_t> called;
+    for (size_t i = 0; i < kJniFunctionCount; ++i) {
+        if (calls[i]) {
+            called.push_back(i);
+        }
+    }
+    std::stable_sort(called.begin(), called.end(), [this] (size_t a, size_t b) {
+        return calls[a] > calls[b];
+    });
+    std::string out;
+    for (const size_t i : called) {
+        out += jniFunctionName(static_cast<JniFunction>(i));
+        out += ": ";
+        out += std::to_string(calls[i]);
+        out += " calls, ";
+        out += std::to_string(nanos[i]);
+        out += " ns\n";
+    }
+    return out;
+}
+
+bool jniCallCountersEnabled() noexcept {
+#ifdef DJINNI_ENABLE_JNI_CALL_COUNTERS
+    return true;
+#else
+    return false;
+#endif
+}
+
+JniCallStats jniThreadCallStats() {
+    return threadState().stats;
+}
+
+void jniResetThreadLocalRefHighWater() noexcept {
+    auto & stats = threadState().stats;
+    stats.localRefHighWater = stats.localRefs;
+}
+
+int64_t jniLiveGlobalRefs() noexcept {
+    return static_cast<int64_t>(detail::g_liveGlobalRefs.load(std::memory_order_relaxed));
+}
+
+int64_t jniLiveWeakGlobalRefs() noexcept {
+    return g_liveWeakGlobalRefs.load(std::memory_order_relaxed);
+}
+
+JniCallCounter::JniCallCounter()
+    : m_start(threadState().stats)
+    , m_outerHighWater(m_start.localRefHighWater)
+{
+    auto & stats = threadState().stats;
+    stats.localRefHighWater = stats.localRefs;
+}
+
+JniCallCounter::~JniCallCounter() {
+    auto & stats = threadState().stats;
+    stats.localRefHighWater = std::max(stats.localRefHighWater, m_outerHighWater);
+}
+
+JniCallStats JniCallCounter::stats() const {
+    const auto & now = threadState().stats;
+    JniCallStats delta;
+    for (size_t i = 0; i < kJniFunctionCount; ++i) {
+        delta.calls[i] = now.calls[i] - m_start.calls[i];
+        delta.nanos[i] = now.nanos[i] - m_start.nanos[i];
+    }
+    delta.localRefs = now.localRefs - m_start.localRefs;
+    delta.localRefHighWater = now.localRefHighWater - m_start.localRefs;
+    delta.globalRefsCreated = now.globalRefsCreated - m_start.globalRefsCreated;
+    delta.globalRefsDeleted = now.globalRefsDeleted - m_start.globalRefsDeleted;
+    delta.weakGlobalRefsCreated = now.weakGlobalRefsCreated - m_start.weakGlobalRefsCreated;
+    delta.weakGlobalRefsDeleted = now.weakGlobalRefsDeleted - m_start.weakGlobalRefsDeleted;
+    return delta;
+}
+
+void jniInterceptEnv(JNIEnv * env) noexcept {
+#ifdef DJINNI_ENABLE_JNI_CALL_COUNTERS
+    const JniFunctionTable * current = env->functions;
+    const JniFunctionTable & table = interceptTable(*current);
+    if (current != &table) {
+        threadState().real = current;
+        env->functions = &table;
+    }
+#else
+    (void)env;
+#endif
+}
+
+JniNativeFrame::JniNativeFrame(JNIEnv * env) noexcept
+    : m_localRefs((jniInterceptEnv(env), threadState().stats.localRefs)) {}
+
+JniNativeFrame::~JniNativeFrame() {
+    threadState().stats.localRefs = m_localRefs;
+}
+
+} // namespace djinni
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_JniCallCounters_isEnabled(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return ::djinni::jniCallCountersEnabled() ? JNI_TRUE : JNI_FALSE;
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_JniCallCounters_threadCalls(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return static_cast<jlong>(::djinni::jniThreadCallStats().totalCalls());
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_JniCallCounters_threadCallsTo(JNIEnv * env, jclass /*clazz*/, jstring j_function) {
+    try {
+        // Read the name before the stats so these calls aren't part of the answer.
+        const auto name = ::djinni::jniUTF8FromString(env, j_function);
+        const auto stats = ::djinni::jniThreadCallStats();
+        for (size_t i = 0; i < ::djinni::kJniFunctionCount; ++i) {
+            if (name == ::djinni::jniFunctionName(static_cast<::djinni::JniFunction>(i))) {
+                return static_cast<jlong>(stats.calls[i]);
+            }
+        }
+        throw std::invalid_argument("not a JNI function: " + name);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, 0)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_JniCallCounters_threadLocalRefHighWater(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return static_cast<jlong>(::djinni::jniThreadCallStats().localRefHighWater);
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_JniCallCounters_resetThreadLocalRefHighWater(JNIEnv * /*env*/, jclass /*clazz*/) {
+    ::djinni::jniResetThreadLocalRefHighWater();
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_JniCallCounters_liveGlobalRefs(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return static_cast<jlong>(::djinni::jniLiveGlobalRefs());
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_JniCallCounters_threadReport(JNIEnv * env, jclass /*clazz*/) {
+    try {
+        return ::djinni::jniStringFromUTF8(env, ::djinni::jniThreadCallStats().report());
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, nullptr)
+}
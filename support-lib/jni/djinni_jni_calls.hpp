@@ -0,0 +1,378 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <jni.h>
+
+namespace djinni {
+
+/*
+ * Debug-only accounting of the JNI functions called by djinni.
+ *
+ * If DJINNI_ENABLE_JNI_CALL_COUNTERS is defined when building the support library and the
+ * generated code, djinni replaces the function table of every JNIEnv it sees (in generated entry
+ * points and in jniGetThreadEnv) with wrappers which count and time each call before forwarding
+ * it to the JVM. This is meant for tests and profiling builds, never for production.
+ *
+ * Counters are kept per thread and only written by their own thread, so they're cheap and a
+ * JniCallCounter measures exactly the JNI work done by the code in its scope. Global reference
+ * counts are process-wide.
+ *
+ * Note that the C++ JNIEnv methods implement variadic calls such as CallObjectMethod() by
+ * calling the "V" variant (CallObjectMethodV), so that's the name they're counted under.
+ */
+
+// X(function name, PLAIN or VARIADIC) for every JNI 1.6 function
+#define DJINNI_JNI_FUNCTIONS(X) \
+    X(GetVersion, PLAIN) \
+    X(DefineClass, PLAIN) \
+    X(FindClass, PLAIN) \
+    X(FromReflectedMethod, PLAIN) \
+    X(FromReflectedField, PLAIN) \
+    X(ToReflectedMethod, PLAIN) \
+    X(GetSuperclass, PLAIN) \
+    X(IsAssignableFrom, PLAIN) \
+    X(ToReflectedField, PLAIN) \
+    X(Throw, PLAIN) \
+    X(ThrowNew, PLAIN) \
+    X(ExceptionOccurred, PLAIN) \
+    X(ExceptionDescribe, PLAIN) \
+    X(ExceptionClear, PLAIN) \
+    X(FatalError, PLAIN) \
+    X(PushLocalFrame, PLAIN) \
+    X(PopLocalFrame, PLAIN) \
+    X(NewGlobalRef, PLAIN) \
+    X(DeleteGlobalRef, PLAIN) \
+    X(DeleteLocalRef, PLAIN) \
+    X(IsSameObject, PLAIN) \
+    X(NewLocalRef, PLAIN) \
+    X(EnsureLocalCapacity, PLAIN) \
+    X(AllocObject, PLAIN) \
+    X(NewObject, VARIADIC) \
+    X(NewObjectV, PLAIN) \
+    X(NewObjectA, PLAIN) \
+    X(GetObjectClass, PLAIN) \
+    X(IsInstanceOf, PLAIN) \
+    X(GetMethodID, PLAIN) \
+    X(CallObjectMethod, VARIADIC) \
+    X(CallObjectMethodV, PLAIN) \
+    X(CallObjectMethodA, PLAIN) \
+    X(CallBooleanMethod, VARIADIC) \
+    X(CallBooleanMethodV, PLAIN) \
+    X(CallBooleanMethodA, PLAIN) \
+    X(CallByteMethod, VARIADIC) \
+    X(CallByteMethodV, PLAIN) \
+    X(CallByteMethodA, PLAIN) \
+    X(CallCharMethod, VARIADIC) \
+    X(CallCharMethodV, PLAIN) \
+    X(CallCharMethodA, PLAIN) \
+    X(CallShortMethod, VARIADIC) \
+    X(CallShortMethodV, PLAIN) \
+    X(CallShortMethodA, PLAIN) \
+    X(CallIntMethod, VARIADIC) \
+    X(CallIntMethodV, PLAIN) \
+    X(CallIntMethodA, PLAIN) \
+    X(CallLongMethod, VARIADIC) \
+    X(CallLongMethodV, PLAIN) \
+    X(CallLongMethodA, PLAIN) \
+    X(CallFloatMethod, VARIADIC) \
+    X(CallFloatMethodV, PLAIN) \
+    X(CallFloatMethodA, PLAIN) \
+    X(CallDoubleMethod, VARIADIC) \
+    X(CallDoubleMethodV, PLAIN) \
+    X(CallDoubleMethodA, PLAIN) \
+    X(CallVoidMethod, VARIADIC) \
+    X(CallVoidMethodV, PLAIN) \
+    X(CallVoidMethodA, PLAIN) \
+    X(CallNonvirtualObjectMethod, VARIADIC) \
+    X(CallNonvirtualObjectMethodV, PLAIN) \
+    X(CallNonvirtualObjectMethodA, PLAIN) \
+    X(CallNonvirtualBooleanMethod, VARIADIC) \
+    X(CallNonvirtualBooleanMethodV, PLAIN) \
+    X(CallNonvirtualBooleanMethodA, PLAIN) \
+    X(CallNonvirtualByteMethod, VARIADIC) \
+    X(CallNonvirtualByteMethodV, PLAIN) \
+    X(CallNonvirtualByteMethodA, PLAIN) \
+    X(CallNonvirtualCharMethod, VARIADIC) \
+    X(CallNonvirtualCharMethodV, PLAIN) \
+    X(CallNonvirtualCharMethodA, PLAIN) \
+    X(CallNonvirtualShortMethod, VARIADIC) \
+    X(CallNonvirtualShortMethodV, PLAIN) \
+    X(CallNonvirtualShortMethodA, PLAIN) \
+    X(CallNonvirtualIntMethod, VARIADIC) \
+    X(CallNonvirtualIntMethodV, PLAIN) \
+    X(CallNonvirtualIntMethodA, PLAIN) \
+    X(CallNonvirtualLongMethod, VARIADIC) \
+    X(CallNonvirtualLongMethodV, PLAIN) \
+    X(CallNonvirtualLongMethodA, PLAIN) \
+    X(CallNonvirtualFloatMethod, VARIADIC) \
+    X(CallNonvirtualFloatMethodV, PLAIN) \
+    X(CallNonvirtualFloatMethodA, PLAIN) \
+    X(CallNonvirtualDoubleMethod, VARIADIC) \
+    X(CallNonvirtualDoubleMethodV, PLAIN) \
+    X(CallNonvirtualDoubleMethodA, PLAIN) \
+    X(CallNonvirtualVoidMethod, VARIADIC) \
+    X(CallNonvirtualVoidMethodV, PLAIN) \
+    X(CallNonvirtualVoidMethodA, PLAIN) \
+    X(GetFieldID, PLAIN) \
+    X(GetObjectField, PLAIN) \
+    X(GetBooleanField, PLAIN) \
+    X(GetByteField, PLAIN) \
+    X(GetCharField, PLAIN) \
+    X(GetShortField, PLAIN) \
+    X(GetIntField, PLAIN) \
+    X(GetLongField, PLAIN) \
+    X(GetFloatField, PLAIN) \
+    X(GetDoubleField, PLAIN) \
+    X(SetObjectField, PLAIN) \
+    X(SetBooleanField, PLAIN) \
+    X(SetByteField, PLAIN) \
+    X(SetCharField, PLAIN) \
+    X(SetShortField, PLAIN) \
+    X(SetIntField, PLAIN) \
+    X(SetLongField, PLAIN) \
+    X(SetFloatField, PLAIN) \
+    X(SetDoubleField, PLAIN) \
+    X(GetStaticMethodID, PLAIN) \
+    X(CallStaticObjectMethod, VARIADIC) \
+    X(CallStaticObjectMethodV, PLAIN) \
+    X(CallStaticObjectMethodA, PLAIN) \
+    X(CallStaticBooleanMethod, VARIADIC) \
+    X(CallStaticBooleanMethodV, PLAIN) \
+    X(CallStaticBooleanMethodA, PLAIN) \
+    X(CallStaticByteMethod, VARIADIC) \
+    X(CallStaticByteMethodV, PLAIN) \
+    X(CallStaticByteMethodA, PLAIN) \
+    X(CallStaticCharMethod, VARIADIC) \
+    X(CallStaticCharMethodV, PLAIN) \
+    X(CallStaticCharMethodA, PLAIN) \
+    X(CallStaticShortMethod, VARIADIC) \
+    X(CallStaticShortMethodV, PLAIN) \
+    X(CallStaticShortMethodA, PLAIN) \
+    X(CallStaticIntMethod, VARIADIC) \
+    X(CallStaticIntMethodV, PLAIN) \
+    X(CallStaticIntMethodA, PLAIN) \
+    X(CallStaticLongMethod, VARIADIC) \
+    X(CallStaticLongMethodV, PLAIN) \
+    X(CallStaticLongMethodA, PLAIN) \
+    X(CallStaticFloatMethod, VARIADIC) \
+    X(CallStaticFloatMethodV, PLAIN) \
+    X(CallStaticFloatMethodA, PLAIN) \
+    X(CallStaticDoubleMethod, VARIADIC) \
+    X(CallStaticDoubleMethodV, PLAIN) \
+    X(CallStaticDoubleMethodA, PLAIN) \
+    X(CallStaticVoidMethod, VARIADIC) \
+    X(CallStaticVoidMethodV, PLAIN) \
+    X(CallStaticVoidMethodA, PLAIN) \
+    X(GetStaticFieldID, PLAIN) \
+    X(GetStaticObjectField, PLAIN) \
+    X(SetStaticObjectField, PLAIN) \
+    X(GetStaticBooleanField, PLAIN) \
+    X(SetStaticBooleanField, PLAIN) \
+    X(GetStaticByteField, PLAIN) \
+    X(SetStaticByteField, PLAIN) \
+    X(GetStaticCharField, PLAIN) \
+    X(SetStaticCharField, PLAIN) \
+    X(GetStaticShortField, PLAIN) \
+    X(SetStaticShortField, PLAIN) \
+    X(GetStaticIntField, PLAIN) \
+    X(SetStaticIntField, PLAIN) \
+    X(GetStaticLongField, PLAIN) \
+    X(SetStaticLongField, PLAIN) \
+    X(GetStaticFloatField, PLAIN) \
+    X(SetStaticFloatField, PLAIN) \
+    X(GetStaticDoubleField, PLAIN) \
+    X(SetStaticDoubleField, PLAIN) \
+    X(NewString, PLAIN) \
+    X(GetStringLength, PLAIN) \
+    X(GetStringChars, PLAIN) \
+    X(ReleaseStringChars, PLAIN) \
+    X(NewStringUTF, PLAIN) \
+    X(GetStringUTFLength, PLAIN) \
+    X(GetStringUTFChars, PLAIN) \
+    X(ReleaseStringUTFChars, PLAIN) \
+    X(GetArrayLength, PLAIN) \
+    X(NewObjectArray, PLAIN) \
+    X(GetObjectArrayElement, PLAIN) \
+    X(SetObjectArrayElement, PLAIN) \
+    X(NewBooleanArray, PLAIN) \
+    X(NewByteArray, PLAIN) \
+    X(NewCharArray, PLAIN) \
+    X(NewShortArray, PLAIN) \
+    X(NewIntArray, PLAIN) \
+    X(NewLongArray, PLAIN) \
+    X(NewFloatArray, PLAIN) \
+    X(NewDoubleArray, PLAIN) \
+    X(GetBooleanArrayElements, PLAIN) \
+    X(GetByteArrayElements, PLAIN) \
+    X(GetCharArrayElements, PLAIN) \
+    X(GetShortArrayElements, PLAIN) \
+    X(GetIntArrayElements, PLAIN) \
+    X(GetLongArrayElements, PLAIN) \
+    X(GetFloatArrayElements, PLAIN) \
+    X(GetDoubleArrayElements, PLAIN) \
+    X(ReleaseBooleanArrayElements, PLAIN) \
+    X(ReleaseByteArrayElements, PLAIN) \
+    X(ReleaseCharArrayElements, PLAIN) \
+    X(ReleaseShortArrayElements, PLAIN) \
+    X(ReleaseIntArrayElements, PLAIN) \
+    X(ReleaseLongArrayElements, PLAIN) \
+    X(ReleaseFloatArrayElements, PLAIN) \
+    X(ReleaseDoubleArrayElements, PLAIN) \
+    X(GetBooleanArrayRegion, PLAIN) \
+    X(GetByteArrayRegion, PLAIN) \
+    X(GetCharArrayRegion, PLAIN) \
+    X(GetShortArrayRegion, PLAIN) \
+    X(GetIntArrayRegion, PLAIN) \
+    X(GetLongArrayRegion, PLAIN) \
+    X(GetFloatArrayRegion, PLAIN) \
+    X(GetDoubleArrayRegion, PLAIN) \
+    X(SetBooleanArrayRegion, PLAIN) \
+    X(SetByteArrayRegion, PLAIN) \
+    X(SetCharArrayRegion, PLAIN) \
+    X(SetShortArrayRegion, PLAIN) \
+    X(SetIntArrayRegion, PLAIN) \
+    X(SetLongArrayRegion, PLAIN) \
+    X(SetFloatArrayRegion, PLAIN) \
+    X(SetDoubleArrayRegion, PLAIN) \
+    X(RegisterNatives, PLAIN) \
+    X(UnregisterNatives, PLAIN) \
+    X(MonitorEnter, PLAIN) \
+    X(MonitorExit, PLAIN) \
+    X(GetJavaVM, PLAIN) \
+    X(GetStringRegion, PLAIN) \
+    X(GetStringUTFRegion, PLAIN) \
+    X(GetPrimitiveArrayCritical, PLAIN) \
+    X(ReleasePrimitiveArrayCritical, PLAIN) \
+    X(GetStringCritical, PLAIN) \
+    X(ReleaseStringCritical, PLAIN) \
+    X(NewWeakGlobalRef, PLAIN) \
+    X(DeleteWeakGlobalRef, PLAIN) \
+    X(ExceptionCheck, PLAIN) \
+    X(NewDirectByteBuffer, PLAIN) \
+    X(GetDirectBufferAddress, PLAIN) \
+    X(GetDirectBufferCapacity, PLAIN) \
+    X(GetObjectRefType, PLAIN)
+
+enum class JniFunction : uint16_t {
+#define DJINNI_JNI_FUNCTION_ENUM_(name_, kind_) name_,
+    DJINNI_JNI_FUNCTIONS(DJINNI_JNI_FUNCTION_ENUM_)
+#undef DJINNI_JNI_FUNCTION_ENUM_
+};
+
+constexpr size_t kJniFunctionCount = static_cast<size_t>(JniFunction::GetObjectRefType) + 1;
+
+const char * jniFunctionName(JniFunction f) noexcept;
+
+struct JniCallStats {
+    std::array<uint64_t, kJniFunctionCount> calls {};
+    std::array<uint64_t, kJniFunctionCount> nanos {};
+    // Net local references created, and the most that were alive at once.
+    int64_t localRefs = 0;
+    int64_t localRefHighWater = 0;
+    uint64_t globalRefsCreated = 0;
+    uint64_t globalRefsDeleted = 0;
+    uint64_t weakGlobalRefsCreated = 0;
+    uint64_t weakGlobalRefsDeleted = 0;
+
+    uint64_t totalCalls() const noexcept;
+    uint64_t totalNanos() const noexcept;
+    uint64_t callsTo(JniFunction f) const noexcept { return calls[static_cast<size_t>(f)]; }
+
+    // One line per JNI function called, most called first.
+    std::string report() const;
+};
+
+/*
+ * Whether this build of the support library intercepts JNI calls.
+ */
+bool jniCallCountersEnabled() noexcept;
+
+/*
+ * Everything counted on the calling thread since it first entered djinni. The local
+ * reference counts are relative to the outermost djinni entry point on the stack.
+ */
+JniCallStats jniThreadCallStats();
+
+/*
+ * Restart tracking the calling thread's local reference high-water mark from its current count.
+ */
+void jniResetThreadLocalRefHighWater() noexcept;
+
+/*
+ * Global references held by djinni right now, across all threads. This is the same counter
+ * JniRefStats reports, so it's kept whether or not call counters are compiled in.
+ */
+int64_t jniLiveGlobalRefs() noexcept;
+
+/*
+ * Weak global references alive right now, across all threads, as counted since the
+ * interception was first installed.
+ */
+int64_t jniLiveWeakGlobalRefs() noexcept;
+
+/*
+ * Counts the JNI work done on the current thread during its lifetime, e.g. to assert that
+ * marshalling a value stays within a budget of JNI calls:
+ *
+ *     djinni::JniCallCounter counter;
+ *     auto j = NativeFoo::fromCpp(env, foo);
+ *     assert(counter.stats().totalCalls() <= 12);
+ *
+ * Counters may be nested.
+ */
+class JniCallCounter {
+public:
+    JniCallCounter();
+    ~JniCallCounter();
+    JniCallCounter(const JniCallCounter &) = delete;
+    JniCallCounter & operator=(const JniCallCounter &) = delete;
+
+    // Calls made so far in this scope. localRefHighWater is relative to the scope's start.
+    JniCallStats stats() const;
+
+private:
+    const JniCallStats m_start;
+    const int64_t m_outerHighWater;
+};
+
+/*
+ * Installs the interception on env if needed. A no-op unless counters are enabled.
+ */
+void jniInterceptEnv(JNIEnv * env) noexcept;
+
+/*
+ * Placed by generated code at each Java-to-C++ entry point. The JVM frees the local references
+ * created by a native method when it returns, so this rewinds the local reference count to
+ * where it was on entry.
+ */
+class JniNativeFrame {
+public:
+    explicit JniNativeFrame(JNIEnv * env) noexcept;
+    ~JniNativeFrame();
+    JniNativeFrame(const JniNativeFrame &) = delete;
+    JniNativeFrame & operator=(const JniNativeFrame &) = delete;
+
+private:
+    const int64_t m_localRefs;
+};
+
+} // namespace djinni
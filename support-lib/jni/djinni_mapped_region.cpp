@@ -0,0 +1,61 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+// Native methods of com.dropbox.djinni.MappedRegion, see MappedRegion in Marshal.hpp.
+
+#include "Marshal.hpp"
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+using Handle = ::djinni::MappedRegion::CppType;
+
+const Handle & handleFromAddress(jlong nativeRef) {
+    assert(nativeRef);
+    return *reinterpret_cast<const Handle *>(static_cast<uintptr_t>(nativeRef));
+}
+
+} // namespace
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_MappedRegion_nativeMap(JNIEnv * env, jclass /*clazz*/,
+                                                                       jstring path, jlong offset, jlong length) {
+    try {
+        DJINNI_ASSERT_MSG(path, env, "MappedRegion.map(null, ...)");
+        DJINNI_ASSERT_MSG(offset >= 0 && length >= 0, env, "MappedRegion.map: negative offset or length");
+        std::unique_ptr<Handle> handle(new Handle(Handle::map_file(
+            ::djinni::jniUTF8FromString(env, path), static_cast<uint64_t>(offset), static_cast<size_t>(length))));
+        return static_cast<jlong>(reinterpret_cast<uintptr_t>(handle.release()));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, 0)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_MappedRegion_nativeSize(JNIEnv * /*env*/, jclass /*clazz*/, jlong nativeRef) {
+    return static_cast<jlong>(handleFromAddress(nativeRef).size());
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_MappedRegion_nativeView(JNIEnv * env, jclass /*clazz*/, jlong nativeRef) {
+    const auto & region = handleFromAddress(nativeRef);
+    if (region.empty()) {
+        return nullptr;
+    }
+    // Direct buffers are writable; the Java side hands out a read-only view only.
+    return env->NewDirectByteBuffer(const_cast<uint8_t *>(region.data()), static_cast<jlong>(region.size()));
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_MappedRegion_nativeDestroy(JNIEnv * /*env*/, jclass /*clazz*/, jlong nativeRef) {
+    delete &handleFromAddress(nativeRef);
+}
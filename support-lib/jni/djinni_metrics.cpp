@@ -0,0 +1,218 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "djinni_metrics.hpp"
+#include "djinni_support.hpp"
+#include <cstdlib>
+#include <cstring>
+
+namespace djinni {
+
+// Intrusive list of every CallMetrics which has been called. Entries are function-local
+// statics in generated code, so they are never removed.
+static std::atomic<CallMetrics *> g_firstCallMetrics { nullptr };
+
+std::string javaNameFromJniSymbol(const char * symbol) {
+    static const char prefix[] = "Java_";
+    if (std::strncmp(symbol, prefix, sizeof(prefix) - 1) != 0) {
+        return symbol;
+    }
+
+    std::string name;
+    for (const char * p = symbol + sizeof(prefix) - 1; *p; ++p) {
+        if (*p != '_') {
+            name += *p;
+        } else if (p[1] == '1') {
+            name += '_';
+            ++p;
+        } else if (p[1] == '0' && std::strlen(p + 1) >= 5) {
+            // _0xxxx is an escaped UTF-16 code unit, e.g. _00024 for '$'
+            const std::string hex(p + 2, 4);
+            name += static_cast<char>(std::strtol(hex.c_str(), nullptr, 16));
+            p += 5;
+        } else {
+            name += '.';
+        }
+    }
+
+    // Instance methods are implemented by the CppProxy inner class with a "native_" prefix.
+    for (const char * proxyPrefix : { "$CppProxy.native_", "$CppProxy." }) {
+        const auto pos = name.find(proxyPrefix);
+        if (pos != std::string::npos) {
+            name.replace(pos, std::strlen(proxyPrefix), ".");
+            break;
+        }
+    }
+    return name;
+}
+
+CallMetrics::CallMetrics(CallDirection direction, const char * name) noexcept
+    : m_direction(direction)
+    , m_name(name)
+    , m_next(nullptr)
+{
+    reset();
+    CallMetrics * head = g_firstCallMetrics.load(std::memory_order_relaxed);
+    do {
+        m_next = head;
+    } while (!g_firstCallMetrics.compare_exchange_weak(head, this,
+                                                       std::memory_order_release,
+                                                       std::memory_order_relaxed));
+}
+
+CallMetrics * CallMetrics::first() noexcept {
+    return g_firstCallMetrics.load(std::memory_order_acquire);
+}
+
+void CallMetrics::addToHistogram(Histogram & histogram, uint64_t nanos) noexcept {
+    size_t bucket = 0;
+    while (nanos > 1 && bucket + 1 < histogram.size()) {
+        nanos >>= 1;
+        ++bucket;
+    }
+    histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void CallMetrics::record(const Scope & scope, Clock::time_point end) noexcept {
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    const Clock::time_point none {};
+    const bool bodyStarted = scope.m_bodyBegin != none;
+    const bool bodyCompleted = scope.m_bodyEnd != none;
+
+    const auto bodyEnd = bodyCompleted ? scope.m_bodyEnd : end;
+    const auto body = bodyStarted ? bodyEnd - scope.m_bodyBegin : Clock::duration::zero();
+    const auto marshal = (end - scope.m_start) - body;
+
+    const auto marshalNanos = static_cast<uint64_t>(duration_cast<nanoseconds>(marshal).count());
+    const auto bodyNanos = static_cast<uint64_t>(duration_cast<nanoseconds>(body).count());
+
+    m_calls.fetch_add(1, std::memory_order_relaxed);
+    if (!bodyCompleted) {
+        m_errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_marshalNanos.fetch_add(marshalNanos, std::memory_order_relaxed);
+    m_bodyNanos.fetch_add(bodyNanos, std::memory_order_relaxed);
+    addToHistogram(m_marshalHistogram, marshalNanos);
+    if (bodyStarted) {
+        addToHistogram(m_bodyHistogram, bodyNanos);
+    }
+}
+
+CallMetricsSnapshot CallMetrics::snapshot() const {
+    CallMetricsSnapshot s;
+    s.name = m_direction == CallDirection::JavaToCpp ? javaNameFromJniSymbol(m_name) : m_name;
+    s.direction = m_direction;
+    s.calls = m_calls.load(std::memory_order_relaxed);
+    s.errors = m_errors.load(std::memory_order_relaxed);
+    s.marshalNanos = m_marshalNanos.load(std::memory_order_relaxed);
+    s.bodyNanos = m_bodyNanos.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < CallMetricsSnapshot::kHistogramBuckets; ++i) {
+        s.marshalHistogram[i] = m_marshalHistogram[i].load(std::memory_order_relaxed);
+        s.bodyHistogram[i] = m_bodyHistogram[i].load(std::memory_order_relaxed);
+    }
+    return s;
+}
+
+void CallMetrics::reset() noexcept {
+    m_calls.store(0, std::memory_order_relaxed);
+    m_errors.store(0, std::memory_order_relaxed);
+    m_marshalNanos.store(0, std::memory_order_relaxed);
+    m_bodyNanos.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < CallMetricsSnapshot::kHistogramBuckets; ++i) {
+        m_marshalHistogram[i].store(0, std::memory_order_relaxed);
+        m_bodyHistogram[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+bool callMetricsEnabled() noexcept {
+#ifdef DJINNI_ENABLE_METRICS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<CallMetricsSnapshot> callMetricsSnapshot() {
+    std::vector<CallMetricsSnapshot> result;
+    for (const CallMetrics * m = CallMetrics::first(); m; m = m->next()) {
+        result.push_back(m->snapshot());
+    }
+    return result;
+}
+
+void resetCallMetrics() noexcept {
+    for (CallMetrics * m = CallMetrics::first(); m; m = m->next()) {
+        m->reset();
+    }
+}
+
+static LocalRef<jlongArray> histogramToJava(JNIEnv * env, const CallMetricsSnapshot::Histogram & histogram) {
+    auto j = LocalRef<jlongArray>(env, env->NewLongArray(static_cast<jsize>(histogram.size())));
+    jniExceptionCheck(env);
+    jlong values[CallMetricsSnapshot::kHistogramBuckets];
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        values[i] = static_cast<jlong>(histogram[i]);
+    }
+    env->SetLongArrayRegion(j.get(), 0, static_cast<jsize>(histogram.size()), values);
+    jniExceptionCheck(env);
+    return j;
+}
+
+} // namespace djinni
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_CallMetrics_isEnabled(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return ::djinni::callMetricsEnabled() ? JNI_TRUE : JNI_FALSE;
+}
+
+CJNIEXPORT jobjectArray JNICALL Java_com_dropbox_djinni_CallMetrics_snapshot(JNIEnv * env, jclass /*clazz*/) {
+    try {
+        // Looked up on demand rather than through JniClass, so apps that never query metrics
+        // don't need to ship the Java class.
+        auto clazz = ::djinni::LocalRef<jclass>(env, env->FindClass("com/dropbox/djinni/CallMetrics$Method"));
+        ::djinni::jniExceptionCheck(env);
+        const jmethodID constructor = ::djinni::jniGetMethodID(clazz.get(), "<init>", "(Ljava/lang/String;ZJJJJ[J[J)V");
+
+        const auto snapshot = ::djinni::callMetricsSnapshot();
+        auto j = ::djinni::LocalRef<jobjectArray>(env, env->NewObjectArray(static_cast<jsize>(snapshot.size()), clazz.get(), nullptr));
+        ::djinni::jniExceptionCheck(env);
+        for (size_t i = 0; i < snapshot.size(); ++i) {
+            const auto & m = snapshot[i];
+            auto jName = ::djinni::LocalRef<jstring>(env, ::djinni::jniStringFromUTF8(env, m.name));
+            auto jMarshalHistogram = ::djinni::histogramToJava(env, m.marshalHistogram);
+            auto jBodyHistogram = ::djinni::histogramToJava(env, m.bodyHistogram);
+            auto jMethod = ::djinni::LocalRef<jobject>(env, env->NewObject(
+                clazz.get(), constructor,
+                jName.get(),
+                m.direction == ::djinni::CallDirection::JavaToCpp ? JNI_TRUE : JNI_FALSE,
+                static_cast<jlong>(m.calls),
+                static_cast<jlong>(m.errors),
+                static_cast<jlong>(m.marshalNanos),
+                static_cast<jlong>(m.bodyNanos),
+                jMarshalHistogram.get(),
+                jBodyHistogram.get()));
+            ::djinni::jniExceptionCheck(env);
+            env->SetObjectArrayElement(j.get(), static_cast<jsize>(i), jMethod.get());
+            ::djinni::jniExceptionCheck(env);
+        }
+        return j.release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, nullptr)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_CallMetrics_reset(JNIEnv * /*env*/, jclass /*clazz*/) {
+    ::djinni::resetCallMetrics();
+}
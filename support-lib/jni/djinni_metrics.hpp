@@ -0,0 +1,150 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace djinni {
+
+/*
+ * Per-method call metrics for the JNI glue.
+ *
+ * Collection is compiled in only if DJINNI_ENABLE_METRICS is defined when building both the
+ * support library and the generated code. Otherwise the hooks in generated code expand to
+ * nothing and the query functions below return empty results.
+ *
+ * Every generated entry point owns one CallMetrics object (a function-local static), which is
+ * linked into a global registry the first time the method is called. All counters are relaxed
+ * atomics, so recording a call never takes a lock.
+ *
+ * Each call is split into marshal time (converting arguments and the return value) and body
+ * time (the C++ implementation for Java-to-C++ calls, the Java method for C++-to-Java calls).
+ */
+enum class CallDirection {
+    JavaToCpp,
+    CppToJava,
+};
+
+struct CallMetricsSnapshot {
+    /*
+     * Histogram bucket i counts calls that took [2^i, 2^(i+1)) nanoseconds. Bucket 0 also
+     * holds calls under a nanosecond, and the last bucket holds everything above its lower
+     * bound.
+     */
+    static constexpr size_t kHistogramBuckets = 32;
+    using Histogram = std::array<uint64_t, kHistogramBuckets>;
+
+    // "<java class>.<java method>", e.g. "com.example.Foo.bar"
+    std::string name;
+    CallDirection direction;
+    uint64_t calls;
+    // Calls which threw before their body completed.
+    uint64_t errors;
+    uint64_t marshalNanos;
+    uint64_t bodyNanos;
+    Histogram marshalHistogram;
+    Histogram bodyHistogram;
+};
+
+class CallMetrics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    CallMetrics(CallDirection direction, const char * name) noexcept;
+    CallMetrics(const CallMetrics &) = delete;
+    CallMetrics & operator=(const CallMetrics &) = delete;
+
+    /*
+     * Times one call. Generated code constructs this on entry and marks the body boundaries;
+     * the destructor records the call.
+     */
+    class Scope {
+    public:
+        explicit Scope(CallMetrics & metrics) noexcept
+            : m_metrics(metrics), m_start(Clock::now()) {}
+        Scope(const Scope &) = delete;
+        Scope & operator=(const Scope &) = delete;
+        ~Scope() { m_metrics.record(*this, Clock::now()); }
+
+        void bodyBegin() noexcept { m_bodyBegin = Clock::now(); }
+        void bodyEnd() noexcept { m_bodyEnd = Clock::now(); }
+
+    private:
+        friend class CallMetrics;
+        CallMetrics & m_metrics;
+        const Clock::time_point m_start;
+        Clock::time_point m_bodyBegin;
+        Clock::time_point m_bodyEnd;
+    };
+
+    CallMetricsSnapshot snapshot() const;
+    void reset() noexcept;
+
+    // Registry traversal, in reverse order of first call.
+    static CallMetrics * first() noexcept;
+    CallMetrics * next() const noexcept { return m_next; }
+
+private:
+    using Histogram = std::array<std::atomic<uint64_t>, CallMetricsSnapshot::kHistogramBuckets>;
+
+    void record(const Scope & scope, Clock::time_point end) noexcept;
+    static void addToHistogram(Histogram & histogram, uint64_t nanos) noexcept;
+
+    const CallDirection m_direction;
+    const char * const m_name;
+    CallMetrics * m_next;
+
+    std::atomic<uint64_t> m_calls;
+    std::atomic<uint64_t> m_errors;
+    std::atomic<uint64_t> m_marshalNanos;
+    std::atomic<uint64_t> m_bodyNanos;
+    Histogram m_marshalHistogram;
+    Histogram m_bodyHistogram;
+};
+
+/*
+ * Whether this build of the support library collects call metrics.
+ */
+bool callMetricsEnabled() noexcept;
+
+/*
+ * Metrics of all methods called at least once since startup.
+ */
+std::vector<CallMetricsSnapshot> callMetricsSnapshot();
+
+/*
+ * Zero all counters. Calls in flight at the time of the reset may be partially counted.
+ */
+void resetCallMetrics() noexcept;
+
+/*
+ * Java-to-C++ entry points are identified by __func__, which is the mangled JNI symbol, e.g.
+ * "Java_com_example_Foo_00024CppProxy_native_1bar". Returns the readable "com.example.Foo.bar".
+ */
+std::string javaNameFromJniSymbol(const char * symbol);
+
+#define DJINNI_CALL_METRICS_SCOPE(direction_, name_) \
+    static ::djinni::CallMetrics djinni_call_metrics_(direction_, name_); \
+    ::djinni::CallMetrics::Scope djinni_call_metrics_scope_(djinni_call_metrics_)
+
+} // namespace djinni
@@ -0,0 +1,384 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "djinni_ref_stats.hpp"
+#include "djinni_support.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <new>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace djinni {
+
+namespace detail {
+std::atomic<size_t> g_liveGlobalRefs { 0 };
+std::atomic<size_t> g_uncachedJavaProxies { 0 };
+std::atomic<size_t> g_globalRefThreshold { std::numeric_limits<size_t>::max() };
+std::atomic<size_t> g_pendingGlobalRefs { 0 };
+std::atomic<size_t> g_pendingJavaProxies { 0 };
+std::atomic<size_t> g_nativeMemoryThreshold { std::numeric_limits<size_t>::max() };
+std::atomic<size_t> g_nativeBytesAtLastGc { 0 };
+}
+
+namespace {
+
+/*
+ * Queues of references waiting for an attached thread to delete them: Treiber stacks. Threads
+ * draining one take the whole list at once, so nodes are never popped one by one and there is
+ * no ABA problem. A node holds either a plain reference or a JavaProxy, whose destruction
+ * needs a JNIEnv as a whole. The two kinds are kept apart because destroying a cached proxy
+ * takes the JavaProxyCache lock, so it can't happen wherever a plain reference can be deleted.
+ */
+struct PendingRelease {
+    jobject globalRef;
+    void * proxy;
+    void (*destroy)(void *);
+    PendingRelease * next;
+};
+
+std::atomic<PendingRelease *> g_pendingRefs { nullptr };
+std::atomic<PendingRelease *> g_pendingProxies { nullptr };
+std::atomic<uint64_t> g_deferredReleases { 0 };
+
+void pushPendingRelease(std::atomic<PendingRelease *> & queue, std::atomic<size_t> & pending,
+                        PendingRelease * node) noexcept {
+    pending.fetch_add(1, std::memory_order_relaxed);
+    g_deferredReleases.fetch_add(1, std::memory_order_relaxed);
+    node->next = queue.load(std::memory_order_relaxed);
+    while (!queue.compare_exchange_weak(node->next, node,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+}
+
+size_t drainPendingReleases(JNIEnv * env, std::atomic<PendingRelease *> & queue,
+                            std::atomic<size_t> & pending) noexcept {
+    PendingRelease * node = queue.exchange(nullptr, std::memory_order_acquire);
+    size_t released = 0;
+    while (node) {
+        if (node->destroy) {
+            // Deletes the proxy's reference through its GlobalRef, on this attached thread.
+            node->destroy(node->proxy);
+        } else {
+            env->DeleteGlobalRef(node->globalRef);
+        }
+        PendingRelease * const next = node->next;
+        delete node;
+        node = next;
+        ++released;
+    }
+    if (released) {
+        pending.fetch_sub(released, std::memory_order_relaxed);
+    }
+    return released;
+}
+
+struct ThresholdCallback {
+    std::mutex mutex;
+    std::function<void(const JniRefStats &)> callback;
+};
+
+// Leaked so it's still usable while other globals are being destroyed.
+ThresholdCallback & thresholdCallback() {
+    static ThresholdCallback * instance = new ThresholdCallback;
+    return *instance;
+}
+
+void appendCacheReport(std::string & out, const char * name, const ProxyCacheStats & stats,
+                       size_t maxTypes) {
+    out += name;
+    out += ": entries=" + std::to_string(stats.entries);
+    out += " live=" + std::to_string(stats.live_handles);
+    out += " hits=" + std::to_string(stats.hits);
+    out += " misses=" + std::to_string(stats.misses);
+    out += " prunes=" + std::to_string(stats.prunes);
+    out += '\n';
+    for (size_t i = 0; i < stats.types.size() && i < maxTypes; ++i) {
+        out += "  " + std::to_string(stats.types[i].entries) + ' ' + stats.types[i].name + '\n';
+    }
+}
+
+} // namespace
+
+JniRefStats jniRefStats() {
+    JniRefStats stats;
+    stats.javaProxyCache = JavaProxyCache::stats();
+    stats.cppProxyCache = JniCppProxyCache::stats();
+    stats.globalRefs = detail::g_liveGlobalRefs.load(std::memory_order_relaxed);
+    stats.javaProxyRefs = stats.javaProxyCache.live_handles
+                        + detail::g_uncachedJavaProxies.load(std::memory_order_relaxed);
+    // The counters are read one after another, so clamp rather than underflow.
+    stats.otherGlobalRefs = stats.globalRefs > stats.javaProxyRefs
+                          ? stats.globalRefs - stats.javaProxyRefs : 0;
+    stats.pendingReleases = detail::g_pendingGlobalRefs.load(std::memory_order_relaxed)
+                          + detail::g_pendingJavaProxies.load(std::memory_order_relaxed);
+    stats.deferredReleases = g_deferredReleases.load(std::memory_order_relaxed);
+    stats.nativeBytes = reportedNativeBytes();
+    return stats;
+}
+
+void detail::deferGlobalRefRelease(jobject globalRef) noexcept {
+    auto node = new (std::nothrow) PendingRelease { globalRef, nullptr, nullptr, nullptr };
+    if (!node) {
+        // Out of memory: leak the reference, which is what happened before there was a queue.
+        return;
+    }
+    pushPendingRelease(g_pendingRefs, detail::g_pendingGlobalRefs, node);
+}
+
+void detail::deferJavaProxyRelease(void * proxy, void (*destroy)(void *)) noexcept {
+    auto node = new (std::nothrow) PendingRelease { nullptr, proxy, destroy, nullptr };
+    if (!node) {
+        return;
+    }
+    pushPendingRelease(g_pendingProxies, detail::g_pendingJavaProxies, node);
+}
+
+size_t detail::releasePendingPlainRefs(JNIEnv * env) noexcept {
+    return drainPendingReleases(env, g_pendingRefs, g_pendingGlobalRefs);
+}
+
+size_t jniReleasePendingGlobalRefs(JNIEnv * env) noexcept {
+    // Proxies first: destroying them deletes their references on this thread rather than
+    // queueing them.
+    const size_t proxies = drainPendingReleases(env, g_pendingProxies, detail::g_pendingJavaProxies);
+    return proxies + detail::releasePendingPlainRefs(env);
+}
+
+std::string jniRefStatsReport(const JniRefStats & stats, size_t maxTypes) {
+    std::string out = "JNI global refs: " + std::to_string(stats.globalRefs);
+    out += " (java proxies " + std::to_string(stats.javaProxyRefs);
+    out += ", other " + std::to_string(stats.otherGlobalRefs);
+    out += "), pending release " + std::to_string(stats.pendingReleases);
+    out += " of " + std::to_string(stats.deferredReleases) + " deferred\n";
+    out += "Reported native bytes: " + std::to_string(stats.nativeBytes) + '\n';
+    appendCacheReport(out, "JavaProxyCache", stats.javaProxyCache, maxTypes);
+    appendCacheReport(out, "JniCppProxyCache", stats.cppProxyCache, maxTypes);
+    return out;
+}
+
+void jniSetGlobalRefThreshold(size_t threshold, std::function<void(const JniRefStats &)> callback) {
+    const bool enabled = threshold && callback;
+    auto & state = thresholdCallback();
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.callback = std::move(callback);
+    }
+    detail::g_globalRefThreshold.store(enabled ? threshold : std::numeric_limits<size_t>::max(),
+                                       std::memory_order_relaxed);
+}
+
+void detail::globalRefThresholdExceeded() noexcept {
+    // Disarm first, so only one thread reports and the callback can't trigger itself.
+    size_t threshold = g_globalRefThreshold.load(std::memory_order_relaxed);
+    if (threshold == std::numeric_limits<size_t>::max()
+            || !g_globalRefThreshold.compare_exchange_strong(threshold,
+                                                             std::numeric_limits<size_t>::max(),
+                                                             std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::function<void(const JniRefStats &)> callback;
+    {
+        auto & state = thresholdCallback();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        callback = state.callback;
+    }
+    if (callback) {
+        try {
+            callback(jniRefStats());
+        } catch (...) {
+        }
+    }
+}
+
+std::string jniTypeName(const std::type_info & type) {
+#if defined(__GNUC__)
+    int status = 0;
+    char * demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (demangled) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+#endif
+    return type.name();
+}
+
+namespace {
+
+/*
+ * Classes for the Java side of this API. They are looked up the first time the API is used
+ * from Java rather than through JniClass, so apps that never use it don't need to ship them.
+ * The threshold listener may run on a thread where FindClass can't see application classes,
+ * but by then these are cached.
+ */
+struct JavaRefStatsInfo {
+    const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/JniRefStats") };
+    const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>",
+        "(JJJJJJLcom/dropbox/djinni/JniRefStats$Cache;Lcom/dropbox/djinni/JniRefStats$Cache;)V") };
+    const GlobalRef<jclass> cacheClazz { jniFindClass("com/dropbox/djinni/JniRefStats$Cache") };
+    const jmethodID cacheConstructor { jniGetMethodID(cacheClazz.get(), "<init>",
+        "(JJJJJ[Ljava/lang/String;[J)V") };
+    const GlobalRef<jclass> stringClazz { jniFindClass("java/lang/String") };
+    const GlobalRef<jclass> listenerClazz { jniFindClass("com/dropbox/djinni/JniRefStats$Listener") };
+    const jmethodID listenerMethod { jniGetMethodID(listenerClazz.get(), "onThresholdExceeded",
+        "(Lcom/dropbox/djinni/JniRefStats;)V") };
+};
+
+const JavaRefStatsInfo & javaRefStatsInfo() {
+    static const JavaRefStatsInfo info;
+    return info;
+}
+
+// Looked up by jniSetNativeMemoryThreshold(), before the first time it's needed.
+struct JavaNativeMemoryInfo {
+    const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/JniRefStats") };
+    const jmethodID onPressure { jniGetStaticMethodID(clazz.get(), "onNativeMemoryPressure", "()V") };
+};
+
+const JavaNativeMemoryInfo & javaNativeMemoryInfo() {
+    static const JavaNativeMemoryInfo info;
+    return info;
+}
+
+LocalRef<jobject> cacheStatsToJava(JNIEnv * env, const ProxyCacheStats & stats, size_t maxTypes) {
+    const auto & info = javaRefStatsInfo();
+    const jsize count = static_cast<jsize>(std::min(stats.types.size(), maxTypes));
+    auto jNames = LocalRef<jobjectArray>(env, env->NewObjectArray(count, info.stringClazz.get(), nullptr));
+    jniExceptionCheck(env);
+    auto jEntries = LocalRef<jlongArray>(env, env->NewLongArray(count));
+    jniExceptionCheck(env);
+    for (jsize i = 0; i < count; ++i) {
+        const auto & type = stats.types[static_cast<size_t>(i)];
+        auto jName = LocalRef<jstring>(env, jniStringFromUTF8(env, type.name));
+        env->SetObjectArrayElement(jNames.get(), i, jName.get());
+        jniExceptionCheck(env);
+        const jlong entries = static_cast<jlong>(type.entries);
+        env->SetLongArrayRegion(jEntries.get(), i, 1, &entries);
+    }
+    auto j = LocalRef<jobject>(env, env->NewObject(
+        info.cacheClazz.get(), info.cacheConstructor,
+        static_cast<jlong>(stats.entries),
+        static_cast<jlong>(stats.live_handles),
+        static_cast<jlong>(stats.hits),
+        static_cast<jlong>(stats.misses),
+        static_cast<jlong>(stats.prunes),
+        jNames.get(),
+        jEntries.get()));
+    jniExceptionCheck(env);
+    return j;
+}
+
+LocalRef<jobject> refStatsToJava(JNIEnv * env, const JniRefStats & stats, size_t maxTypes) {
+    const auto & info = javaRefStatsInfo();
+    auto jJavaProxyCache = cacheStatsToJava(env, stats.javaProxyCache, maxTypes);
+    auto jCppProxyCache = cacheStatsToJava(env, stats.cppProxyCache, maxTypes);
+    auto j = LocalRef<jobject>(env, env->NewObject(
+        info.clazz.get(), info.constructor,
+        static_cast<jlong>(stats.globalRefs),
+        static_cast<jlong>(stats.javaProxyRefs),
+        static_cast<jlong>(stats.otherGlobalRefs),
+        static_cast<jlong>(stats.pendingReleases),
+        static_cast<jlong>(stats.deferredReleases),
+        static_cast<jlong>(stats.nativeBytes),
+        jJavaProxyCache.get(),
+        jCppProxyCache.get()));
+    jniExceptionCheck(env);
+    return j;
+}
+
+// Number of types passed to a Java threshold listener.
+constexpr size_t kListenerMaxTypes = 10;
+
+} // namespace
+
+void jniSetNativeMemoryThreshold(size_t bytes) {
+    if (bytes) {
+        javaNativeMemoryInfo();
+        detail::g_nativeBytesAtLastGc.store(reportedNativeBytes(), std::memory_order_relaxed);
+    }
+    detail::g_nativeMemoryThreshold.store(bytes ? bytes : std::numeric_limits<size_t>::max(),
+                                          std::memory_order_relaxed);
+}
+
+void detail::nativeMemoryThresholdExceeded(size_t bytes) noexcept {
+    // Only the thread that moves the baseline asks for a collection.
+    size_t base = g_nativeBytesAtLastGc.load(std::memory_order_relaxed);
+    if (bytes < base || bytes - base <= g_nativeMemoryThreshold.load(std::memory_order_relaxed)
+            || !g_nativeBytesAtLastGc.compare_exchange_strong(base, bytes,
+                                                              std::memory_order_relaxed)) {
+        return;
+    }
+    const auto & info = javaNativeMemoryInfo();
+    JNIEnv * const env = jniGetThreadEnv();
+    env->CallStaticVoidMethod(info.clazz.get(), info.onPressure);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+    }
+}
+
+} // namespace djinni
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_JniRefStats_snapshot(JNIEnv * env, jclass /*clazz*/, jint maxTypes) {
+    try {
+        const size_t max = maxTypes > 0 ? static_cast<size_t>(maxTypes) : 0;
+        return ::djinni::refStatsToJava(env, ::djinni::jniRefStats(), max).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, nullptr)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_JniRefStats_report(JNIEnv * env, jclass /*clazz*/, jint maxTypes) {
+    try {
+        const size_t max = maxTypes > 0 ? static_cast<size_t>(maxTypes) : 0;
+        return ::djinni::jniStringFromUTF8(env, ::djinni::jniRefStatsReport(::djinni::jniRefStats(), max));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, nullptr)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_JniRefStats_setThreshold(JNIEnv * env, jclass /*clazz*/, jlong threshold, jobject listener) {
+    try {
+        if (threshold <= 0 || !listener) {
+            ::djinni::jniSetGlobalRefThreshold(0, nullptr);
+            return;
+        }
+        // Resolve the classes now, on a thread that is known to see them.
+        ::djinni::javaRefStatsInfo();
+        auto jListener = std::make_shared<::djinni::GlobalRef<jobject>>(env, listener);
+        ::djinni::jniSetGlobalRefThreshold(static_cast<size_t>(threshold),
+                                           [jListener] (const ::djinni::JniRefStats & stats) {
+            JNIEnv * const threadEnv = ::djinni::jniGetThreadEnv();
+            ::djinni::JniLocalScope scope(threadEnv, 16);
+            auto jStats = ::djinni::refStatsToJava(threadEnv, stats, ::djinni::kListenerMaxTypes);
+            threadEnv->CallVoidMethod(jListener->get(), ::djinni::javaRefStatsInfo().listenerMethod, jStats.get());
+            ::djinni::jniExceptionCheck(threadEnv);
+        });
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, )
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_JniRefStats_releasePending(JNIEnv * env, jclass /*clazz*/) {
+    return static_cast<jlong>(::djinni::jniReleasePendingGlobalRefs(env));
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_JniRefStats_setNativeMemoryThreshold(JNIEnv * env, jclass /*clazz*/, jlong bytes) {
+    try {
+        ::djinni::jniSetNativeMemoryThreshold(bytes > 0 ? static_cast<size_t>(bytes) : 0);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, )
+}
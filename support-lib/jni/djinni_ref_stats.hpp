@@ -0,0 +1,160 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include "../djinni_native_memory.hpp"
+#include "../proxy_cache_interface.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <typeinfo>
+#include <jni.h>
+
+namespace djinni {
+
+/*
+ * Accounting of the JNI global references held through GlobalRef, and statistics of the two
+ * proxy caches. C++ proxies for Java objects usually hold most of the references. The JVM's
+ * global reference table is limited (51200 entries on Android), so a leak of proxies eventually
+ * aborts the process; these counters are always on so that can be seen coming in production
+ * builds.
+ *
+ * Counting costs one relaxed atomic increment per GlobalRef created and destroyed, next to a
+ * JNI call that is far more expensive.
+ */
+struct JniRefStats {
+    // All live GlobalRef objects.
+    size_t globalRefs;
+    // Of those, the ones owned by C++ proxies for Java objects (one per live JavaProxy, cached
+    // or `+j nocache`).
+    size_t javaProxyRefs;
+    // Everything else: classes, pending exceptions, references held by application code.
+    size_t otherGlobalRefs;
+    // References released on threads not attached to the JVM and not yet deleted, see
+    // jniReleasePendingGlobalRefs(). They aren't counted in globalRefs, except for those still
+    // held by cached Java proxies waiting to be destroyed.
+    size_t pendingReleases;
+    // All references ever released that way.
+    uint64_t deferredReleases;
+    // Bytes retained by C++ objects, as reported through NativeMemoryReporter.
+    size_t nativeBytes;
+    ProxyCacheStats javaProxyCache;
+    ProxyCacheStats cppProxyCache;
+};
+
+JniRefStats jniRefStats();
+
+/*
+ * Human-readable summary of `stats`, listing at most `maxTypes` proxy types per cache.
+ */
+std::string jniRefStatsReport(const JniRefStats & stats, size_t maxTypes = 10);
+
+/*
+ * Call `callback` once the number of live GlobalRefs exceeds `threshold`. The check runs each
+ * time an interface crosses the boundary, outside of any proxy cache lock, so the callback may
+ * call jniRefStats() or even cross the boundary itself. It fires at most once per call to this
+ * function, on whichever thread noticed; exceptions it throws are ignored. Passing a threshold
+ * of zero or an empty callback disables the check.
+ */
+void jniSetGlobalRefThreshold(size_t threshold, std::function<void(const JniRefStats &)> callback);
+
+/*
+ * Ask the JVM for a garbage collection whenever the bytes reported through NativeMemoryReporter
+ * have grown by more than `bytes` since the previous request (or since this call). The JVM can't
+ * see that memory, so without this it may collect the CppProxy objects pinning it far too late.
+ * Like the global reference threshold, it's checked each time a C++ object is passed to Java,
+ * outside of any proxy cache lock. The collection is only requested, not waited for; finalizers
+ * then release the C++ objects of unreachable proxies. Zero disables the check (the default).
+ *
+ * Must be called on a thread where the djinni support classes can be found.
+ */
+void jniSetNativeMemoryThreshold(size_t bytes);
+
+/*
+ * A GlobalRef destroyed on a thread that isn't attached to the JVM can't delete its reference
+ * there. Instead the reference is pushed onto a lock-free queue, which is drained by the next
+ * attached thread that calls jniGetThreadEnv() or destroys a GlobalRef, or by calling this
+ * function (from Java: JniRefStats.releasePending()). A cached JavaProxy released on such a
+ * thread is queued whole, since removing it from the JavaProxyCache needs a JNIEnv too. That
+ * takes the cache's lock, which may already be held wherever jniGetThreadEnv() is called, so
+ * queued proxies are only destroyed where no proxy cache lock can be: on entry to a generated
+ * JNI function, on the oneway dispatcher thread, or here. Returns the number of references
+ * deleted.
+ */
+size_t jniReleasePendingGlobalRefs(JNIEnv * env) noexcept;
+
+/*
+ * Readable name of a C++ type (demangled where the ABI allows), used to name proxy types.
+ */
+std::string jniTypeName(const std::type_info & type);
+
+namespace detail {
+extern std::atomic<size_t> g_liveGlobalRefs;
+// Live JavaProxy objects of `+j nocache` interfaces, which the JavaProxyCache doesn't see.
+extern std::atomic<size_t> g_uncachedJavaProxies;
+extern std::atomic<size_t> g_globalRefThreshold;
+void globalRefThresholdExceeded() noexcept;
+
+// Counted before a reference or proxy is queued, so they never drop below the queues' lengths.
+extern std::atomic<size_t> g_pendingGlobalRefs;
+extern std::atomic<size_t> g_pendingJavaProxies;
+void deferGlobalRefRelease(jobject globalRef) noexcept;
+void deferJavaProxyRelease(void * proxy, void (*destroy)(void *)) noexcept;
+size_t releasePendingPlainRefs(JNIEnv * env) noexcept;
+
+// Safe anywhere: leaves queued proxies alone.
+inline void releasePendingGlobalRefs(JNIEnv * env) noexcept {
+    if (g_pendingGlobalRefs.load(std::memory_order_relaxed)) {
+        releasePendingPlainRefs(env);
+    }
+}
+
+// Only where no proxy cache lock can be held, see jniReleasePendingGlobalRefs().
+inline void releasePendingJavaProxies(JNIEnv * env) noexcept {
+    if (g_pendingJavaProxies.load(std::memory_order_relaxed)) {
+        jniReleasePendingGlobalRefs(env);
+    }
+}
+}
+
+namespace detail {
+extern std::atomic<size_t> g_nativeMemoryThreshold;
+// Reported bytes when the last collection was requested, lowered when the total shrinks.
+extern std::atomic<size_t> g_nativeBytesAtLastGc;
+void nativeMemoryThresholdExceeded(size_t bytes) noexcept;
+}
+
+inline void jniCheckNativeMemoryPressure() noexcept {
+    const size_t bytes = reportedNativeBytes();
+    const size_t base = detail::g_nativeBytesAtLastGc.load(std::memory_order_relaxed);
+    if (bytes < base) {
+        detail::g_nativeBytesAtLastGc.store(bytes, std::memory_order_relaxed);
+    } else if (bytes - base > detail::g_nativeMemoryThreshold.load(std::memory_order_relaxed)) {
+        detail::nativeMemoryThresholdExceeded(bytes);
+    }
+}
+
+inline void jniCheckGlobalRefThreshold() noexcept {
+    if (detail::g_liveGlobalRefs.load(std::memory_order_relaxed)
+            > detail::g_globalRefThreshold.load(std::memory_order_relaxed)) {
+        detail::globalRefThresholdExceeded();
+    }
+}
+
+} // namespace djinni
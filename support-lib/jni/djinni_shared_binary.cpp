@@ -0,0 +1,59 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Native methods of com.dropbox.djinni.SharedBinary, see SharedBinary in Marshal.hpp.
+
+#include "Marshal.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using Handle = ::djinni::SharedBinary::CppType;
+
+const Handle & handleFromAddress(jlong nativeRef) {
+    assert(nativeRef);
+    return *reinterpret_cast<const Handle *>(static_cast<uintptr_t>(nativeRef));
+}
+
+} // namespace
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_SharedBinary_nativeCopyOf(JNIEnv * env, jclass /*clazz*/, jbyteArray bytes) {
+    try {
+        DJINNI_ASSERT_MSG(bytes, env, "SharedBinary.copyOf(null)");
+        std::unique_ptr<Handle> handle(new Handle(
+            std::make_shared<const std::vector<uint8_t>>(::djinni::Binary::toCpp(env, bytes))));
+        return static_cast<jlong>(reinterpret_cast<uintptr_t>(handle.release()));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, 0)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_SharedBinary_nativeSize(JNIEnv * /*env*/, jclass /*clazz*/, jlong nativeRef) {
+    return static_cast<jint>(handleFromAddress(nativeRef)->size());
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_SharedBinary_nativeView(JNIEnv * env, jclass /*clazz*/, jlong nativeRef) {
+    const auto & bytes = *handleFromAddress(nativeRef);
+    if (bytes.empty()) {
+        return nullptr;
+    }
+    // Direct buffers are writable; the Java side hands out a read-only view only.
+    return env->NewDirectByteBuffer(const_cast<uint8_t *>(bytes.data()), static_cast<jlong>(bytes.size()));
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_SharedBinary_nativeDestroy(JNIEnv * /*env*/, jclass /*clazz*/, jlong nativeRef) {
+    delete &handleFromAddress(nativeRef);
+}
@@ -18,8 +18,12 @@
 #include "djinni_support.hpp"
 #include "../proxy_cache_impl.hpp"
 #include <cassert>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <list>
+#include <map>
+#include <thread>
 
 static_assert(sizeof(jlong) >= sizeof(void*), "must be able to fit a void* into a jlong");
 
@@ -28,8 +32,12 @@ namespace djinni {
 // Set only once from JNI_OnLoad before any other JNI calls, so no lock needed.
 static JavaVM * g_cachedJVM;
 
+static void stopOnewayDispatcher();
+static void restartOnewayDispatcher();
+
 void jniInit(JavaVM * jvm) {
     g_cachedJVM = jvm;
+    restartOnewayDispatcher();
 
     try {
         for (const auto & kv : JniClassInitializer::Registration::get_all()) {
@@ -43,6 +51,7 @@ void jniInit(JavaVM * jvm) {
 }
 
 void jniShutdown() {
+    stopOnewayDispatcher();
     g_cachedJVM = nullptr;
 }
 
@@ -55,6 +64,10 @@ JNIEnv * jniGetThreadEnv() {
         std::abort();
     }
 
+#ifdef DJINNI_ENABLE_JNI_CALL_COUNTERS
+    jniInterceptEnv(env);
+#endif
+    detail::releasePendingGlobalRefs(env);
     return env;
 }
 
@@ -63,9 +76,8 @@ static JNIEnv * getOptThreadEnv() {
         return nullptr;
     }
 
-    // Special case: this allows us to ignore GlobalRef deletions that happen after this
-    // thread has been detached. (This is known to happen during process shutdown, when
-    // there's no need to release the ref anyway.)
+    // Special case: GlobalRef deletions can happen on threads that aren't attached (native
+    // worker threads, or during process shutdown), where we have no JNIEnv to use.
     JNIEnv * env = nullptr;
     const jint get_res = g_cachedJVM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
 
@@ -84,12 +96,30 @@ static JNIEnv * getOptThreadEnv() {
 
 void GlobalRefDeleter::operator() (jobject globalRef) noexcept {
     if (globalRef) {
+        detail::g_liveGlobalRefs.fetch_sub(1, std::memory_order_relaxed);
+        if (!g_cachedJVM) {
+            // Shut down; there's nothing left to release the reference from.
+            return;
+        }
         if (JNIEnv * env = getOptThreadEnv()) {
+            detail::releasePendingGlobalRefs(env);
             env->DeleteGlobalRef(globalRef);
+        } else {
+            detail::deferGlobalRefRelease(globalRef);
         }
     }
 }
 
+void detail::destroyJavaProxy(void * proxy, void (*destroy)(void *)) noexcept {
+    if (JNIEnv * env = getOptThreadEnv()) {
+        detail::releasePendingGlobalRefs(env);
+        destroy(proxy);
+    } else if (g_cachedJVM) {
+        detail::deferJavaProxyRelease(proxy, destroy);
+    }
+    // Otherwise we're shut down, and the proxy is leaked like its reference would be.
+}
+
 void LocalRefDeleter::operator() (jobject localRef) noexcept {
     if (localRef) {
         jniGetThreadEnv()->DeleteLocalRef(localRef);
@@ -377,8 +407,8 @@ static inline bool is_low_surrogate(char16_t c)  { return (c >= 0xDC00) && (c <
 /*
  * Like utf8_decode_check, but for UTF-16.
  */
-static offset_pt utf16_decode_check(const std::u16string & str, std::u16string::size_type i) {
-    if (is_high_surrogate(str[i]) && is_low_surrogate(str[i+1])) {
+static offset_pt utf16_decode_check(const char16_t * str, size_t length, size_t i) {
+    if (is_high_surrogate(str[i]) && i + 1 < length && is_low_surrogate(str[i+1])) {
         // High surrogate followed by low surrogate
         char32_t pt = (((str[i] - 0xD800) << 10) | (str[i+1] - 0xDC00)) + 0x10000;
         return { 2, pt };
@@ -390,8 +420,8 @@ static offset_pt utf16_decode_check(const std::u16string & str, std::u16string::
     }
 }
 
-static char32_t utf16_decode(const std::u16string & str, std::u16string::size_type & i) {
-    offset_pt res = utf16_decode_check(str, i);
+static char32_t utf16_decode(const char16_t * str, size_t length, size_t & i) {
+    offset_pt res = utf16_decode_check(str, length, i);
     if (res.offset < 0) {
         i += 1;
         return 0xFFFD;
@@ -401,26 +431,36 @@ static char32_t utf16_decode(const std::u16string & str, std::u16string::size_ty
     }
 }
 
-static void utf8_encode(char32_t pt, std::string & out) {
+/*
+ * Write the UTF-8 encoding of pt (at most 4 bytes) to out, and return the end of what was
+ * written.
+ */
+static char * utf8_encode(char32_t pt, char * out) {
     if (pt < 0x80) {
-        out += static_cast<char>(pt);
+        *out++ = static_cast<char>(pt);
     } else if (pt < 0x800) {
-        out += { static_cast<char>((pt >> 6)   | 0xC0),
-                 static_cast<char>((pt & 0x3F) | 0x80) };
+        *out++ = static_cast<char>((pt >> 6)   | 0xC0);
+        *out++ = static_cast<char>((pt & 0x3F) | 0x80);
     } else if (pt < 0x10000) {
-        out += { static_cast<char>((pt >> 12)         | 0xE0),
-                 static_cast<char>(((pt >> 6) & 0x3F) | 0x80),
-                 static_cast<char>((pt & 0x3F)        | 0x80) };
+        *out++ = static_cast<char>((pt >> 12)         | 0xE0);
+        *out++ = static_cast<char>(((pt >> 6) & 0x3F) | 0x80);
+        *out++ = static_cast<char>((pt & 0x3F)        | 0x80);
     } else if (pt < 0x110000) {
-        out += { static_cast<char>((pt >> 18)          | 0xF0),
-                 static_cast<char>(((pt >> 12) & 0x3F) | 0x80),
-                 static_cast<char>(((pt >> 6)  & 0x3F) | 0x80),
-                 static_cast<char>((pt & 0x3F)         | 0x80) };
+        *out++ = static_cast<char>((pt >> 18)          | 0xF0);
+        *out++ = static_cast<char>(((pt >> 12) & 0x3F) | 0x80);
+        *out++ = static_cast<char>(((pt >> 6)  & 0x3F) | 0x80);
+        *out++ = static_cast<char>((pt & 0x3F)         | 0x80);
     } else {
-        out += { static_cast<char>(0xEF),
-                 static_cast<char>(0xBF),
-                 static_cast<char>(0xBD) }; // U+FFFD
+        *out++ = static_cast<char>(0xEF);
+        *out++ = static_cast<char>(0xBF);
+        *out++ = static_cast<char>(0xBD); // U+FFFD
     }
+    return out;
+}
+
+static void utf8_encode(char32_t pt, std::string & out) {
+    char buf[4];
+    out.append(buf, utf8_encode(pt, buf));
 }
 
 std::string jniUTF8FromString(JNIEnv * env, const jstring jstr) {
@@ -435,11 +475,41 @@ std::string jniUTF8FromString(JNIEnv * env, const jstring jstr) {
     std::u16string str(reinterpret_cast<const char16_t *>(ptr.get()), length);
     std::string out;
     out.reserve(str.length() * 3 / 2); // estimate
-    for (std::u16string::size_type i = 0; i < str.length(); )
-        utf8_encode(utf16_decode(str, i), out);
+    for (size_t i = 0; i < str.length(); )
+        utf8_encode(utf16_decode(str.data(), str.length(), i), out);
     return out;
 }
 
+detail::borrowed_span<char> jniUTF8ViewFromString(JNIEnv * env, const jstring jstr) {
+    DJINNI_ASSERT(jstr, env);
+    const jsize length = env->GetStringLength(jstr);
+    jniExceptionCheck(env);
+    const jsize utfLength = env->GetStringUTFLength(jstr);
+    jniExceptionCheck(env);
+
+    if (utfLength == length) {
+        // Only ASCII takes one byte per character in modified UTF-8 (NUL takes two), and for
+        // ASCII it is the same as UTF-8, so the JVM can do the conversion.
+        detail::scratch_buffer scratch(static_cast<size_t>(length) + 1); // Room for a NUL
+        env->GetStringUTFRegion(jstr, 0, length, static_cast<char *>(scratch.data()));
+        jniExceptionCheck(env);
+        return {std::move(scratch), static_cast<size_t>(length)};
+    }
+
+    // A UTF-16 code unit never takes more than 3 bytes of UTF-8; a surrogate pair takes 4.
+    detail::scratch_buffer scratch(static_cast<size_t>(length) * 3);
+    char * const begin = static_cast<char *>(scratch.data());
+    char * end = begin;
+    const jchar * chars = env->GetStringCritical(jstr, nullptr);
+    DJINNI_ASSERT(chars, env);
+    // No JNI calls until the string is released.
+    const auto str = reinterpret_cast<const char16_t *>(chars);
+    for (size_t i = 0; i < static_cast<size_t>(length); )
+        end = utf8_encode(utf16_decode(str, static_cast<size_t>(length), i), end);
+    env->ReleaseStringCritical(jstr, chars);
+    return {std::move(scratch), static_cast<size_t>(end - begin)};
+}
+
 DJINNI_WEAK_DEFINITION
 void jniSetPendingFromCurrent(JNIEnv * env, const char * ctx) noexcept {
     jniDefaultSetPendingFromCurrent(env, ctx);
@@ -460,69 +530,258 @@ void jniDefaultSetPendingFromCurrent(JNIEnv * env, const char * /*ctx*/) noexcep
     // exceptions which aren't std::exception subclasses).
 }
 
+namespace {
+
+struct OnewayCall {
+    const void * target; // null unless coalesced
+    int method;
+    JavaOnewayDispatcher::Call call;
+};
+
+// Intentionally never freed, so that calls posted during static destruction are still safe.
+struct OnewayQueue {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::list<OnewayCall> calls;
+    // The queued coalesced call of each target and method.
+    std::map<std::pair<const void *, int>, std::list<OnewayCall>::iterator> coalesced;
+    std::thread thread;
+    bool stopped = false;
+};
+
+OnewayQueue & onewayQueue() {
+    static OnewayQueue * queue = new OnewayQueue;
+    return *queue;
+}
+
+// jni.h declares AttachCurrentThread's output parameter as JNIEnv ** on Android and void **
+// elsewhere; this converts to either.
+struct AttachEnvOut {
+    JNIEnv ** env;
+    operator JNIEnv **() const { return env; }
+    operator void **() const { return reinterpret_cast<void **>(env); }
+};
+
+void runOnewayCalls(JavaVM * jvm) {
+    JNIEnv * env = nullptr;
+    JavaVMAttachArgs args;
+    args.version = JNI_VERSION_1_6;
+    args.name = const_cast<char *>("djinni-oneway");
+    args.group = nullptr;
+    if (jvm->AttachCurrentThreadAsDaemon(AttachEnvOut{&env}, &args) != JNI_OK || !env) {
+        std::abort();
+    }
+
+    auto & queue = onewayQueue();
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    while (true) {
+        queue.wake.wait(lock, [&] { return queue.stopped || !queue.calls.empty(); });
+        if (queue.stopped) {
+            break;
+        }
+        OnewayCall next = std::move(queue.calls.front());
+        queue.calls.pop_front();
+        if (next.target) {
+            queue.coalesced.erase({next.target, next.method});
+        }
+        lock.unlock();
+        // Also applies JNI call counting and releases deferred global refs, see jniGetThreadEnv.
+        env = jniGetThreadEnv();
+        // No proxy cache lock is held here, so deferred JavaProxy objects can go too.
+        detail::releasePendingJavaProxies(env);
+        try {
+            next.call(env);
+        } catch (const std::exception &) {
+            jniSetPendingFromCurrent(env, __func__);
+        } catch (...) {
+            // jniSetPendingFromCurrent() terminates on anything else, and this thread must
+            // keep running.
+            if (!env->ExceptionCheck()) {
+                env->ThrowNew(env->FindClass("java/lang/RuntimeException"),
+                              "unknown C++ exception in oneway call");
+            }
+        }
+        // Also catches a Java exception the call left pending without throwing in C++.
+        if (env->ExceptionCheck()) {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
+        // Release the arguments and proxy before waiting again.
+        next.call = nullptr;
+        lock.lock();
+    }
+    lock.unlock();
+    jvm->DetachCurrentThread();
+}
+
+void postOnewayCall(const void * target, int method, JavaOnewayDispatcher::Call && call) {
+    auto & queue = onewayQueue();
+    // Declared before the lock, so a replaced call is destroyed after unlocking.
+    JavaOnewayDispatcher::Call replaced;
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.stopped) {
+        return;
+    }
+    if (target) {
+        const auto it = queue.coalesced.find({target, method});
+        if (it != queue.coalesced.end()) {
+            replaced = std::move(it->second->call);
+            it->second->call = std::move(call);
+            return;
+        }
+    }
+    queue.calls.push_back({target, method, std::move(call)});
+    if (target) {
+        queue.coalesced.emplace(std::make_pair(target, method), std::prev(queue.calls.end()));
+    }
+    if (!queue.thread.joinable()) {
+        assert(g_cachedJVM);
+        queue.thread = std::thread(runOnewayCalls, g_cachedJVM);
+    }
+    queue.wake.notify_one();
+}
+
+} // namespace
+
+static void stopOnewayDispatcher() {
+    auto & queue = onewayQueue();
+    std::thread thread;
+    std::list<OnewayCall> dropped;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.stopped = true;
+        thread = std::move(queue.thread);
+        dropped.swap(queue.calls);
+        queue.coalesced.clear();
+    }
+    queue.wake.notify_one();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+// After jniShutdown(), let the next post start a new dispatcher thread.
+static void restartOnewayDispatcher() {
+    auto & queue = onewayQueue();
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.stopped = false;
+}
+
+void JavaOnewayDispatcher::post(Call call) {
+    postOnewayCall(nullptr, 0, std::move(call));
+}
+
+void JavaOnewayDispatcher::postCoalesced(const void * target, int method, Call call) {
+    assert(target);
+    postOnewayCall(target, method, std::move(call));
+}
+
+JniCallBatch::JniCallBatch(JNIEnv * jniEnv, jlongArray calls, jint size, jlongArray results)
+    : m_jniEnv(jniEnv), m_jresults(results), m_calls(static_cast<size_t>(size)) {
+    jniEnv->GetLongArrayRegion(calls, 0, size, m_calls.data());
+    jniExceptionCheck(jniEnv);
+    m_resultCount = static_cast<size_t>(jniEnv->GetArrayLength(results));
+    m_results.reserve(m_resultCount);
+}
+
+jlong JniCallBatch::next() {
+    DJINNI_ASSERT_MSG(m_next < m_calls.size(), m_jniEnv, "truncated call batch");
+    return m_calls[m_next++];
+}
+
+void JniCallBatch::finish() {
+    DJINNI_ASSERT_MSG(m_results.size() == m_resultCount, m_jniEnv, "wrong number of results in call batch");
+    m_jniEnv->SetLongArrayRegion(m_jresults, 0, static_cast<jsize>(m_results.size()), m_results.data());
+    jniExceptionCheck(m_jniEnv);
+}
+
+// Java's Float.floatToRawIntBits() and Double.doubleToRawLongBits() on the other side.
+jfloat JniCallBatch::fromWord(jlong word, jfloat *) noexcept {
+    const auto bits = static_cast<uint32_t>(word);
+    jfloat value;
+    std::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+jdouble JniCallBatch::fromWord(jlong word, jdouble *) noexcept {
+    jdouble value;
+    std::memcpy(&value, &word, sizeof value);
+    return value;
+}
+
+jlong JniCallBatch::toWord(jfloat value) noexcept {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return static_cast<jlong>(bits);
+}
+
+jlong JniCallBatch::toWord(jdouble value) noexcept {
+    jlong word;
+    std::memcpy(&word, &value, sizeof word);
+    return word;
+}
+
 template class ProxyCache<JavaProxyCacheTraits>;
 
 CppProxyClassInfo::CppProxyClassInfo(const char * className)
     : clazz(jniFindClass(className)),
       constructor(jniGetMethodID(clazz.get(), "<init>", "(J)V")),
+      batchConstructor(jniGetStaticMethodID(clazz.get(), "newProxies", "([J[Ljava/lang/Object;)V")),
       idField(jniGetFieldID(clazz.get(), "nativeRef", "J")) {
 }
 
-CppProxyClassInfo::CppProxyClassInfo() : constructor{}, idField{} {
+CppProxyClassInfo::CppProxyClassInfo() : constructor{}, batchConstructor{}, idField{} {
 }
 
 CppProxyClassInfo::~CppProxyClassInfo() {
 }
 
 /*
- * Wrapper around Java WeakReference objects. (We can't use JNI NewWeakGlobalRef() because
- * it doesn't have the right semantics - see comment in djinni_support.hpp.)
+ * Weak reference to a CppProxy, looked up in the Java-side CppProxyRegistry by the address of
+ * the proxy's handle. The registry holds a java.lang.ref.WeakReference for us. (We can't use JNI
+ * NewWeakGlobalRef() because it doesn't have the right semantics - see comment in
+ * djinni_support.hpp.)
  */
-class JavaWeakRef {
+class CppProxyWeakRef {
 private:
     struct JniInfo {
     public:
-        const GlobalRef<jclass> clazz { jniFindClass("java/lang/ref/WeakReference") };
-        const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(Ljava/lang/Object;)V") };
-        const jmethodID method_get { jniGetMethodID(clazz.get(), "get", "()Ljava/lang/Object;") };
+        const GlobalRef<jclass> clazz { jniFindClass("com/dropbox/djinni/CppProxyRegistry") };
+        const jmethodID method_get { jniGetStaticMethodID(clazz.get(), "get", "(J)Ljava/lang/Object;") };
     };
 
-    // Helper used by constructor
-    static jobject create(JNIEnv * jniEnv, jobject obj) {
-        const JniInfo & weakRefClass = JniClass<JniInfo>::get();
-        jobject weakRef = jniEnv->NewObject(weakRefClass.clazz.get(), weakRefClass.constructor, obj);
-        // DJINNI_ASSERT performs an exception check before anything else, so we don't need
-        // a separate jniExceptionCheck call.
-        DJINNI_ASSERT(weakRef, jniEnv);
-        return weakRef;
-    }
-
 public:
-    // Constructor
-    JavaWeakRef(jobject obj) : JavaWeakRef(jniGetThreadEnv(), obj) {}
-    JavaWeakRef(JNIEnv * jniEnv, jobject obj) : m_weakRef(jniEnv, create(jniEnv, obj)) {}
+    CppProxyWeakRef(const CppProxyRef & ref) : m_handle(ref.handle) {}
 
-    // Get the object pointed to if it's still strongly reachable or, return null if not.
-    // (Analogous to weak_ptr::lock.) Returns a local reference.
-    jobject lock() const {
+    // Get the proxy if it's still strongly reachable, or null if not. (Analogous to
+    // weak_ptr::lock.) The returned proxy is a local reference.
+    CppProxyRef lock() const {
         const auto & jniEnv = jniGetThreadEnv();
-        const JniInfo & weakRefClass = JniClass<JniInfo>::get();
-        jobject javaObj = jniEnv->CallObjectMethod(m_weakRef.get(), weakRefClass.method_get);
+        const JniInfo & registryClass = JniClass<JniInfo>::get();
+        jobject javaObj = jniEnv->CallStaticObjectMethod(registryClass.clazz.get(),
+                                                         registryClass.method_get, m_handle);
         jniExceptionCheck(jniEnv);
-        return javaObj;
+        return { javaObj, m_handle };
     }
 
-    // Java WeakReference objects don't have a way to check whether they're expired except
-    // by upgrading them to a strong ref.
+    // As with Java WeakReference objects, the only way to check for expiry is to look the
+    // proxy up.
     bool expired() const {
-        LocalRef<jobject> javaObj { lock() };
+        LocalRef<jobject> javaObj { lock().proxy };
         return !javaObj;
     }
 
 private:
-    GlobalRef<jobject> m_weakRef;
+    jlong m_handle;
 };
 
+// CppProxyRef holds a plain local reference, so the proxy cache needs this to drop one it
+// won't return (see get_batch).
+void release_owning(CppProxyRef & ref) {
+    jniGetThreadEnv()->DeleteLocalRef(ref.proxy);
+    ref.proxy = nullptr;
+}
+
 template class ProxyCache<JniCppProxyCacheTraits>;
 
 } // namespace djinni
@@ -16,14 +16,24 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
+#include "../djinni_span.hpp"
 #include "../proxy_cache_interface.hpp"
+#include "djinni_jni_calls.hpp"
+#include "djinni_metrics.hpp"
+#include "djinni_ref_stats.hpp"
+#include "djinni_tracing.hpp"
 #include <jni.h>
 
 // work-around for missing noexcept and constexpr support in MSVC prior to 2015
@@ -56,7 +66,8 @@ JNIEnv * jniGetThreadEnv();
  * Global and local reference guard objects.
  *
  * A GlobalRef<T> is constructed with a local reference; the constructor upgrades the local
- * reference to a global reference, and the destructor deletes the local ref.
+ * reference to a global reference, and the destructor deletes the local ref. Live global
+ * references are counted, see djinni_ref_stats.hpp.
  *
  * A LocalRef<T> should be constructed with a new local reference. The local reference will
  * be deleted when the LocalRef is deleted.
@@ -76,7 +87,11 @@ public:
         : std::unique_ptr<typename std::remove_pointer<PointerType>::type, ::djinni::GlobalRefDeleter>(
             static_cast<PointerType>(env->NewGlobalRef(localRef)),
             ::djinni::GlobalRefDeleter{}
-        ) {}
+        ) {
+        if (this->get()) {
+            detail::g_liveGlobalRefs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
 };
 
 struct LocalRefDeleter { void operator() (jobject localRef) noexcept; };
@@ -309,6 +324,50 @@ extern template class ProxyCache<JavaProxyCacheTraits>;
 using JavaProxyCache = ProxyCache<JavaProxyCacheTraits>;
 using JavaProxyCacheEntry = JavaProxyCache::Handle<GlobalRef<jobject>>;
 
+/*
+ * Base of the JavaProxy of an interface declared `+j nocache`, used in place of
+ * JavaProxyCacheEntry. It holds the Java object the same way but bypasses the JavaProxyCache,
+ * so every time a Java object crosses into C++ it gets a new JavaProxy. That skips the identity
+ * hash upcall, locking and map bookkeeping, at the price of identity: meant for one-shot
+ * callbacks that C++ never compares or passes back.
+ */
+class JavaProxyUncachedEntry {
+public:
+    JavaProxyUncachedEntry(JNIEnv * env, jobject obj) : m_obj(env, obj) {
+        detail::g_uncachedJavaProxies.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~JavaProxyUncachedEntry() {
+        detail::g_uncachedJavaProxies.fetch_sub(1, std::memory_order_relaxed);
+    }
+    JavaProxyUncachedEntry(const JavaProxyUncachedEntry &) = delete;
+    JavaProxyUncachedEntry & operator=(const JavaProxyUncachedEntry &) = delete;
+
+    const GlobalRef<jobject> & get() const noexcept { return m_obj; }
+
+private:
+    const GlobalRef<jobject> m_obj;
+};
+
+namespace detail {
+void destroyJavaProxy(void * proxy, void (*destroy)(void *)) noexcept;
+}
+
+/*
+ * Deleter of the JavaProxy objects held by the JavaProxyCache. Destroying one removes it from
+ * the cache, which hashes its Java object and so needs a JNIEnv. On a thread that isn't
+ * attached to the JVM the destruction is queued instead, see jniReleasePendingGlobalRefs().
+ */
+struct JavaProxyDeleter {
+    template <class T>
+    void operator() (T * proxy) const noexcept {
+        detail::destroyJavaProxy(proxy, [] (void * p) { delete static_cast<T *>(p); });
+    }
+};
+
+// The Java object behind a JavaProxy, whichever of the bases above it has.
+inline jobject javaProxyObject(const JavaProxyCacheEntry & entry) { return entry.get().get(); }
+inline jobject javaProxyObject(const JavaProxyUncachedEntry & entry) { return entry.get().get(); }
+
 /*
  * Cache for CppProxy objects. This is the inverse of the JavaProxyCache mechanism above,
  * ensuring that each time we pass an interface from Java to C++, we get the *same* CppProxy
@@ -321,23 +380,35 @@ using JavaProxyCacheEntry = JavaProxyCache::Handle<GlobalRef<jobject>>;
  *   | Foo.CppProxy | ------------> | CppProxyHandle | =============> |    Foo    |
  *   |______________|   (jlong)     |      <Foo>     |  (shared_ptr)  |___________|
  *           ^             |        |________________|
- *            \            |
- *        _________        |                     __________________
- *       |         |       |                    |                  |
- *       | WeakRef | <------------------------- | jniCppProxyCache |
- *       |_________|  (GlobalRef)               |__________________|
- *                         |
+ *           | (WeakReference)                ^
+ *    _______|__________   |                  . (jlong)
+ *   |                  |  |          ________._________
+ *   | CppProxyRegistry | <---------- |                  |
+ *   |__________________|  get(jlong) | jniCppProxyCache |
+ *                         |          |__________________|
+ *
+ * Each CppProxy registers a java.lang.ref.WeakReference to itself in the Java-side
+ * CppProxyRegistry when it's constructed, keyed by the address of its CppProxyHandle, and
+ * unregisters when it's destroyed. The cache entry only remembers that address, so creating a
+ * proxy costs one JNI call (the constructor) and reusing one costs one static call to look it
+ * up, without a GlobalRef per entry.
  *
  * We don't use JNI WeakGlobalRef objects, because they last longer than is safe - a
  * WeakGlobalRef can still be upgraded to a strong reference even during finalization, which
  * leads to use-after-free. Java WeakRefs provide the right lifetime guarantee.
  */
-class JavaWeakRef;
+struct CppProxyRef {
+    jobject proxy; // local reference
+    jlong handle;
+
+    explicit operator bool() const { return proxy != nullptr; }
+};
+class CppProxyWeakRef;
 struct JniCppProxyCacheTraits {
     using UnowningImplPointer = void *;
     using OwningImplPointer = std::shared_ptr<void>;
-    using OwningProxyPointer = jobject;
-    using WeakProxyPointer = JavaWeakRef;
+    using OwningProxyPointer = CppProxyRef;
+    using WeakProxyPointer = CppProxyWeakRef;
     using UnowningImplPointerHash = std::hash<void *>;
     using UnowningImplPointerEqual = std::equal_to<void *>;
 };
@@ -364,6 +435,8 @@ static const std::shared_ptr<T> & objectFromHandleAddress(jlong handle) {
 struct CppProxyClassInfo {
     const GlobalRef<jclass> clazz;
     const jmethodID constructor;
+    // static void newProxies(long[] nativeRefs, Object[] proxies)
+    const jmethodID batchConstructor;
     const jfieldID idField;
 
     CppProxyClassInfo(const char * className);
@@ -405,8 +478,10 @@ public:
 
         // Cases 3 and 4.
         assert(m_cppProxyClass);
-        return JniCppProxyCache::get(c, &newCppProxy);
-
+        jobject cppProxy = JniCppProxyCache::get(c, &newCppProxy).proxy;
+        jniCheckGlobalRefThreshold();
+        jniCheckNativeMemoryPressure();
+        return cppProxy;
     }
 
     /*
@@ -423,9 +498,10 @@ public:
         }
 
         // Case 2 - already a Java proxy; we just need to pull the C++ impl out. (This case
-        // is only possible if we were constructed with a cppProxyClassName parameter.)
-        if (m_cppProxyClass
-                && jniEnv->IsSameObject(jniEnv->GetObjectClass(j), m_cppProxyClass.clazz.get())) {
+        // is only possible if we were constructed with a cppProxyClassName parameter.) CppProxy
+        // classes are final, so an instance check is an exact class check, and unlike
+        // GetObjectClass it doesn't create a local reference.
+        if (m_cppProxyClass && jniEnv->IsInstanceOf(j, m_cppProxyClass.clazz.get())) {
             jlong handle = jniEnv->GetLongField(j, m_cppProxyClass.idField);
             jniExceptionCheck(jniEnv);
             return objectFromHandleAddress<I>(handle);
@@ -433,24 +509,110 @@ public:
 
         // Cases 3 and 4 - see _getJavaProxy helper below. JavaProxyCache is responsible for
         // distinguishing between the two cases. Only possible if Self::JavaProxy exists.
-        return _getJavaProxy<Self>(j);
+        std::shared_ptr<I> javaProxy = _getJavaProxy<Self>(j);
+        jniCheckGlobalRefThreshold();
+        return javaProxy;
+    }
+
+    /*
+     * Batch versions of _toJava and _fromJava, used when marshalling collections. They convert
+     * `count` objects with one proxy cache lock, and create all missing CppProxy objects with a
+     * single call into Java. _toJavaBatch stores local references in `j`.
+     */
+    void _toJavaBatch(JNIEnv* jniEnv, const std::shared_ptr<I> * c, size_t count, jobject * j) const {
+        std::vector<std::shared_ptr<void>> impls;
+        std::vector<size_t> indexes;
+        for (size_t i = 0; i != count; ++i) {
+            if (!c[i]) {
+                j[i] = nullptr;
+            } else if (jobject impl = _unwrapJavaProxy<Self>(&c[i])) {
+                j[i] = jniEnv->NewLocalRef(impl);
+            } else {
+                impls.push_back(c[i]);
+                indexes.push_back(i);
+            }
+        }
+        if (impls.empty()) {
+            return;
+        }
+
+        assert(m_cppProxyClass);
+        std::vector<CppProxyRef> proxies(impls.size());
+        JniCppProxyCache::get_batch(impls.data(), impls.size(), &newCppProxy, &newCppProxies,
+                                    proxies.data());
+        for (size_t k = 0; k != indexes.size(); ++k) {
+            j[indexes[k]] = proxies[k].proxy;
+        }
+        jniCheckGlobalRefThreshold();
+        jniCheckNativeMemoryPressure();
+    }
+
+    void _fromJavaBatch(JNIEnv* jniEnv, const jobject * j, size_t count, std::shared_ptr<I> * c) const {
+        std::vector<jobject> impls;
+        std::vector<size_t> indexes;
+        for (size_t i = 0; i != count; ++i) {
+            if (!j[i]) {
+                c[i] = nullptr;
+            } else if (m_cppProxyClass && jniEnv->IsInstanceOf(j[i], m_cppProxyClass.clazz.get())) {
+                jlong handle = jniEnv->GetLongField(j[i], m_cppProxyClass.idField);
+                jniExceptionCheck(jniEnv);
+                c[i] = objectFromHandleAddress<I>(handle);
+            } else {
+                impls.push_back(j[i]);
+                indexes.push_back(i);
+            }
+        }
+        if (impls.empty()) {
+            return;
+        }
+
+        _getJavaProxies<Self>(impls.data(), indexes.data(), impls.size(), c);
+        jniCheckGlobalRefThreshold();
     }
 
     // Constructor for interfaces for which a Java-side CppProxy class exists
-    JniInterface(const char * cppProxyClassName) : m_cppProxyClass(cppProxyClassName) {}
+    JniInterface(const char * cppProxyClassName) : m_cppProxyClass(cppProxyClassName) {
+        _nameProxyTypes();
+    }
 
     // Constructor for interfaces without a Java proxy class
-    JniInterface() : m_cppProxyClass{} {}
+    JniInterface() : m_cppProxyClass{} {
+        _nameProxyTypes();
+    }
 
 private:
+    /*
+     * Name this interface's proxies in the proxy cache stats. The allocator functions are
+     * distinct for each interface, so they identify its entries in either cache.
+     */
+    static void _nameProxyTypes() {
+        const std::string name = jniTypeName(typeid(I));
+        JniCppProxyCache::set_type_name(&newCppProxy, name);
+        _nameJavaProxyType<Self>(&name);
+    }
+
+    template <typename S, typename = typename S::JavaProxy>
+    static void _nameJavaProxyType(const std::string * name) {
+        JavaProxyCache::set_type_name(&newJavaProxy<S>, *name);
+    }
+
+    template <typename S>
+    static void _nameJavaProxyType(...) {}
+
     /*
      * Helpers for _toJava above. The possibility that an object is already a C++-side proxy
      * only exists if the code generator emitted one (if Self::JavaProxy exists).
+     *
+     * JavaProxy classes are final, so instead of a dynamic_cast we compare the object's dynamic
+     * type with typeid. That is a single lookup in the object's type information, and type_info
+     * equality holds across shared libraries.
      */
     template <typename S, typename = typename S::JavaProxy>
     jobject _unwrapJavaProxy(const std::shared_ptr<I> * c) const {
-        if (auto proxy = dynamic_cast<typename S::JavaProxy *>(c->get())) {
-            return proxy->JavaProxyCacheEntry::get().get();
+        using JavaProxy = typename S::JavaProxy;
+        static_assert(std::is_final<JavaProxy>::value, "JavaProxy must be final");
+        if (typeid(*c->get()) == typeid(JavaProxy)) {
+            return javaProxyObject(*static_cast<JavaProxy *>(c->get()));
         } else {
             return nullptr;
         }
@@ -466,7 +628,7 @@ private:
      * it. This is actually called by jniCppProxyCacheGet, which holds a lock on the global
      * C++-to-Java proxy map object.
      */
-    static std::pair<jobject, void*> newCppProxy(const std::shared_ptr<void> & cppObj) {
+    static std::pair<CppProxyRef, void*> newCppProxy(const std::shared_ptr<void> & cppObj) {
         const auto & data = JniClass<Self>::get();
         const auto & jniEnv = jniGetThreadEnv();
         std::unique_ptr<CppProxyHandle<I>> to_encapsulate(
@@ -477,25 +639,88 @@ private:
                                              handle);
         jniExceptionCheck(jniEnv);
         to_encapsulate.release();
-        return { cppProxy, cppObj.get() };
+        return { { cppProxy, handle }, cppObj.get() };
+    }
+
+    /*
+     * Helper for _toJavaBatch above: like newCppProxy, for several objects at once, with the
+     * proxies constructed by the generated CppProxy.newProxies().
+     */
+    static void newCppProxies(const std::shared_ptr<void> * cppObjs, size_t count,
+                              std::pair<CppProxyRef, void*> * out) {
+        const auto & data = JniClass<Self>::get();
+        const auto & jniEnv = jniGetThreadEnv();
+        std::vector<std::unique_ptr<CppProxyHandle<I>>> to_encapsulate;
+        std::vector<jlong> handles;
+        to_encapsulate.reserve(count);
+        handles.reserve(count);
+        for (size_t i = 0; i != count; ++i) {
+            to_encapsulate.emplace_back(new CppProxyHandle<I>(std::static_pointer_cast<I>(cppObjs[i])));
+            handles.push_back(static_cast<jlong>(reinterpret_cast<uintptr_t>(to_encapsulate.back().get())));
+        }
+
+        const jsize size = static_cast<jsize>(count);
+        LocalRef<jlongArray> jhandles(jniEnv, jniEnv->NewLongArray(size));
+        jniExceptionCheck(jniEnv);
+        jniEnv->SetLongArrayRegion(jhandles.get(), 0, size, handles.data());
+        LocalRef<jobjectArray> proxies(jniEnv,
+            jniEnv->NewObjectArray(size, data.m_cppProxyClass.clazz.get(), nullptr));
+        jniExceptionCheck(jniEnv);
+        jniEnv->CallStaticVoidMethod(data.m_cppProxyClass.clazz.get(),
+                                     data.m_cppProxyClass.batchConstructor,
+                                     jhandles.get(), proxies.get());
+        const LocalRef<jthrowable> e(jniEnv->ExceptionOccurred());
+        if (e) {
+            jniEnv->ExceptionClear();
+            // Proxies constructed before the failure were stored in the array. They own their
+            // handles and will delete them when they're destroyed; the rest are deleted here.
+            for (size_t i = 0; i != count; ++i) {
+                const LocalRef<jobject> proxy(
+                    jniEnv->GetObjectArrayElement(proxies.get(), static_cast<jsize>(i)));
+                if (proxy) {
+                    to_encapsulate[i].release();
+                }
+            }
+            jniThrowCppFromJavaException(jniEnv, e.get());
+        }
+        for (size_t i = 0; i != count; ++i) {
+            out[i] = { { jniEnv->GetObjectArrayElement(proxies.get(), static_cast<jsize>(i)),
+                         handles[i] },
+                       cppObjs[i].get() };
+            to_encapsulate[i].release();
+        }
     }
 
     /*
      * Helpers for _fromJava above. We can only produce a C++-side proxy if the code generator
-     * emitted one (if Self::JavaProxy exists).
+     * emitted one (if Self::JavaProxy exists). For `+j nocache` interfaces we skip the
+     * JavaProxyCache and always create a new one.
      */
     template <typename S, typename = typename S::JavaProxy>
     std::shared_ptr<I> _getJavaProxy(jobject j) const {
-        static_assert(std::is_base_of<JavaProxyCacheEntry, typename S::JavaProxy>::value,
-            "JavaProxy must derive from JavaProxyCacheEntry");
-
-        return std::static_pointer_cast<typename S::JavaProxy>(JavaProxyCache::get(
-            j,
-            [] (const jobject & obj) -> std::pair<std::shared_ptr<void>, jobject> {
-                auto ret = std::make_shared<typename S::JavaProxy>(obj);
-                return { ret, ret->JavaProxyCacheEntry::get().get() };
-            }
-        ));
+        using JavaProxy = typename S::JavaProxy;
+        static_assert(std::is_base_of<JavaProxyCacheEntry, JavaProxy>::value
+                      || std::is_base_of<JavaProxyUncachedEntry, JavaProxy>::value,
+            "JavaProxy must derive from JavaProxyCacheEntry or JavaProxyUncachedEntry");
+
+        if (std::is_base_of<JavaProxyUncachedEntry, JavaProxy>::value) {
+            return std::static_pointer_cast<JavaProxy>(newJavaProxy<S>(j).first);
+        }
+        return std::static_pointer_cast<JavaProxy>(JavaProxyCache::get(j, &newJavaProxy<S>));
+    }
+
+    /*
+     * Helper for _getJavaProxy above: given a Java object, allocate a JavaProxy for it. Like
+     * newCppProxy, this is called by the proxy cache with its lock held (unless the JavaProxy
+     * isn't cached).
+     */
+    template <typename S>
+    static std::pair<std::shared_ptr<void>, jobject> newJavaProxy(const jobject & obj) {
+        using JavaProxy = typename S::JavaProxy;
+        auto ret = std::is_base_of<JavaProxyCacheEntry, JavaProxy>::value
+            ? std::shared_ptr<JavaProxy>(new JavaProxy(obj), JavaProxyDeleter{})
+            : std::make_shared<JavaProxy>(obj);
+        return { ret, javaProxyObject(*ret) };
     }
 
     template <typename S>
@@ -504,9 +729,82 @@ private:
         return nullptr;
     }
 
+    /*
+     * Helpers for _fromJavaBatch above: look up or create the JavaProxy objects for `count`
+     * Java objects and store them in `c` at the given indexes.
+     */
+    template <typename S, typename = typename S::JavaProxy>
+    void _getJavaProxies(const jobject * j, const size_t * indexes, size_t count,
+                         std::shared_ptr<I> * c) const {
+        using JavaProxy = typename S::JavaProxy;
+        if (std::is_base_of<JavaProxyUncachedEntry, JavaProxy>::value) {
+            for (size_t k = 0; k != count; ++k) {
+                c[indexes[k]] = std::static_pointer_cast<JavaProxy>(newJavaProxy<S>(j[k]).first);
+            }
+            return;
+        }
+        std::vector<std::shared_ptr<void>> proxies(count);
+        JavaProxyCache::get_batch(j, count, &newJavaProxy<S>, &newJavaProxies<S>, proxies.data());
+        for (size_t k = 0; k != count; ++k) {
+            c[indexes[k]] = std::static_pointer_cast<JavaProxy>(std::move(proxies[k]));
+        }
+    }
+
+    // JavaProxy objects live entirely in C++, so there's nothing to gain from creating them
+    // together; batching only saves the proxy cache locking.
+    template <typename S>
+    static void newJavaProxies(const jobject * objs, size_t count,
+                               std::pair<std::shared_ptr<void>, jobject> * out) {
+        for (size_t i = 0; i != count; ++i) {
+            out[i] = newJavaProxy<S>(objs[i]);
+        }
+    }
+
+    template <typename S>
+    void _getJavaProxies(...) const {
+        assert(false);
+    }
+
     const CppProxyClassInfo m_cppProxyClass;
 };
 
+/*
+ * Base class for the adapters of interfaces declared `+c unique`, which C++ returns as a
+ * std::unique_ptr. Ownership moves into the Java CppProxy, whose nativeRef is the address of
+ * the object itself: there's no CppProxyHandle, no proxy cache entry and no CppProxyRegistry
+ * entry, and the CppProxy's nativeDestroy() deletes the object. Since C++ no longer owns it,
+ * such objects only ever travel from C++ to Java.
+ */
+template <class I, class Self>
+class JniUniqueInterface {
+public:
+    jobject _toJava(JNIEnv* jniEnv, std::unique_ptr<I> c) const {
+        if (!c) {
+            return nullptr;
+        }
+        const jlong handle = static_cast<jlong>(reinterpret_cast<uintptr_t>(c.get()));
+        jobject cppProxy = jniEnv->NewObject(m_cppProxyClass.get(), m_cppProxyConstructor, handle);
+        jniExceptionCheck(jniEnv);
+        c.release();
+        return cppProxy;
+    }
+
+    JniUniqueInterface(const char * cppProxyClassName)
+        : m_cppProxyClass(jniFindClass(cppProxyClassName)),
+          m_cppProxyConstructor(jniGetMethodID(m_cppProxyClass.get(), "<init>", "(J)V")) {}
+
+private:
+    const GlobalRef<jclass> m_cppProxyClass;
+    const jmethodID m_cppProxyConstructor;
+};
+
+template <class T>
+static T * objectFromUniqueHandleAddress(jlong handle) {
+    assert(handle);
+    assert(handle > 4096);
+    return reinterpret_cast<T *>(handle);
+}
+
 /*
  * Guard object which automatically begins and ends a JNI local frame when
  * it is created and destroyed, using PushLocalFrame and PopLocalFrame.
@@ -551,6 +849,9 @@ private:
 
 jstring jniStringFromUTF8(JNIEnv * env, const std::string & str);
 std::string jniUTF8FromString(JNIEnv * env, const jstring jstr);
+// The same in per-thread scratch memory, without allocating once it has grown. ASCII strings are
+// converted by the JVM; others are transcoded from UTF-16 in place.
+detail::borrowed_span<char> jniUTF8ViewFromString(JNIEnv * env, const jstring jstr);
 
 class JniEnum {
 public:
@@ -574,8 +875,135 @@ private:
     const jmethodID m_methOrdinal;
 };
 
-#define DJINNI_FUNCTION_PROLOGUE0(env_)
-#define DJINNI_FUNCTION_PROLOGUE1(env_, arg1_)
+/*
+ * Delivers the calls of `oneway` methods to their Java implementations. The JavaProxy only
+ * queues the call, with its arguments still in C++ form, and returns; a dedicated thread
+ * attached to the JVM converts the arguments and calls Java, in the order the calls were
+ * queued. C++ callers therefore never wait for Java, and don't need to be attached to the JVM.
+ *
+ * Exceptions thrown by a oneway call have no caller to go to, so they are printed with
+ * ExceptionDescribe() and dropped. Calls still queued when jniShutdown() runs are dropped too,
+ * as are calls posted after it; the next jniInit() lets a new dispatcher thread start.
+ */
+class JavaOnewayDispatcher {
+public:
+    using Call = std::function<void(JNIEnv *)>;
+
+    // Queue `call` behind everything queued so far.
+    static void post(Call call);
+
+    /*
+     * For `oneway coalesce` methods: if a call to `method` of `target` is still queued, replace
+     * it with `call` in place, otherwise queue `call` like post(). A slow Java implementation
+     * then only sees the latest arguments. The queued call must keep `target` alive.
+     */
+    static void postCoalesced(const void * target, int method, Call call);
+};
+
+/*
+ * The native side of com.dropbox.djinni.CallBatch, used by the nativeRun entry point generated
+ * for "+c batch" interfaces. Java records each call as its method index followed by one word
+ * per argument, and gets back one word per call that returns a value. Floating point values
+ * travel as their bit patterns.
+ */
+class JniCallBatch {
+public:
+    JniCallBatch(JNIEnv * jniEnv, jlongArray calls, jint size, jlongArray results);
+
+    bool done() const noexcept { return m_next == m_calls.size(); }
+    jint method() { return static_cast<jint>(next()); }
+
+    // The next argument, as the JNI type of its parameter.
+    template <class T>
+    T arg() { return fromWord(next(), static_cast<T *>(nullptr)); }
+
+    template <class T>
+    void result(T value) { m_results.push_back(toWord(value)); }
+
+    // Hands the results back to Java.
+    void finish();
+
+private:
+    jlong next();
+
+    template <class T>
+    static T fromWord(jlong word, T *) noexcept { return static_cast<T>(word); }
+    static jfloat fromWord(jlong word, jfloat *) noexcept;
+    static jdouble fromWord(jlong word, jdouble *) noexcept;
+
+    template <class T>
+    static jlong toWord(T value) noexcept { return static_cast<jlong>(value); }
+    static jlong toWord(jfloat value) noexcept;
+    static jlong toWord(jdouble value) noexcept;
+
+    JNIEnv * const m_jniEnv;
+    const jlongArray m_jresults;
+    std::vector<jlong> m_calls;
+    size_t m_next = 0;
+    size_t m_resultCount = 0;
+    std::vector<jlong> m_results;
+};
+
+/*
+ * Hooks placed by generated code around each call crossing the JNI boundary.
+ *
+ * DJINNI_FUNCTION_PROLOGUE* start every Java-to-C++ entry point, and DJINNI_JAVA_PROXY_PROLOGUE
+ * starts every C++-to-Java proxy method. DJINNI_FUNCTION_BODY_BEGIN/END bracket the actual
+ * implementation call in both, so everything else in between is marshalling.
+ *
+ * With DJINNI_ENABLE_METRICS defined these record per-method call metrics (see
+ * djinni_metrics.hpp), with DJINNI_ENABLE_TRACING defined they record trace spans (see
+ * djinni_tracing.hpp), and with DJINNI_ENABLE_JNI_CALL_COUNTERS defined the entry points install
+ * JNI call counting (see djinni_jni_calls.hpp). Otherwise they expand to nothing, except that
+ * the entry points, where no proxy cache lock can be held, always destroy any cached JavaProxy
+ * objects queued by threads not attached to the JVM (see jniReleasePendingGlobalRefs()).
+ */
+#ifdef DJINNI_ENABLE_JNI_CALL_COUNTERS
+#define DJINNI_JNI_CALLS_HOOK_SCOPE_(env_) ::djinni::JniNativeFrame djinni_jni_native_frame_(env_);
+#else
+#define DJINNI_JNI_CALLS_HOOK_SCOPE_(env_)
+#endif
+
+#ifdef DJINNI_ENABLE_METRICS
+#define DJINNI_METRICS_HOOK_SCOPE_(direction_, name_) DJINNI_CALL_METRICS_SCOPE(direction_, name_);
+#define DJINNI_METRICS_HOOK_BODY_BEGIN_ djinni_call_metrics_scope_.bodyBegin();
+#define DJINNI_METRICS_HOOK_BODY_END_ djinni_call_metrics_scope_.bodyEnd();
+#else
+#define DJINNI_METRICS_HOOK_SCOPE_(direction_, name_)
+#define DJINNI_METRICS_HOOK_BODY_BEGIN_
+#define DJINNI_METRICS_HOOK_BODY_END_
+#endif
+
+#ifdef DJINNI_ENABLE_TRACING
+#define DJINNI_TRACING_HOOK_SCOPE_(direction_, name_) DJINNI_TRACE_SCOPE(direction_, name_);
+#define DJINNI_TRACING_HOOK_BODY_BEGIN_ djinni_trace_scope_.bodyBegin();
+#define DJINNI_TRACING_HOOK_BODY_END_ djinni_trace_scope_.bodyEnd();
+#else
+#define DJINNI_TRACING_HOOK_SCOPE_(direction_, name_)
+#define DJINNI_TRACING_HOOK_BODY_BEGIN_
+#define DJINNI_TRACING_HOOK_BODY_END_
+#endif
+
+// The trailing no-op absorbs the semicolon generated code puts after each hook.
+#define DJINNI_CALL_HOOKS_SCOPE_(direction_, name_) \
+    DJINNI_METRICS_HOOK_SCOPE_(direction_, name_) \
+    DJINNI_TRACING_HOOK_SCOPE_(direction_, name_) \
+    static_cast<void>(0)
+
+#define DJINNI_FUNCTION_PROLOGUE0(env_) \
+    DJINNI_JNI_CALLS_HOOK_SCOPE_(env_) \
+    ::djinni::detail::releasePendingJavaProxies(env_); \
+    DJINNI_CALL_HOOKS_SCOPE_(::djinni::CallDirection::JavaToCpp, __func__)
+#define DJINNI_FUNCTION_PROLOGUE1(env_, arg1_) \
+    DJINNI_JNI_CALLS_HOOK_SCOPE_(env_) \
+    ::djinni::detail::releasePendingJavaProxies(env_); \
+    DJINNI_CALL_HOOKS_SCOPE_(::djinni::CallDirection::JavaToCpp, __func__)
+#define DJINNI_JAVA_PROXY_PROLOGUE(name_) \
+    DJINNI_CALL_HOOKS_SCOPE_(::djinni::CallDirection::CppToJava, name_)
+#define DJINNI_FUNCTION_BODY_BEGIN(env_) \
+    DJINNI_METRICS_HOOK_BODY_BEGIN_ DJINNI_TRACING_HOOK_BODY_BEGIN_ static_cast<void>(0)
+#define DJINNI_FUNCTION_BODY_END(env_) \
+    DJINNI_METRICS_HOOK_BODY_END_ DJINNI_TRACING_HOOK_BODY_END_ static_cast<void>(0)
 
 /*
  * Helper for JNI_TRANSLATE_EXCEPTIONS_RETURN.
@@ -0,0 +1,323 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "djinni_tracing.hpp"
+#include "djinni_support.hpp"
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+// Spans kept per thread. Each takes 32 bytes.
+#ifndef DJINNI_TRACE_BUFFER_SPANS
+#define DJINNI_TRACE_BUFFER_SPANS 4096
+#endif
+
+namespace djinni {
+
+namespace detail {
+std::atomic<bool> g_tracingEnabled { false };
+}
+
+namespace {
+
+enum class SpanKind : uint8_t {
+    Call,
+    MarshalArgs,
+    MarshalReturn,
+};
+
+/*
+ * Every field is a relaxed atomic so a dump can read a slot while the owning thread is
+ * overwriting it. Such torn slots are detected by the reader and dropped: while the written
+ * count is n, the owner may be filling slot n, so a reader drops span n - kCapacity too.
+ */
+struct Span {
+    std::atomic<const char *> name;
+    std::atomic<int64_t> startNanos;
+    std::atomic<int64_t> durationNanos;
+    std::atomic<uint8_t> kind;
+    std::atomic<uint8_t> direction;
+    std::atomic<uint32_t> threadId;
+};
+
+struct SpanCopy {
+    const char * name;
+    int64_t startNanos;
+    int64_t durationNanos;
+    SpanKind kind;
+    CallDirection direction;
+    uint32_t threadId;
+};
+
+class TraceBuffer {
+public:
+    static constexpr uint64_t kCapacity = DJINNI_TRACE_BUFFER_SPANS;
+
+    explicit TraceBuffer(uint32_t threadId) : m_threadId(threadId) {}
+
+    /*
+     * Takes over a buffer released by an exited thread. Its spans are kept, and are overwritten
+     * by the new owner's like any of its own.
+     */
+    bool tryClaim(uint32_t threadId) noexcept {
+        bool owned = false;
+        if (!m_owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+            return false;
+        }
+        m_threadId = threadId;
+        return true;
+    }
+
+    void release() noexcept { m_owned.store(false, std::memory_order_release); }
+
+    // Only called by the owning thread.
+    void push(const char * name, CallDirection direction, SpanKind kind,
+              int64_t startNanos, int64_t durationNanos) noexcept {
+        const uint64_t index = m_written.load(std::memory_order_relaxed);
+        Span & span = m_spans[index % kCapacity];
+        // Pairs with the fence in copy(), so a reader that sees any of these stores also sees
+        // a written count of at least index, and drops the span this slot held before.
+        std::atomic_thread_fence(std::memory_order_release);
+        span.name.store(name, std::memory_order_relaxed);
+        span.startNanos.store(startNanos, std::memory_order_relaxed);
+        span.durationNanos.store(durationNanos, std::memory_order_relaxed);
+        span.kind.store(static_cast<uint8_t>(kind), std::memory_order_relaxed);
+        span.direction.store(static_cast<uint8_t>(direction), std::memory_order_relaxed);
+        span.threadId.store(m_threadId, std::memory_order_relaxed);
+        m_written.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<SpanCopy> copy() const {
+        const uint64_t end = m_written.load(std::memory_order_acquire);
+        uint64_t begin = std::max(m_cleared.load(std::memory_order_relaxed),
+                                  end > kCapacity ? end - kCapacity : 0);
+        std::vector<SpanCopy> result;
+        result.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t i = begin; i < end; ++i) {
+            const Span & span = m_spans[i % kCapacity];
+            result.push_back({
+                span.name.load(std::memory_order_relaxed),
+                span.startNanos.load(std::memory_order_relaxed),
+                span.durationNanos.load(std::memory_order_relaxed),
+                static_cast<SpanKind>(span.kind.load(std::memory_order_relaxed)),
+                static_cast<CallDirection>(span.direction.load(std::memory_order_relaxed)),
+                span.threadId.load(std::memory_order_relaxed),
+            });
+        }
+        // Anything the owning thread may have lapped while we were copying is garbage, and so is
+        // the span in the slot it may be filling right now.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t after = m_written.load(std::memory_order_relaxed) + 1;
+        if (after > kCapacity && after - kCapacity > begin) {
+            const auto lapped = std::min<uint64_t>(after - kCapacity - begin, result.size());
+            result.erase(result.begin(), result.begin() + static_cast<ptrdiff_t>(lapped));
+        }
+        return result;
+    }
+
+    void clear() noexcept {
+        m_cleared.store(m_written.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    TraceBuffer * next() const noexcept { return m_next; }
+
+private:
+    friend TraceBuffer * threadTraceBuffer();
+
+    // Written only by the owning thread, and each span records the value it was written with.
+    uint32_t m_threadId;
+    std::atomic<bool> m_owned { true };
+    TraceBuffer * m_next = nullptr;
+    std::atomic<uint64_t> m_written { 0 };
+    std::atomic<uint64_t> m_cleared { 0 };
+    std::array<Span, kCapacity> m_spans;
+};
+
+std::atomic<TraceBuffer *> g_firstTraceBuffer { nullptr };
+std::atomic<uint32_t> g_nextTraceThreadId { 1 };
+
+// Hands the calling thread's buffer to the next thread that starts tracing once this one exits.
+struct TraceBufferOwner {
+    TraceBuffer * buffer = nullptr;
+    ~TraceBufferOwner();
+};
+
+thread_local bool t_traceBufferReleased = false;
+
+TraceBufferOwner::~TraceBufferOwner() {
+    t_traceBufferReleased = true;
+    if (buffer) {
+        buffer->release();
+    }
+}
+
+/*
+ * The calling thread's buffer, reusing one released by an exited thread if possible. Buffers
+ * are never freed, as a concurrent dump may be reading them, but there are never more of them
+ * than threads that were tracing at the same time. Null while the thread is exiting.
+ */
+TraceBuffer * threadTraceBuffer() {
+    static thread_local TraceBufferOwner t_owner;
+    if (t_traceBufferReleased) {
+        return nullptr;
+    }
+    if (!t_owner.buffer) {
+        const uint32_t threadId = g_nextTraceThreadId.fetch_add(1, std::memory_order_relaxed);
+        for (TraceBuffer * b = g_firstTraceBuffer.load(std::memory_order_acquire); b; b = b->next()) {
+            if (b->tryClaim(threadId)) {
+                t_owner.buffer = b;
+                return b;
+            }
+        }
+        TraceBuffer * buffer = new TraceBuffer(threadId);
+        TraceBuffer * head = g_firstTraceBuffer.load(std::memory_order_relaxed);
+        do {
+            buffer->m_next = head;
+        } while (!g_firstTraceBuffer.compare_exchange_weak(head, buffer,
+                                                           std::memory_order_release,
+                                                           std::memory_order_relaxed));
+        t_owner.buffer = buffer;
+    }
+    return t_owner.buffer;
+}
+
+TraceScope::Clock::time_point traceEpoch() {
+    static const auto epoch = TraceScope::Clock::now();
+    return epoch;
+}
+
+int64_t nanosSince(TraceScope::Clock::time_point from, TraceScope::Clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+}
+
+void appendJsonString(std::string & out, const std::string & s) {
+    out += '"';
+    for (const char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+// Chrome trace timestamps are in (fractional) microseconds.
+void appendMicros(std::string & out, int64_t nanos) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%" PRId64 ".%03" PRId64, nanos / 1000, nanos % 1000);
+    out += buf;
+}
+
+} // namespace
+
+void TraceScope::record(Clock::time_point end) noexcept {
+    const Clock::time_point none {};
+    const auto epoch = traceEpoch();
+    TraceBuffer * buffer = threadTraceBuffer();
+    if (!buffer) {
+        return;
+    }
+
+    const auto argsEnd = m_bodyBegin != none ? m_bodyBegin : end;
+    buffer->push(m_name, m_direction, SpanKind::MarshalArgs,
+                 nanosSince(epoch, m_start), nanosSince(m_start, argsEnd));
+    if (m_bodyEnd != none) {
+        buffer->push(m_name, m_direction, SpanKind::MarshalReturn,
+                     nanosSince(epoch, m_bodyEnd), nanosSince(m_bodyEnd, end));
+    }
+    buffer->push(m_name, m_direction, SpanKind::Call,
+                 nanosSince(epoch, m_start), nanosSince(m_start, end));
+}
+
+void setTracingEnabled(bool enabled) noexcept {
+    if (enabled) {
+        // Pin the epoch before any span is timed against it.
+        traceEpoch();
+    }
+    detail::g_tracingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::string tracingDumpJson() {
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const TraceBuffer * b = g_firstTraceBuffer.load(std::memory_order_acquire); b; b = b->next()) {
+        for (const auto & span : b->copy()) {
+            if (!first) {
+                out += ',';
+            }
+            first = false;
+
+            out += "{\"name\":";
+            switch (span.kind) {
+                case SpanKind::Call:
+                    appendJsonString(out, span.direction == CallDirection::JavaToCpp
+                                          ? javaNameFromJniSymbol(span.name) : span.name);
+                    break;
+                case SpanKind::MarshalArgs:
+                    out += "\"marshal args\"";
+                    break;
+                case SpanKind::MarshalReturn:
+                    out += "\"marshal return\"";
+                    break;
+            }
+            out += ",\"cat\":";
+            out += span.direction == CallDirection::JavaToCpp ? "\"java_to_cpp\"" : "\"cpp_to_java\"";
+            out += ",\"ph\":\"X\",\"ts\":";
+            appendMicros(out, span.startNanos);
+            out += ",\"dur\":";
+            appendMicros(out, span.durationNanos);
+            out += ",\"pid\":1,\"tid\":";
+            out += std::to_string(span.threadId);
+            out += '}';
+        }
+    }
+    out += "]}";
+    return out;
+}
+
+void clearTracing() noexcept {
+    for (TraceBuffer * b = g_firstTraceBuffer.load(std::memory_order_acquire); b; b = b->next()) {
+        b->clear();
+    }
+}
+
+} // namespace djinni
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_Tracing_setEnabled(JNIEnv * /*env*/, jclass /*clazz*/, jboolean enabled) {
+    ::djinni::setTracingEnabled(enabled != JNI_FALSE);
+}
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_Tracing_isEnabled(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return ::djinni::tracingEnabled() ? JNI_TRUE : JNI_FALSE;
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_Tracing_dump(JNIEnv * env, jclass /*clazz*/) {
+    try {
+        return ::djinni::jniStringFromUTF8(env, ::djinni::tracingDumpJson());
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(env, nullptr)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_Tracing_clear(JNIEnv * /*env*/, jclass /*clazz*/) {
+    ::djinni::clearTracing();
+}
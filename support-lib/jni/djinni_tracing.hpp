@@ -0,0 +1,110 @@
+//
+// Copyright 2015 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include "djinni_metrics.hpp"
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace djinni {
+
+/*
+ * Tracing of calls crossing the JNI boundary, exported in the Chrome trace event format
+ * (load the output in chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Support is compiled into the hooks in generated code only if DJINNI_ENABLE_TRACING is defined.
+ * Even then tracing starts out disabled, and each hook costs one relaxed load and branch until
+ * it's turned on with setTracingEnabled().
+ *
+ * While enabled, every crossing records a span for the whole call, plus nested spans for
+ * marshalling the arguments and the return value. Spans are written to a fixed-size ring buffer
+ * owned by the calling thread, so recording never blocks; once a buffer is full the oldest spans
+ * of that thread are overwritten. When a thread exits, its buffer is handed on to the next thread
+ * that records a span, so memory use is bounded by the number of threads tracing at once. The
+ * exited thread's spans stay in the buffer and show up in dumps until the new owner overwrites
+ * them.
+ */
+
+namespace detail {
+extern std::atomic<bool> g_tracingEnabled;
+}
+
+inline bool tracingEnabled() noexcept {
+    return detail::g_tracingEnabled.load(std::memory_order_relaxed);
+}
+
+void setTracingEnabled(bool enabled) noexcept;
+
+/*
+ * All spans currently in the per-thread buffers, as a Chrome trace JSON object.
+ * Threads are numbered in the order they first recorded a span.
+ */
+std::string tracingDumpJson();
+
+/*
+ * Drop all spans recorded so far.
+ */
+void clearTracing() noexcept;
+
+class TraceScope {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TraceScope(CallDirection direction, const char * name) noexcept
+        : m_name(name)
+        , m_direction(direction)
+        , m_active(tracingEnabled())
+    {
+        if (m_active) {
+            m_start = Clock::now();
+        }
+    }
+    TraceScope(const TraceScope &) = delete;
+    TraceScope & operator=(const TraceScope &) = delete;
+    ~TraceScope() {
+        if (m_active) {
+            record(Clock::now());
+        }
+    }
+
+    void bodyBegin() noexcept {
+        if (m_active) {
+            m_bodyBegin = Clock::now();
+        }
+    }
+    void bodyEnd() noexcept {
+        if (m_active) {
+            m_bodyEnd = Clock::now();
+        }
+    }
+
+private:
+    void record(Clock::time_point end) noexcept;
+
+    const char * const m_name;
+    const CallDirection m_direction;
+    const bool m_active;
+    Clock::time_point m_start;
+    Clock::time_point m_bodyBegin;
+    Clock::time_point m_bodyEnd;
+};
+
+#define DJINNI_TRACE_SCOPE(direction_, name_) \
+    ::djinni::TraceScope djinni_trace_scope_(direction_, name_)
+
+} // namespace djinni
@@ -0,0 +1,72 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, DJIListDeltaKind) {
+    DJIListDeltaKindInsert = 0,
+    DJIListDeltaKindRemove = 1,
+    DJIListDeltaKindReplace = 2,
+};
+
+/** One insert, removal or replacement in a DJIListDelta. */
+@interface DJIListDeltaOp<__covariant ObjectType> : NSObject
+
++ (instancetype)opWithKind:(DJIListDeltaKind)kind
+                     index:(NSUInteger)index
+                     count:(NSUInteger)count
+                   objects:(NSArray<ObjectType> *)objects;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) DJIListDeltaKind kind;
+@property (nonatomic, readonly) NSUInteger index;
+/** The number of elements inserted, removed or replaced. */
+@property (nonatomic, readonly) NSUInteger count;
+/** The new elements; empty for a removal. */
+@property (nonatomic, readonly) NSArray<ObjectType> *objects;
+
+@end
+
+/**
+ * Objective-C representation of the djinni IDL type `list_delta<T>`: a sequence of inserts,
+ * removals and replacements that turns one version of a list into the next, so a listener can
+ * keep a mirror of the list up to date at a cost proportional to the change. Each op's index
+ * refers to the list as left by the ops before it.
+ *
+ * Consecutive inserts or replacements of adjacent ranges, and consecutive removals at the same
+ * index, are merged into a single op.
+ */
+@interface DJIListDelta<ObjectType> : NSObject
+
+- (void)insertObjects:(NSArray<ObjectType> *)objects atIndex:(NSUInteger)index;
+- (void)removeObjectsAtIndex:(NSUInteger)index count:(NSUInteger)count;
+- (void)replaceObjectsAtIndex:(NSUInteger)index withObjects:(NSArray<ObjectType> *)objects;
+
+/** Appends `op` as is, without merging. Used by the marshallers. */
+- (void)appendOp:(DJIListDeltaOp<ObjectType> *)op;
+
+@property (nonatomic, readonly) NSArray<DJIListDeltaOp<ObjectType> *> *ops;
+
+/** Applies the ops to `array` in order. Raises NSRangeException if an op doesn't fit. */
+- (void)applyToArray:(NSMutableArray<ObjectType> *)array;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,138 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#import "DJIListDelta.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DJIListDeltaOp ()
+
+@property (nonatomic, readwrite) NSUInteger count;
+@property (nonatomic, readwrite) NSArray *objects;
+
+@end
+
+@implementation DJIListDeltaOp
+
+- (instancetype)initWithKind:(DJIListDeltaKind)kind
+                       index:(NSUInteger)index
+                       count:(NSUInteger)count
+                     objects:(NSArray *)objects
+{
+    if (self = [super init]) {
+        _kind = kind;
+        _index = index;
+        _count = count;
+        _objects = objects;
+    }
+    return self;
+}
+
++ (instancetype)opWithKind:(DJIListDeltaKind)kind
+                     index:(NSUInteger)index
+                     count:(NSUInteger)count
+                   objects:(NSArray *)objects
+{
+    return [[self alloc] initWithKind:kind index:index count:count objects:objects];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p kind:%ld index:%lu count:%lu>", self.class, self,
+            (long)self.kind, (unsigned long)self.index, (unsigned long)self.count];
+}
+
+@end
+
+@implementation DJIListDelta
+{
+    NSMutableArray<DJIListDeltaOp *> *_ops;
+}
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _ops = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (NSArray<DJIListDeltaOp *> *)ops
+{
+    return [_ops copy];
+}
+
+- (void)insertObjects:(NSArray *)objects atIndex:(NSUInteger)index
+{
+    [self addObjects:objects atIndex:index kind:DJIListDeltaKindInsert];
+}
+
+- (void)removeObjectsAtIndex:(NSUInteger)index count:(NSUInteger)count
+{
+    DJIListDeltaOp *last = _ops.lastObject;
+    if (last && last.kind == DJIListDeltaKindRemove && last.index == index) {
+        last.count += count;
+    } else if (count > 0) {
+        [_ops addObject:[DJIListDeltaOp opWithKind:DJIListDeltaKindRemove index:index count:count objects:@[]]];
+    }
+}
+
+- (void)replaceObjectsAtIndex:(NSUInteger)index withObjects:(NSArray *)objects
+{
+    [self addObjects:objects atIndex:index kind:DJIListDeltaKindReplace];
+}
+
+- (void)appendOp:(DJIListDeltaOp *)op
+{
+    [_ops addObject:op];
+}
+
+- (void)applyToArray:(NSMutableArray *)array
+{
+    for (DJIListDeltaOp *op in _ops) {
+        switch (op.kind) {
+            case DJIListDeltaKindInsert:
+                [array insertObjects:op.objects
+                           atIndexes:[NSIndexSet indexSetWithIndexesInRange:NSMakeRange(op.index, op.count)]];
+                break;
+            case DJIListDeltaKindRemove:
+                [array removeObjectsInRange:NSMakeRange(op.index, op.count)];
+                break;
+            case DJIListDeltaKindReplace:
+                [array replaceObjectsInRange:NSMakeRange(op.index, op.count) withObjectsFromArray:op.objects];
+                break;
+        }
+    }
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p ops:%@>", self.class, self, _ops];
+}
+
+- (void)addObjects:(NSArray *)objects atIndex:(NSUInteger)index kind:(DJIListDeltaKind)kind
+{
+    DJIListDeltaOp *last = _ops.lastObject;
+    if (last && last.kind == kind && last.index + last.count == index) {
+        last.objects = [last.objects arrayByAddingObjectsFromArray:objects];
+        last.count = last.objects.count;
+    } else if (objects.count > 0) {
+        [_ops addObject:[DJIListDeltaOp opWithKind:kind index:index count:objects.count objects:[objects copy]]];
+    }
+}
+
+@end
@@ -8,8 +8,16 @@
 
 #pragma once
 #import <Foundation/Foundation.h>
+#import "DJIListDelta.h"
+#import "DJIResult.h"
+#include "../djinni_expected.hpp"
+#include "../djinni_list_delta.hpp"
+#include "../djinni_mapped_region.hpp"
+#include "../djinni_out_buffer.hpp"
+#include "../djinni_span.hpp"
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <unordered_map>
@@ -118,6 +126,21 @@ struct String {
     }
 };
 
+// A string parameter with --cpp-string-view-params. The UTF-8 is owned by the NSString (or the
+// autorelease pool), so nothing is copied. Only passed into C++.
+template<class View>
+struct StringView {
+    using CppType = View;
+    using ObjcType = NSString*;
+
+    using Boxed = StringView;
+
+    static CppType toCpp(ObjcType string) {
+        assert(string);
+        return {[string UTF8String], [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding]};
+    }
+};
+
 struct Date {
     using CppType = std::chrono::system_clock::time_point;
     using ObjcType = NSDate*;
@@ -159,6 +182,73 @@ struct Binary {
     }
 };
 
+struct SharedBinary {
+    using CppType = std::shared_ptr<const std::vector<uint8_t>>;
+    using ObjcType = NSData*;
+
+    using Boxed = SharedBinary;
+
+    static CppType toCpp(ObjcType data) {
+        assert(data);
+        // NSData doesn't tell who owns its bytes, so they're copied once on the way in.
+        auto bytes = reinterpret_cast<const uint8_t*>(data.bytes);
+        return std::make_shared<const std::vector<uint8_t>>(bytes, bytes + data.length);
+    }
+
+    static ObjcType fromCpp(const CppType& c) {
+        if (!c || c->empty()) {
+            return [NSData data];
+        }
+        assert(c->size() <= std::numeric_limits<NSUInteger>::max());
+        // The block keeps the buffer alive for as long as the NSData.
+        CppType owner = c;
+        return [[NSData alloc] initWithBytesNoCopy:const_cast<uint8_t*>(c->data())
+                                            length:static_cast<NSUInteger>(c->size())
+                                       deallocator:^(void*, NSUInteger) { (void)owner; }];
+    }
+};
+
+struct MappedRegion {
+    using CppType = ::djinni::mapped_region;
+    using ObjcType = NSData*;
+
+    using Boxed = MappedRegion;
+
+    static CppType toCpp(ObjcType data) {
+        assert(data);
+        // An immutable copy is usually the same object (or a cheap retain of a mapped file),
+        // so the region just keeps it alive instead of copying the bytes.
+        NSData* frozen = [data copy];
+        return {reinterpret_cast<const uint8_t*>(frozen.bytes), static_cast<size_t>(frozen.length),
+                std::shared_ptr<const void>(frozen.bytes, [frozen](const void*) { (void)frozen; })};
+    }
+
+    static ObjcType fromCpp(const CppType& c) {
+        if (c.empty()) {
+            return [NSData data];
+        }
+        assert(c.size() <= std::numeric_limits<NSUInteger>::max());
+        // The block keeps the region alive for as long as the NSData.
+        CppType owner = c;
+        return [[NSData alloc] initWithBytesNoCopy:const_cast<uint8_t*>(c.data())
+                                            length:static_cast<NSUInteger>(c.size())
+                                       deallocator:^(void*, NSUInteger) { (void)owner; }];
+    }
+};
+
+// Only passed from Objective-C into C++, so there is no fromCpp().
+struct OutBuffer {
+    using CppType = ::djinni::out_buffer;
+    using ObjcType = NSMutableData*;
+
+    using Boxed = OutBuffer;
+
+    static CppType toCpp(ObjcType data) {
+        assert(data);
+        return {static_cast<uint8_t*>(data.mutableBytes), static_cast<size_t>(data.length)};
+    }
+};
+
 template<template<class> class OptionalType, class T>
 class Optional {
 public:
@@ -176,6 +266,28 @@ public:
     }
 };
 
+template<class T, class E>
+class Result {
+public:
+    using CppType = ::djinni::expected<typename T::CppType, typename E::CppType>;
+    using ObjcType = DJIResult*;
+
+    using Boxed = Result;
+
+    static CppType toCpp(ObjcType result) {
+        assert(result);
+        if (result.isOk) {
+            return CppType(T::Boxed::toCpp(result.value));
+        }
+        return CppType(::djinni::make_unexpected(E::Boxed::toCpp(result.error)));
+    }
+
+    static ObjcType fromCpp(const CppType& result) {
+        return result ? [DJIResult resultWithValue:T::Boxed::fromCpp(*result)]
+                      : [DJIResult resultWithError:E::Boxed::fromCpp(result.error())];
+    }
+};
+
 template<class T>
 class List {
     using ECppType = typename T::CppType;
@@ -207,6 +319,63 @@ public:
     }
 };
 
+template<class T>
+class ListDelta {
+    using Op = typename ::djinni::list_delta<typename T::CppType>::op;
+    using Kind = typename ::djinni::list_delta<typename T::CppType>::kind;
+
+public:
+    using CppType = ::djinni::list_delta<typename T::CppType>;
+    using ObjcType = DJIListDelta*;
+
+    using Boxed = ListDelta;
+
+    static CppType toCpp(ObjcType delta) {
+        assert(delta);
+        auto c = CppType();
+        for(DJIListDeltaOp* op in delta.ops) {
+            c.push_back(Op { static_cast<Kind>(op.kind), op.index, op.count, List<T>::toCpp(op.objects) });
+        }
+        return c;
+    }
+
+    static ObjcType fromCpp(const CppType& c) {
+        auto delta = [[DJIListDelta alloc] init];
+        for(const auto& op : c.ops()) {
+            [delta appendOp:[DJIListDeltaOp opWithKind:static_cast<DJIListDeltaKind>(op.type)
+                                                 index:op.index
+                                                 count:op.count
+                                               objects:List<T>::fromCpp(op.values)]];
+        }
+        return delta;
+    }
+};
+
+// A list<T> parameter of primitive T with --cpp-span-params. The numbers are unboxed into
+// per-thread scratch memory, so steady-state calls allocate nothing. Only passed into C++.
+template<class T>
+class PrimitiveSpan {
+    using ECppType = typename T::CppType;
+    using EObjcType = typename T::Boxed::ObjcType;
+
+public:
+    using CppType = span<const ECppType>;
+    using ObjcType = NSArray*;
+
+    using Boxed = PrimitiveSpan;
+
+    static detail::borrowed_span<ECppType> toCpp(ObjcType array) {
+        assert(array);
+        const size_t size = static_cast<size_t>(array.count);
+        detail::scratch_buffer scratch(size * sizeof(ECppType));
+        auto elements = static_cast<ECppType*>(scratch.data());
+        for(EObjcType value in array) {
+            *elements++ = T::Boxed::toCpp(value);
+        }
+        return {std::move(scratch), size};
+    }
+};
+
 template<class T>
 class Set {
     using ECppType = typename T::CppType;
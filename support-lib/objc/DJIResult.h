@@ -0,0 +1,42 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Objective-C representation of the djinni IDL type `result<T, E>`: holds either a value of
+ * type `ValueType` or an error of type `ErrorType`. Errors are marshalled as ordinary values
+ * and are never raised as exceptions.
+ */
+@interface DJIResult<__covariant ValueType, __covariant ErrorType> : NSObject
+
++ (instancetype)resultWithValue:(ValueType)value;
++ (instancetype)resultWithError:(ErrorType)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) BOOL isOk;
+/** The value, or nil if this result holds an error. */
+@property (nonatomic, readonly, nullable) ValueType value;
+/** The error, or nil if this result holds a value. */
+@property (nonatomic, readonly, nullable) ErrorType error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,68 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#import "DJIResult.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@implementation DJIResult
+
+- (instancetype)initWithOk:(BOOL)isOk value:(id)value error:(id)error
+{
+    if (self = [super init]) {
+        _isOk = isOk;
+        _value = value;
+        _error = error;
+    }
+    return self;
+}
+
++ (instancetype)resultWithValue:(id)value
+{
+    NSParameterAssert(value);
+    return [[self alloc] initWithOk:YES value:value error:nil];
+}
+
++ (instancetype)resultWithError:(id)error
+{
+    NSParameterAssert(error);
+    return [[self alloc] initWithOk:NO value:nil error:error];
+}
+
+- (BOOL)isEqual:(id)other
+{
+    if (![other isKindOfClass:[DJIResult class]]) {
+        return NO;
+    }
+    DJIResult *typedOther = (DJIResult *)other;
+    return self.isOk == typedOther.isOk &&
+            (self.isOk ? [self.value isEqual:typedOther.value] : [self.error isEqual:typedOther.error]);
+}
+
+- (NSUInteger)hash
+{
+    return self.isOk ? [self.value hash] : ~[self.error hash];
+}
+
+- (NSString *)description
+{
+    return self.isOk
+        ? [NSString stringWithFormat:@"<%@ %p value:%@>", self.class, self, self.value]
+        : [NSString stringWithFormat:@"<%@ %p error:%@>", self.class, self, self.error];
+}
+
+@end
@@ -17,9 +17,14 @@
 #pragma once
 
 #include "proxy_cache_interface.hpp"
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <mutex>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 // """
 //    This place is not a place of honor.
@@ -43,6 +48,9 @@ template <typename T> static inline auto upgrade_weak(const T & ptr) -> decltype
 template <typename T> static inline T * upgrade_weak(T* ptr) { return ptr; }
 template <typename T> static inline bool is_expired(const T & ptr) { return ptr.expired(); }
 template <typename T> static inline bool is_expired(T* ptr) { return !ptr; }
+// Give up an owning proxy pointer that won't be returned. Smart pointers release it when
+// destroyed; wrapper types that don't (like the JNI `CppProxyRef`) overload this.
+template <typename T> static inline void release_owning(T &) {}
 
 /*
  * Generic proxy cache.
@@ -79,20 +87,52 @@ public:
         UnowningImplPointer ptr = get_unowning(impl);
         auto existing_proxy_iter = m_mapping.find(ptr);
         if (existing_proxy_iter != m_mapping.end()) {
-            OwningProxyPointer existing_proxy = upgrade_weak(existing_proxy_iter->second);
+            OwningProxyPointer existing_proxy = upgrade_weak(existing_proxy_iter->second.proxy);
             if (existing_proxy) {
+                ++m_hits;
                 return existing_proxy;
             } else {
                 // The weak reference is expired, so prune it from the map eagerly.
-                m_mapping.erase(existing_proxy_iter);
+                ++m_prunes;
+                erase(existing_proxy_iter);
             }
         }
 
+        ++m_misses;
         auto alloc_result = alloc(impl);
-        m_mapping.emplace(alloc_result.second, alloc_result.first);
+        m_mapping.emplace(std::piecewise_construct,
+                          std::forward_as_tuple(alloc_result.second),
+                          std::forward_as_tuple(alloc_result.first, alloc));
+        ++m_types[alloc].entries;
         return alloc_result.first;
     }
 
+    void get_batch(const OwningImplPointer * impls, size_t count, AllocatorFunction * alloc,
+                   BatchAllocatorFunction * alloc_batch, OwningProxyPointer * out) {
+        // Results are only moved into `out` once the whole batch has succeeded, so if the
+        // allocator or an upgrade throws, the proxies obtained so far are released here. Both
+        // vectors outlive the lock: dropping the last reference to a proxy calls remove().
+        std::vector<OwningProxyPointer> results(count);
+        std::vector<std::pair<OwningProxyPointer, UnowningImplPointer>> alloc_results;
+        try {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            get_batch_locked(impls, count, alloc, alloc_batch, results.data(), alloc_results);
+        } catch (...) {
+            for (auto & result : results) {
+                if (result) {
+                    release_owning(result);
+                }
+            }
+            for (auto & alloc_result : alloc_results) {
+                if (alloc_result.first) {
+                    release_owning(alloc_result.first);
+                }
+            }
+            throw;
+        }
+        std::move(results.begin(), results.end(), out);
+    }
+
     /*
      * Erase an object from the proxy cache.
      */
@@ -109,17 +149,124 @@ public:
             // that case, `it->second` will contain a live pointer to a different proxy object,
             // not an expired weak pointer to the Handle currently being destructed. We only
             // remove the map entry if its pointer is already expired.
-            if (is_expired(it->second)) {
-                m_mapping.erase(it);
+            if (is_expired(it->second.proxy)) {
+                erase(it);
             }
         }
     }
 
+    void set_type_name(AllocatorFunction * alloc, std::string name) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_types[alloc].name = std::move(name);
+    }
+
+    ProxyCacheStats stats() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ProxyCacheStats result { m_mapping.size(), m_live_handles.load(std::memory_order_relaxed),
+                                 m_hits, m_misses, m_prunes, {} };
+        for (const auto & kv : m_types) {
+            if (kv.second.entries) {
+                result.types.push_back({ kv.second.name.empty() ? "?" : kv.second.name,
+                                         kv.second.entries });
+            }
+        }
+        lock.unlock();
+        std::sort(result.types.begin(), result.types.end(),
+                  [] (const ProxyCacheTypeStats & a, const ProxyCacheTypeStats & b) {
+                      return a.entries != b.entries ? a.entries > b.entries : a.name < b.name;
+                  });
+        return result;
+    }
+
 private:
-    std::unordered_map<UnowningImplPointer,
-                       WeakProxyPointer,
-                       UnowningImplPointerHash,
-                       UnowningImplPointerEqual> m_mapping;
+    struct Entry {
+        Entry(const OwningProxyPointer & p, AllocatorFunction * a) : proxy(p), alloc(a) {}
+        WeakProxyPointer proxy;
+        // Identifies the proxy type for stats().
+        AllocatorFunction * alloc;
+    };
+
+    struct TypeEntry {
+        std::string name;
+        size_t entries = 0;
+    };
+
+    using Mapping = std::unordered_map<UnowningImplPointer,
+                                       Entry,
+                                       UnowningImplPointerHash,
+                                       UnowningImplPointerEqual>;
+
+    // Must be called with m_mutex held.
+    void get_batch_locked(const OwningImplPointer * impls, size_t count, AllocatorFunction * alloc,
+                          BatchAllocatorFunction * alloc_batch, OwningProxyPointer * out,
+                          std::vector<std::pair<OwningProxyPointer, UnowningImplPointer>> & alloc_results) {
+        // Indexes into `impls` of the first occurrence of each object that needs a proxy, and
+        // of any later occurrences of the same objects.
+        std::vector<size_t> missing;
+        std::vector<size_t> repeated;
+        std::unordered_set<UnowningImplPointer,
+                           UnowningImplPointerHash, UnowningImplPointerEqual> missing_set;
+        for (size_t i = 0; i != count; ++i) {
+            UnowningImplPointer ptr = get_unowning(impls[i]);
+            auto existing_proxy_iter = m_mapping.find(ptr);
+            if (existing_proxy_iter != m_mapping.end()) {
+                OwningProxyPointer existing_proxy = upgrade_weak(existing_proxy_iter->second.proxy);
+                if (existing_proxy) {
+                    ++m_hits;
+                    out[i] = std::move(existing_proxy);
+                    continue;
+                }
+                ++m_prunes;
+                erase(existing_proxy_iter);
+            }
+            if (missing_set.insert(ptr).second) {
+                missing.push_back(i);
+            } else {
+                repeated.push_back(i);
+            }
+        }
+        if (missing.empty()) {
+            return;
+        }
+
+        std::vector<OwningImplPointer> to_alloc;
+        to_alloc.reserve(missing.size());
+        for (size_t i : missing) {
+            to_alloc.push_back(impls[i]);
+        }
+        alloc_results.resize(missing.size());
+        alloc_batch(to_alloc.data(), to_alloc.size(), alloc_results.data());
+
+        m_misses += missing.size();
+        for (size_t k = 0; k != missing.size(); ++k) {
+            m_mapping.emplace(std::piecewise_construct,
+                              std::forward_as_tuple(alloc_results[k].second),
+                              std::forward_as_tuple(alloc_results[k].first, alloc));
+            out[missing[k]] = std::move(alloc_results[k].first);
+        }
+        m_types[alloc].entries += missing.size();
+        // Later occurrences are hits on the entries just added. Each gets its own owning
+        // pointer rather than a copy of the first one's, since for the JNI cache that's a local
+        // reference the caller deletes once per element.
+        m_hits += repeated.size();
+        for (size_t i : repeated) {
+            out[i] = upgrade_weak(m_mapping.find(get_unowning(impls[i]))->second.proxy);
+        }
+    }
+
+    // Must be called with m_mutex held.
+    void erase(typename Mapping::iterator it) {
+        --m_types[it->second.alloc].entries;
+        m_mapping.erase(it);
+    }
+
+    Mapping m_mapping;
+    std::unordered_map<AllocatorFunction *, TypeEntry> m_types;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_prunes = 0;
+    // Changed without m_mutex, by Handle constructors and destructors.
+    std::atomic<size_t> m_live_handles { 0 };
     std::mutex m_mutex;
 
     // Only ProxyCache<Traits>::get_base() can allocate these objects.
@@ -149,10 +296,40 @@ auto ProxyCache<Traits>::get_base() -> const std::shared_ptr<Pimpl> & {
     return instance;
 }
 
+template <typename Traits>
+auto ProxyCache<Traits>::attach_handle() -> const std::shared_ptr<Pimpl> & {
+    const auto & base = get_base();
+    base->m_live_handles.fetch_add(1, std::memory_order_relaxed);
+    return base;
+}
+
+template <typename Traits>
+void ProxyCache<Traits>::detach_handle(const std::shared_ptr<Pimpl> & base) {
+    base->m_live_handles.fetch_sub(1, std::memory_order_relaxed);
+}
+
 template <typename Traits>
 auto ProxyCache<Traits>::get(const OwningImplPointer & impl, AllocatorFunction * alloc)
         -> OwningProxyPointer {
     return get_base()->get(impl, alloc);
 }
 
+template <typename Traits>
+void ProxyCache<Traits>::get_batch(const OwningImplPointer * impls, size_t count,
+                                   AllocatorFunction * alloc,
+                                   BatchAllocatorFunction * alloc_batch,
+                                   OwningProxyPointer * out) {
+    get_base()->get_batch(impls, count, alloc, alloc_batch, out);
+}
+
+template <typename Traits>
+void ProxyCache<Traits>::set_type_name(AllocatorFunction * alloc, std::string name) {
+    get_base()->set_type_name(alloc, std::move(name));
+}
+
+template <typename Traits>
+ProxyCacheStats ProxyCache<Traits>::stats() {
+    return get_base()->stats();
+}
+
 } // namespace djinni
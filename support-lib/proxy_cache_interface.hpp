@@ -16,14 +16,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace djinni {
 
 /*
  * The template parameters we receive here can be a number of different types: C++ smart
  * pointers, custom wrappers, or language-specific types (like ObjC's `id` / `__weak id`).
- * If custom wrapper types are used, like the `JavaWeakRef` type in the JNI library, then
+ * If custom wrapper types are used, like the `CppProxyWeakRef` type in the JNI library, then
  * they must implement `.get()` or `.lock()` by analogy with C++'s smart pointers.
  *
  * We assume that built-in types are pointer-compatible. This is the case with ObjC: for
@@ -36,6 +40,29 @@ template <typename T> static inline auto get_unowning(const T & ptr) -> decltype
 }
 template <typename T> static inline T * get_unowning(T * ptr) { return ptr; }
 
+/*
+ * Point-in-time counters of one ProxyCache, see ProxyCache::stats().
+ *
+ * `entries` counts map entries, which briefly includes proxies that have died but whose Handle
+ * has not yet removed them. `live_handles` counts Handle objects, i.e. proxies that are still
+ * alive. A hit is a get() that found a live proxy, a miss one that had to allocate, and a prune
+ * a miss that also dropped an expired entry for the same object.
+ */
+struct ProxyCacheTypeStats {
+    std::string name;
+    size_t entries;
+};
+
+struct ProxyCacheStats {
+    size_t entries;
+    size_t live_handles;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t prunes;
+    // Entries per proxy type, largest first. Types without a name set are reported as "?".
+    std::vector<ProxyCacheTypeStats> types;
+};
+
 /*
  * ProxyCache provides a mechanism for re-using proxy objects generated in one language
  * that wrap around implementations in a different language. This is for correctness, not
@@ -116,10 +143,13 @@ public:
     class Handle {
     public:
         template <typename... Args> Handle(Args &&... args)
-            : m_cache(get_base()), m_obj(std::forward<Args>(args)...) {}
+            : m_cache(attach_handle()), m_obj(std::forward<Args>(args)...) {}
         Handle(const Handle &) = delete;
         Handle & operator=(const Handle &) = delete;
-        ~Handle() { if (m_obj) cleanup(m_cache, get_unowning(m_obj)); }
+        ~Handle() {
+            if (m_obj) cleanup(m_cache, get_unowning(m_obj));
+            detach_handle(m_cache);
+        }
 
         void assign(const T & obj) { m_obj = obj; }
 
@@ -158,8 +188,36 @@ public:
      */
     static OwningProxyPointer get(const OwningImplPointer & impl, AllocatorFunction * alloc);
 
+    /*
+     * Allocator for get_batch(): create proxies for `count` objects at once, storing in `out`
+     * what AllocatorFunction would have returned for each of them.
+     */
+    using BatchAllocatorFunction =
+        void(const OwningImplPointer * impls, size_t count,
+             std::pair<OwningProxyPointer, UnowningImplPointer> * out);
+
+    /*
+     * Like calling get() for each of `impls` and storing the results in `out`, but with a single
+     * lock, and with all objects missing from the cache passed to one call of `alloc_batch`
+     * (each object once, even if it occurs several times). `alloc` isn't called; it identifies
+     * the proxy type, so it must be the allocator get() is called with for the same type.
+     */
+    static void get_batch(const OwningImplPointer * impls, size_t count,
+                          AllocatorFunction * alloc, BatchAllocatorFunction * alloc_batch,
+                          OwningProxyPointer * out);
+
+    /*
+     * Name the proxies created by `alloc` in stats(). Meant to be called once per proxy type,
+     * e.g. when the language binding for an interface is initialized.
+     */
+    static void set_type_name(AllocatorFunction * alloc, std::string name);
+
+    static ProxyCacheStats stats();
+
 private:
     static void cleanup(const std::shared_ptr<Pimpl> &, UnowningImplPointer);
+    static const std::shared_ptr<Pimpl> & attach_handle();
+    static void detach_handle(const std::shared_ptr<Pimpl> &);
     static const std::shared_ptr<Pimpl> & get_base();
 };
 
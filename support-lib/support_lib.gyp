@@ -5,8 +5,25 @@
             "type": "static_library",
             "sources": [
               "djinni_common.hpp",
+              "djinni_expected.hpp",
+              "djinni_list_delta.hpp",
+              "djinni_mapped_region.hpp",
+              "djinni_native_memory.hpp",
+              "djinni_out_buffer.hpp",
+              "djinni_span.hpp",
+              "jni/djinni_handle.cpp",
+              "jni/djinni_jni_calls.cpp",
+              "jni/djinni_jni_calls.hpp",
+              "jni/djinni_mapped_region.cpp",
+              "jni/djinni_metrics.cpp",
+              "jni/djinni_metrics.hpp",
+              "jni/djinni_ref_stats.cpp",
+              "jni/djinni_ref_stats.hpp",
+              "jni/djinni_shared_binary.cpp",
               "jni/djinni_support.cpp",
               "jni/djinni_support.hpp",
+              "jni/djinni_tracing.cpp",
+              "jni/djinni_tracing.hpp",
               "jni/Marshal.hpp",
             ],
             "include_dirs": [
@@ -14,6 +31,7 @@
             ],
             "direct_dependent_settings": {
                 "include_dirs": [
+                  ".",
                   "jni",
                 ],
             },
@@ -28,9 +46,18 @@
               "objc/DJICppWrapperCache+Private.h",
               "objc/DJIError.h",
               "objc/DJIError.mm",
+              "objc/DJIListDelta.h",
+              "objc/DJIListDelta.mm",
               "objc/DJIMarshal+Private.h",
               "objc/DJIObjcWrapperCache+Private.h",
               "objc/DJIProxyCaches.mm",
+              "objc/DJIResult.h",
+              "objc/DJIResult.mm",
+              "djinni_expected.hpp",
+              "djinni_list_delta.hpp",
+              "djinni_mapped_region.hpp",
+              "djinni_out_buffer.hpp",
+              "djinni_span.hpp",
               "proxy_cache_impl.hpp",
               "proxy_cache_interface.hpp",
             ],
@@ -39,6 +66,7 @@
             ],
             "direct_dependent_settings": {
                 "include_dirs": [
+                  ".",
                   "objc",
                 ],
             },
@@ -0,0 +1,36 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace testsuite {
+
+/** Small calls that Java can make in bulk through BatchCounter.Batch */
+class BatchCounter {
+public:
+    virtual ~BatchCounter() {}
+
+    /** Ignored while disabled */
+    virtual void add(int32_t amount) = 0;
+
+    virtual int64_t total() = 0;
+
+    virtual void set_scale(float scale) = 0;
+
+    virtual double scaled_total() = 0;
+
+    virtual void set_enabled(bool enabled) = 0;
+
+    virtual bool is_enabled() = 0;
+
+    /** Not batched: returns a string */
+    virtual std::string describe() = 0;
+
+    static std::shared_ptr<BatchCounter> create();
+};
+
+}  // namespace testsuite
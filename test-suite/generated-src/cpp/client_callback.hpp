@@ -0,0 +1,18 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#pragma once
+
+#include <string>
+
+namespace testsuite {
+
+/** One-shot callback implemented by the client, not cached on the Java side */
+class ClientCallback {
+public:
+    virtual ~ClientCallback() {}
+
+    virtual void on_result(const std::string & result) = 0;
+};
+
+}  // namespace testsuite
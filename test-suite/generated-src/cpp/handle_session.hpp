@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace testsuite {
+
+/** C++ state that Java and Objective-C only hold on to and pass back, see handle<T> */
+class HandleSession {
+public:
+    virtual ~HandleSession() {}
+
+    virtual std::string name() = 0;
+
+    static std::shared_ptr<HandleSession> open(const std::string & name);
+
+    static std::string name_of(const std::shared_ptr<HandleSession> & session);
+
+    /** Number of sessions that haven't been destroyed yet */
+    static int32_t live_count();
+};
+
+}  // namespace testsuite
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace testsuite {
+
+/** Progress reported by C++, which doesn't wait for Java to handle it */
+class ProgressListener {
+public:
+    virtual ~ProgressListener() {}
+
+    virtual void started(const std::string & task) = 0;
+
+    /** Only the latest progress matters, so progress Java hasn't received yet is replaced */
+    virtual void progress(int32_t done, int32_t total) = 0;
+
+    virtual void finished() = 0;
+};
+
+}  // namespace testsuite
@@ -5,6 +5,8 @@
 
 #include "assorted_primitives.hpp"
 #include "color.hpp"
+#include "djinni_mapped_region.hpp"
+#include "djinni_out_buffer.hpp"
 #include "map_list_record.hpp"
 #include "nested_collection.hpp"
 #include "primitive_list.hpp"
@@ -18,7 +20,9 @@
 
 namespace testsuite {
 
+class ClientCallback;
 class ClientInterface;
+class ProgressListener;
 class UserToken;
 
 /**
@@ -64,6 +68,8 @@ public:
 
     static void check_client_interface_nonascii(const std::shared_ptr<ClientInterface> & i);
 
+    static void call_client_callback(const std::shared_ptr<ClientCallback> & cb, const std::string & result);
+
     static void check_enum_map(const std::unordered_map<color, std::string> & m);
 
     static void check_enum(color c);
@@ -72,18 +78,59 @@ public:
 
     static std::shared_ptr<UserToken> create_cpp_token();
 
+    static std::shared_ptr<UserToken> create_large_cpp_token(int64_t native_bytes);
+
     static void check_cpp_token(const std::shared_ptr<UserToken> & t);
 
     static int64_t cpp_token_id(const std::shared_ptr<UserToken> & t);
 
     static void check_token_type(const std::shared_ptr<UserToken> & t, const std::string & type);
 
+    static std::vector<std::shared_ptr<UserToken>> token_list_id(const std::vector<std::shared_ptr<UserToken>> & l);
+
+    static std::vector<std::shared_ptr<UserToken>> create_cpp_token_list(int32_t count);
+
+    /** One new C++ token, `count` times */
+    static std::vector<std::shared_ptr<UserToken>> create_repeated_cpp_token_list(int32_t count);
+
+    static void hold_callback(const std::shared_ptr<ClientCallback> & cb);
+
+    static void release_held_callback_on_native_thread();
+
+    static void hold_token(const std::shared_ptr<UserToken> & t);
+
+    static void release_held_token_on_native_thread();
+
     static std::experimental::optional<int32_t> return_none();
 
     /** Ensures that we generate integer translation code */
     static AssortedPrimitives assorted_primitives_id(const AssortedPrimitives & i);
 
     static std::vector<uint8_t> id_binary(const std::vector<uint8_t> & b);
+
+    static std::shared_ptr<const std::vector<uint8_t>> id_shared_binary(const std::shared_ptr<const std::vector<uint8_t>> & b);
+
+    static std::shared_ptr<const std::vector<uint8_t>> create_shared_binary(int32_t size);
+
+    /** Address of the bytes, to check that they weren't copied */
+    static int64_t shared_binary_data(const std::shared_ptr<const std::vector<uint8_t>> & b);
+
+    static ::djinni::mapped_region map_file_region(const std::string & path, int64_t offset, int64_t length);
+
+    /** Sum of the bytes, read in C++ */
+    static int64_t mapped_region_sum(const ::djinni::mapped_region & region);
+
+    /** Address of the bytes, to check that they weren't copied */
+    static int64_t mapped_region_data(const ::djinni::mapped_region & region);
+
+    /** Writes bytes 0, 1, 2, ... into buf, or returns the size needed if it doesn't fit */
+    static int32_t fill_out_buffer(::djinni::out_buffer buf, int32_t size);
+
+    /** Appends s to strings; both are moved into the implementation rather than copied */
+    static std::vector<std::string> append_string(std::vector<std::string> strings, std::string s);
+
+    /** Reports a task of the given number of steps to the listener */
+    static void report_progress(const std::shared_ptr<ProgressListener> & listener, const std::string & task, int32_t steps);
 };
 
 }  // namespace testsuite
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+#pragma once
+
+#include "djinni_list_delta.hpp"
+#include <string>
+#include <vector>
+
+namespace testsuite {
+
+/** Lists updated through deltas instead of being copied whole. */
+class TestListDelta {
+public:
+    virtual ~TestListDelta() {}
+
+    /** Applies delta to list in C++ */
+    static std::vector<std::string> apply(const std::vector<std::string> & list, const ::djinni::list_delta<std::string> & delta);
+
+    /** Edits list through an observable_list and returns the recorded delta */
+    static ::djinni::list_delta<std::string> edit(const std::vector<std::string> & list);
+};
+
+}  // namespace testsuite
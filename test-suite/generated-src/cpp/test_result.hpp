@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from result.djinni
+
+#pragma once
+
+#include "djinni_expected.hpp"
+#include <cstdint>
+#include <string>
+
+namespace testsuite {
+
+/** Errors returned as values instead of being thrown. */
+class TestResult {
+public:
+    virtual ~TestResult() {}
+
+    static ::djinni::expected<std::string, int32_t> make_ok(const std::string & value);
+
+    static ::djinni::expected<std::string, int32_t> make_error(int32_t code);
+
+    static std::string describe(const ::djinni::expected<std::string, int32_t> & res);
+
+    /** Throws unless an expected<T, E> assignment whose move constructor throws leaves its target unchanged */
+    static void check_throwing_move_assignment();
+};
+
+}  // namespace testsuite
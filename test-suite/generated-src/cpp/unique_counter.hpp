@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace testsuite {
+
+/** Owned by the one proxy it's returned to, without reference counting or a proxy cache */
+class UniqueCounter {
+public:
+    virtual ~UniqueCounter() {}
+
+    virtual int32_t increment() = 0;
+
+    static std::unique_ptr<UniqueCounter> create(int32_t start);
+
+    /** Number of counters that haven't been destroyed yet */
+    static int32_t live_count();
+};
+
+}  // namespace testsuite
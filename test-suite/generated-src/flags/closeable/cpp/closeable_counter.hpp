@@ -0,0 +1,26 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace testsuite {
+
+/** Generated with --java-closeable-interfaces, so its Java class implements AutoCloseable */
+class CloseableCounter {
+public:
+    virtual ~CloseableCounter() {}
+
+    virtual void add(int32_t amount) = 0;
+
+    virtual int64_t total() = 0;
+
+    static std::shared_ptr<CloseableCounter> create();
+
+    /** Number of counters that haven't been destroyed yet */
+    static int32_t live_count();
+};
+
+}  // namespace testsuite
@@ -0,0 +1,23 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace testsuite {
+
+class CloseableUniqueCounter {
+public:
+    virtual ~CloseableUniqueCounter() {}
+
+    virtual int32_t increment() = 0;
+
+    static std::unique_ptr<CloseableUniqueCounter> create(int32_t start);
+
+    /** Number of counters that haven't been destroyed yet */
+    static int32_t live_count();
+};
+
+}  // namespace testsuite
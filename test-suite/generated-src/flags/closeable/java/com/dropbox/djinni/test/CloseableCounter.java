@@ -0,0 +1,124 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CallBatch;
+import com.dropbox.djinni.CppProxyRegistry;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Generated with --java-closeable-interfaces, so its Java class implements AutoCloseable */
+public abstract class CloseableCounter implements AutoCloseable {
+    public abstract void add(int amount);
+
+    public abstract long total();
+
+    @CheckForNull
+    public static native CloseableCounter create();
+
+    /** Number of counters that haven't been destroyed yet */
+    public static native int liveCount();
+
+    /**
+     * Releases the C++ object behind this instance now instead of when it is
+     * garbage collected. Afterwards, calling its methods throws
+     * IllegalStateException, and it must not be passed to native code. Must not
+     * race with calls on other threads. Closing twice does nothing, as does
+     * closing an object implemented in Java unless it overrides this method.
+     */
+    @Override
+    public void close() {}
+
+    private static final class CppProxy extends CloseableCounter
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        @Override
+        public void close()
+        {
+            destroy();
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+
+        @Override
+        public void add(int amount)
+        {
+            if (this.destroyed.get()) throw new IllegalStateException("trying to use a closed object");
+            native_add(this.nativeRef, amount);
+        }
+        private native void native_add(long _nativeRef, int amount);
+
+        @Override
+        public long total()
+        {
+            if (this.destroyed.get()) throw new IllegalStateException("trying to use a closed object");
+            return native_total(this.nativeRef);
+        }
+        private native long native_total(long _nativeRef);
+    }
+
+    /**
+     * Records calls to the methods of a C++ object that take and return only
+     * primitives, and makes them all in one native call when run. Methods that
+     * return a value return a ticket for looking it up in the results instead.
+     */
+    public static final class Batch extends CallBatch
+    {
+        private final CppProxy target;
+
+        public Batch(CloseableCounter target)
+        {
+            if (!(target instanceof CppProxy)) throw new IllegalArgumentException("target is not implemented in C++");
+            this.target = (CppProxy) target;
+        }
+
+        public void add(int amount)
+        {
+            call(0);
+            putLong(amount);
+        }
+
+        public int total()
+        {
+            return callForResult(1);
+        }
+
+        @Override
+        protected void runNative(long[] calls, int size, long[] results)
+        {
+            if (target.destroyed.get()) throw new IllegalStateException("trying to use a closed object");
+            nativeRun(target.nativeRef, calls, size, results);
+        }
+        private static native void nativeRun(long nativeRef, long[] calls, int size, long[] results);
+    }
+}
@@ -0,0 +1,67 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class CloseableUniqueCounter implements AutoCloseable {
+    public abstract int increment();
+
+    @CheckForNull
+    public static native CloseableUniqueCounter create(int start);
+
+    /** Number of counters that haven't been destroyed yet */
+    public static native int liveCount();
+
+    /**
+     * Releases the C++ object behind this instance now instead of when it is
+     * garbage collected. Afterwards, calling its methods throws
+     * IllegalStateException, and it must not be passed to native code. Must not
+     * race with calls on other threads. Closing twice does nothing, as does
+     * closing an object implemented in Java unless it overrides this method.
+     */
+    @Override
+    public void close() {}
+
+    private static final class CppProxy extends CloseableUniqueCounter
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        @Override
+        public void close()
+        {
+            destroy();
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+
+        @Override
+        public int increment()
+        {
+            if (this.destroyed.get()) throw new IllegalStateException("trying to use a closed object");
+            return native_increment(this.nativeRef);
+        }
+        private native int native_increment(long _nativeRef);
+    }
+}
@@ -0,0 +1,98 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#include "NativeCloseableCounter.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeCloseableCounter.hpp"
+
+namespace djinni_generated {
+
+NativeCloseableCounter::NativeCloseableCounter() : ::djinni::JniInterface<::testsuite::CloseableCounter, NativeCloseableCounter>("com/dropbox/djinni/test/CloseableCounter$CppProxy") {}
+
+NativeCloseableCounter::~NativeCloseableCounter() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CloseableCounter_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::CloseableCounter>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CloseableCounter_00024CppProxy_native_1add(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_amount)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::CloseableCounter>(nativeRef);
+        auto c_amount = ::djinni::I32::toCpp(jniEnv, j_amount);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ref->add(c_amount);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_CloseableCounter_00024CppProxy_native_1total(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::CloseableCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->total();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_CloseableCounter_create(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::CloseableCounter::create();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeCloseableCounter::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_CloseableCounter_liveCount(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::CloseableCounter::live_count();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CloseableCounter_00024Batch_nativeRun(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlongArray j_calls, jint j_size, jlongArray j_results)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::CloseableCounter>(nativeRef);
+        ::djinni::JniCallBatch batch(jniEnv, j_calls, j_size, j_results);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        while (!batch.done()) {
+            switch (batch.method()) {
+                case 0: {
+                    auto c_amount = ::djinni::I32::toCpp(jniEnv, batch.arg<jint>());
+                    ref->add(c_amount);
+                    break;
+                }
+                case 1: {
+                    batch.result(::djinni::I64::fromCpp(jniEnv, ref->total()));
+                    break;
+                }
+                default:
+                    DJINNI_ASSERT_MSG(false, jniEnv, "unknown method in call batch");
+            }
+        }
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        batch.finish();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "closeable_counter.hpp"
+
+namespace djinni_generated {
+
+class NativeCloseableCounter final : ::djinni::JniInterface<::testsuite::CloseableCounter, NativeCloseableCounter> {
+public:
+    using CppType = std::shared_ptr<::testsuite::CloseableCounter>;
+    using JniType = jobject;
+
+    using Boxed = NativeCloseableCounter;
+
+    ~NativeCloseableCounter();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeCloseableCounter>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeCloseableCounter>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeCloseableCounter>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeCloseableCounter>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeCloseableCounter();
+    friend ::djinni::JniClass<NativeCloseableCounter>;
+    friend ::djinni::JniInterface<::testsuite::CloseableCounter, NativeCloseableCounter>;
+
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,60 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#include "NativeCloseableUniqueCounter.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeCloseableUniqueCounter.hpp"
+
+namespace djinni_generated {
+
+NativeCloseableUniqueCounter::NativeCloseableUniqueCounter() : ::djinni::JniUniqueInterface<::testsuite::CloseableUniqueCounter, NativeCloseableUniqueCounter>("com/dropbox/djinni/test/CloseableUniqueCounter$CppProxy") {}
+
+NativeCloseableUniqueCounter::~NativeCloseableUniqueCounter() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CloseableUniqueCounter_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete ::djinni::objectFromUniqueHandleAddress<::testsuite::CloseableUniqueCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_CloseableUniqueCounter_00024CppProxy_native_1increment(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromUniqueHandleAddress<::testsuite::CloseableUniqueCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->increment();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_CloseableUniqueCounter_create(JNIEnv* jniEnv, jobject /*this*/, jint j_start)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_start = ::djinni::I32::toCpp(jniEnv, j_start);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::CloseableUniqueCounter::create(c_start);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeCloseableUniqueCounter::fromCpp(jniEnv, std::move(r)));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_CloseableUniqueCounter_liveCount(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::CloseableUniqueCounter::live_count();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "closeable_unique_counter.hpp"
+
+namespace djinni_generated {
+
+class NativeCloseableUniqueCounter final : ::djinni::JniUniqueInterface<::testsuite::CloseableUniqueCounter, NativeCloseableUniqueCounter> {
+public:
+    using CppType = std::unique_ptr<::testsuite::CloseableUniqueCounter>;
+    using JniType = jobject;
+
+    using Boxed = NativeCloseableUniqueCounter;
+
+    ~NativeCloseableUniqueCounter();
+
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, CppType c) { return {jniEnv, ::djinni::JniClass<NativeCloseableUniqueCounter>::get()._toJava(jniEnv, std::move(c))}; }
+
+private:
+    NativeCloseableUniqueCounter();
+    friend ::djinni::JniClass<NativeCloseableUniqueCounter>;
+    friend ::djinni::JniUniqueInterface<::testsuite::CloseableUniqueCounter, NativeCloseableUniqueCounter>;
+
+};
+
+}  // namespace djinni_generated
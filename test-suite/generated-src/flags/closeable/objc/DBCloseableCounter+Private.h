@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#include "closeable_counter.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBCloseableCounter;
+
+namespace djinni_generated {
+
+class CloseableCounter
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::CloseableCounter>;
+    using ObjcType = DBCloseableCounter*;
+
+    using Boxed = CloseableCounter;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
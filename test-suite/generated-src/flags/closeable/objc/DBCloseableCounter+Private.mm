@@ -0,0 +1,80 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#import "DBCloseableCounter+Private.h"
+#import "DBCloseableCounter.h"
+#import "DBCloseableCounter+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBCloseableCounter ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::CloseableCounter>&)cppRef;
+
+@end
+
+@implementation DBCloseableCounter {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::CloseableCounter>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::CloseableCounter>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (void)add:(int32_t)amount {
+    try {
+        _cppRefHandle.get()->add(::djinni::I32::toCpp(amount));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (int64_t)total {
+    try {
+        auto r = _cppRefHandle.get()->total();
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable DBCloseableCounter *)create {
+    try {
+        auto r = ::testsuite::CloseableCounter::create();
+        return ::djinni_generated::CloseableCounter::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int32_t)liveCount {
+    try {
+        auto r = ::testsuite::CloseableCounter::live_count();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto CloseableCounter::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto CloseableCounter::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBCloseableCounter>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
@@ -0,0 +1,20 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#import <Foundation/Foundation.h>
+@class DBCloseableCounter;
+
+
+/** Generated with --java-closeable-interfaces, so its Java class implements AutoCloseable */
+@interface DBCloseableCounter : NSObject
+
+- (void)add:(int32_t)amount;
+
+- (int64_t)total;
+
++ (nullable DBCloseableCounter *)create;
+
+/** Number of counters that haven't been destroyed yet */
++ (int32_t)liveCount;
+
+@end
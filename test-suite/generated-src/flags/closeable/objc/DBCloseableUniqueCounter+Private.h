@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#include "closeable_unique_counter.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBCloseableUniqueCounter;
+
+namespace djinni_generated {
+
+class CloseableUniqueCounter
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::CloseableUniqueCounter>;
+    using ObjcType = DBCloseableUniqueCounter*;
+
+    using Boxed = CloseableUniqueCounter;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
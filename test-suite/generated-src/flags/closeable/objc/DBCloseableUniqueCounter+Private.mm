@@ -0,0 +1,74 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#import "DBCloseableUniqueCounter+Private.h"
+#import "DBCloseableUniqueCounter.h"
+#import "DBCloseableUniqueCounter+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBCloseableUniqueCounter ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::CloseableUniqueCounter>&)cppRef;
+
+@end
+
+@implementation DBCloseableUniqueCounter {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::CloseableUniqueCounter>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::CloseableUniqueCounter>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (int32_t)increment {
+    try {
+        auto r = _cppRefHandle.get()->increment();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable DBCloseableUniqueCounter *)create:(int32_t)start {
+    try {
+        auto r = ::testsuite::CloseableUniqueCounter::create(::djinni::I32::toCpp(start));
+        return ::djinni_generated::CloseableUniqueCounter::fromCpp(std::move(r));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int32_t)liveCount {
+    try {
+        auto r = ::testsuite::CloseableUniqueCounter::live_count();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto CloseableUniqueCounter::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto CloseableUniqueCounter::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBCloseableUniqueCounter>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
@@ -0,0 +1,17 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from closeable.djinni
+
+#import <Foundation/Foundation.h>
+@class DBCloseableUniqueCounter;
+
+
+@interface DBCloseableUniqueCounter : NSObject
+
+- (int32_t)increment;
+
++ (nullable DBCloseableUniqueCounter *)create:(int32_t)start;
+
+/** Number of counters that haven't been destroyed yet */
++ (int32_t)liveCount;
+
+@end
@@ -0,0 +1,35 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#pragma once
+
+#include "flat_point.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace testsuite {
+
+class FlatArgsCallback;
+
+/** Records and dates passed across JNI as primitive arguments */
+class FlatArgs {
+public:
+    virtual ~FlatArgs() {}
+
+    /** Returns p moved by (dx, dy) */
+    virtual FlatPoint translate(const FlatPoint & p, double dx, double dy) = 0;
+
+    static std::shared_ptr<FlatArgs> create();
+
+    /** Returns d moved by the given number of milliseconds */
+    static std::chrono::system_clock::time_point later(const std::chrono::system_clock::time_point & d, int64_t millis);
+
+    /** Calls cb.translate() from C++ */
+    static FlatPoint translate_with(const std::shared_ptr<FlatArgsCallback> & cb, const FlatPoint & p, double dx, double dy);
+
+    /** Calls cb.later() from C++ */
+    static std::chrono::system_clock::time_point later_with(const std::shared_ptr<FlatArgsCallback> & cb, const std::chrono::system_clock::time_point & d, int64_t millis);
+};
+
+}  // namespace testsuite
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#pragma once
+
+#include "flat_point.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace testsuite {
+
+/** Implemented in Java and called from C++ with flattened arguments */
+class FlatArgsCallback {
+public:
+    virtual ~FlatArgsCallback() {}
+
+    /** Returns p moved by (dx, dy) */
+    virtual FlatPoint translate(const FlatPoint & p, double dx, double dy) = 0;
+
+    /** Returns d moved by the given number of milliseconds */
+    virtual std::chrono::system_clock::time_point later(const std::chrono::system_clock::time_point & d, int64_t millis) = 0;
+};
+
+}  // namespace testsuite
@@ -0,0 +1,22 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#pragma once
+
+#include <utility>
+
+namespace testsuite {
+
+/** Passed to and from Java as two doubles with --jni-flatten-args */
+struct FlatPoint final {
+    double x;
+    double y;
+
+    FlatPoint(double x_,
+              double y_)
+    : x(std::move(x_))
+    , y(std::move(y_))
+    {}
+};
+
+}  // namespace testsuite
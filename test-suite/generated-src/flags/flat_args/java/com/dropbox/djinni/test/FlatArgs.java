@@ -0,0 +1,87 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CppProxyRegistry;
+import java.util.Date;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Records and dates passed across JNI as primitive arguments */
+public abstract class FlatArgs {
+    /** Returns p moved by (dx, dy) */
+    @Nonnull
+    public abstract FlatPoint translate(@Nonnull FlatPoint p, double dx, double dy);
+
+    @CheckForNull
+    public static native FlatArgs create();
+
+    /** Returns d moved by the given number of milliseconds */
+    @Nonnull
+    public static Date later(@Nonnull Date d, long millis)
+    {
+        return native_later(d.getTime(), millis);
+    }
+    private static native Date native_later(long dMillis, long millis);
+
+    /** Calls cb.translate() from C++ */
+    @Nonnull
+    public static FlatPoint translateWith(@CheckForNull FlatArgsCallback cb, @Nonnull FlatPoint p, double dx, double dy)
+    {
+        return native_translateWith(cb, p.getX(), p.getY(), dx, dy);
+    }
+    private static native FlatPoint native_translateWith(FlatArgsCallback cb, double pX, double pY, double dx, double dy);
+
+    /** Calls cb.later() from C++ */
+    @Nonnull
+    public static Date laterWith(@CheckForNull FlatArgsCallback cb, @Nonnull Date d, long millis)
+    {
+        return native_laterWith(cb, d.getTime(), millis);
+    }
+    private static native Date native_laterWith(FlatArgsCallback cb, long dMillis, long millis);
+
+    private static final class CppProxy extends FlatArgs
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+
+        @Override
+        public FlatPoint translate(FlatPoint p, double dx, double dy)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_translate(this.nativeRef, p.getX(), p.getY(), dx, dy);
+        }
+        private native FlatPoint native_translate(long _nativeRef, double pX, double pY, double dx, double dy);
+    }
+}
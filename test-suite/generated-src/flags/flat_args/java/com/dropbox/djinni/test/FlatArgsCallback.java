@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.Date;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Implemented in Java and called from C++ with flattened arguments */
+public abstract class FlatArgsCallback {
+    /** Returns p moved by (dx, dy) */
+    @Nonnull
+    public abstract FlatPoint translate(@Nonnull FlatPoint p, double dx, double dy);
+
+    private FlatPoint translateFlat(double pX, double pY, double dx, double dy)
+    {
+        return translate(new FlatPoint(pX, pY), dx, dy);
+    }
+
+    /** Returns d moved by the given number of milliseconds */
+    @Nonnull
+    public abstract Date later(@Nonnull Date d, long millis);
+
+    private Date laterFlat(long dMillis, long millis)
+    {
+        return later(new Date(dMillis), millis);
+    }
+}
@@ -0,0 +1,40 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Passed to and from Java as two doubles with --jni-flatten-args */
+public final class FlatPoint {
+
+
+    /*package*/ final double mX;
+
+    /*package*/ final double mY;
+
+    public FlatPoint(
+            double x,
+            double y) {
+        this.mX = x;
+        this.mY = y;
+    }
+
+    public double getX() {
+        return mX;
+    }
+
+    public double getY() {
+        return mY;
+    }
+
+    @Override
+    public String toString() {
+        return "FlatPoint{" +
+                "mX=" + mX +
+                "," + "mY=" + mY +
+        "}";
+    }
+
+}
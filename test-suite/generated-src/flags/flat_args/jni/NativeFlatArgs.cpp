@@ -0,0 +1,95 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#include "NativeFlatArgs.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeFlatArgs.hpp"
+#include "NativeFlatArgsCallback.hpp"
+#include "NativeFlatPoint.hpp"
+
+namespace djinni_generated {
+
+NativeFlatArgs::NativeFlatArgs() : ::djinni::JniInterface<::testsuite::FlatArgs, NativeFlatArgs>("com/dropbox/djinni/test/FlatArgs$CppProxy") {}
+
+NativeFlatArgs::~NativeFlatArgs() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_FlatArgs_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::FlatArgs>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatArgs_00024CppProxy_native_1translate(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jdouble j_pX, jdouble j_pY, jdouble j_dx, jdouble j_dy)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::FlatArgs>(nativeRef);
+        auto c_p = ::testsuite::FlatPoint(::djinni::F64::toCpp(jniEnv, j_pX), ::djinni::F64::toCpp(jniEnv, j_pY));
+        auto c_dx = ::djinni::F64::toCpp(jniEnv, j_dx);
+        auto c_dy = ::djinni::F64::toCpp(jniEnv, j_dy);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->translate(c_p, c_dx, c_dy);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeFlatPoint::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatArgs_create(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::FlatArgs::create();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeFlatArgs::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatArgs_native_1later(JNIEnv* jniEnv, jobject /*this*/, jlong j_dMillis, jlong j_millis)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_d = ::djinni::Date::fromMillis(j_dMillis);
+        auto c_millis = ::djinni::I64::toCpp(jniEnv, j_millis);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::FlatArgs::later(c_d, c_millis);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Date::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatArgs_native_1translateWith(JNIEnv* jniEnv, jobject /*this*/, jobject j_cb, jdouble j_pX, jdouble j_pY, jdouble j_dx, jdouble j_dy)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_cb = ::djinni_generated::NativeFlatArgsCallback::toCpp(jniEnv, j_cb);
+        auto c_p = ::testsuite::FlatPoint(::djinni::F64::toCpp(jniEnv, j_pX), ::djinni::F64::toCpp(jniEnv, j_pY));
+        auto c_dx = ::djinni::F64::toCpp(jniEnv, j_dx);
+        auto c_dy = ::djinni::F64::toCpp(jniEnv, j_dy);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::FlatArgs::translate_with(c_cb, c_p, c_dx, c_dy);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeFlatPoint::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatArgs_native_1laterWith(JNIEnv* jniEnv, jobject /*this*/, jobject j_cb, jlong j_dMillis, jlong j_millis)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_cb = ::djinni_generated::NativeFlatArgsCallback::toCpp(jniEnv, j_cb);
+        auto c_d = ::djinni::Date::fromMillis(j_dMillis);
+        auto c_millis = ::djinni::I64::toCpp(jniEnv, j_millis);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::FlatArgs::later_with(c_cb, c_d, c_millis);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Date::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "flat_args.hpp"
+
+namespace djinni_generated {
+
+class NativeFlatArgs final : ::djinni::JniInterface<::testsuite::FlatArgs, NativeFlatArgs> {
+public:
+    using CppType = std::shared_ptr<::testsuite::FlatArgs>;
+    using JniType = jobject;
+
+    using Boxed = NativeFlatArgs;
+
+    ~NativeFlatArgs();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeFlatArgs>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeFlatArgs>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeFlatArgs>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeFlatArgs>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeFlatArgs();
+    friend ::djinni::JniClass<NativeFlatArgs>;
+    friend ::djinni::JniInterface<::testsuite::FlatArgs, NativeFlatArgs>;
+
+};
+
+}  // namespace djinni_generated
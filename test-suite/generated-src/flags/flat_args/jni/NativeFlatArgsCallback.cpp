@@ -0,0 +1,53 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#include "NativeFlatArgsCallback.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeFlatPoint.hpp"
+
+namespace djinni_generated {
+
+NativeFlatArgsCallback::NativeFlatArgsCallback() : ::djinni::JniInterface<::testsuite::FlatArgsCallback, NativeFlatArgsCallback>() {}
+
+NativeFlatArgsCallback::~NativeFlatArgsCallback() = default;
+
+NativeFlatArgsCallback::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+NativeFlatArgsCallback::JavaProxy::~JavaProxy() = default;
+
+::testsuite::FlatPoint NativeFlatArgsCallback::JavaProxy::translate(const ::testsuite::FlatPoint & c_p, double c_dx, double c_dy) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.FlatArgsCallback.translate");
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeFlatArgsCallback>::get();
+    auto j_pX = ::djinni::F64::fromCpp(jniEnv, c_p.x);
+    auto j_pY = ::djinni::F64::fromCpp(jniEnv, c_p.y);
+    auto j_dx = ::djinni::F64::fromCpp(jniEnv, c_dx);
+    auto j_dy = ::djinni::F64::fromCpp(jniEnv, c_dy);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+    auto jret = jniEnv->CallObjectMethod(Handle::get().get(), data.method_translate,
+                                         ::djinni::get(j_pX),
+                                         ::djinni::get(j_pY),
+                                         ::djinni::get(j_dx),
+                                         ::djinni::get(j_dy));
+    ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
+    return ::djinni_generated::NativeFlatPoint::toCpp(jniEnv, jret);
+}
+std::chrono::system_clock::time_point NativeFlatArgsCallback::JavaProxy::later(const std::chrono::system_clock::time_point & c_d, int64_t c_millis) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.FlatArgsCallback.later");
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeFlatArgsCallback>::get();
+    auto j_dMillis = ::djinni::Date::toMillis(c_d);
+    auto j_millis = ::djinni::I64::fromCpp(jniEnv, c_millis);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+    auto jret = jniEnv->CallObjectMethod(Handle::get().get(), data.method_later,
+                                         ::djinni::get(j_dMillis),
+                                         ::djinni::get(j_millis));
+    ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
+    return ::djinni::Date::toCpp(jniEnv, jret);
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "flat_args_callback.hpp"
+
+namespace djinni_generated {
+
+class NativeFlatArgsCallback final : ::djinni::JniInterface<::testsuite::FlatArgsCallback, NativeFlatArgsCallback> {
+public:
+    using CppType = std::shared_ptr<::testsuite::FlatArgsCallback>;
+    using JniType = jobject;
+
+    using Boxed = NativeFlatArgsCallback;
+
+    ~NativeFlatArgsCallback();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeFlatArgsCallback>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeFlatArgsCallback>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeFlatArgsCallback>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeFlatArgsCallback>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeFlatArgsCallback();
+    friend ::djinni::JniClass<NativeFlatArgsCallback>;
+    friend ::djinni::JniInterface<::testsuite::FlatArgsCallback, NativeFlatArgsCallback>;
+
+    class JavaProxy final : ::djinni::JavaProxyCacheEntry, public ::testsuite::FlatArgsCallback
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        ::testsuite::FlatPoint translate(const ::testsuite::FlatPoint & p, double dx, double dy) override;
+        std::chrono::system_clock::time_point later(const std::chrono::system_clock::time_point & d, int64_t millis) override;
+
+    private:
+        friend ::djinni::JniInterface<::testsuite::FlatArgsCallback, ::djinni_generated::NativeFlatArgsCallback>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/FlatArgsCallback") };
+    const jmethodID method_translate { ::djinni::jniGetMethodID(clazz.get(), "translateFlat", "(DDDD)Lcom/dropbox/djinni/test/FlatPoint;") };
+    const jmethodID method_later { ::djinni::jniGetMethodID(clazz.get(), "laterFlat", "(JJ)Ljava/util/Date;") };
+};
+
+}  // namespace djinni_generated
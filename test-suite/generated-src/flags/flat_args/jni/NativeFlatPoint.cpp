@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#include "NativeFlatPoint.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeFlatPoint::NativeFlatPoint() = default;
+
+NativeFlatPoint::~NativeFlatPoint() = default;
+
+auto NativeFlatPoint::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    const auto& data = ::djinni::JniClass<NativeFlatPoint>::get();
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::F64::fromCpp(jniEnv, c.x)),
+                                                           ::djinni::get(::djinni::F64::fromCpp(jniEnv, c.y)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeFlatPoint::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    assert(j != nullptr);
+    const auto& data = ::djinni::JniClass<NativeFlatPoint>::get();
+    return {::djinni::F64::toCpp(jniEnv, jniEnv->GetDoubleField(j, data.field_mX)),
+            ::djinni::F64::toCpp(jniEnv, jniEnv->GetDoubleField(j, data.field_mY))};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,33 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "flat_point.hpp"
+
+namespace djinni_generated {
+
+class NativeFlatPoint final {
+public:
+    using CppType = ::testsuite::FlatPoint;
+    using JniType = jobject;
+
+    using Boxed = NativeFlatPoint;
+
+    ~NativeFlatPoint();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+
+private:
+    NativeFlatPoint();
+    friend ::djinni::JniClass<NativeFlatPoint>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/FlatPoint") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(DD)V") };
+    const jfieldID field_mX { ::djinni::jniGetFieldID(clazz.get(), "mX", "D") };
+    const jfieldID field_mY { ::djinni::jniGetFieldID(clazz.get(), "mY", "D") };
+};
+
+}  // namespace djinni_generated
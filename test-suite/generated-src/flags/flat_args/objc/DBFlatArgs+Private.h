@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#include "flat_args.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBFlatArgs;
+
+namespace djinni_generated {
+
+class FlatArgs
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::FlatArgs>;
+    using ObjcType = DBFlatArgs*;
+
+    using Boxed = FlatArgs;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,106 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatArgs+Private.h"
+#import "DBFlatArgs.h"
+#import "DBFlatArgs+Private.h"
+#import "DBFlatArgsCallback+Private.h"
+#import "DBFlatPoint+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBFlatArgs ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::FlatArgs>&)cppRef;
+
+@end
+
+@implementation DBFlatArgs {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::FlatArgs>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::FlatArgs>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (nonnull DBFlatPoint *)translate:(nonnull DBFlatPoint *)p
+                                dx:(double)dx
+                                dy:(double)dy {
+    try {
+        auto r = _cppRefHandle.get()->translate(::djinni_generated::FlatPoint::toCpp(p),
+                                                ::djinni::F64::toCpp(dx),
+                                                ::djinni::F64::toCpp(dy));
+        return ::djinni_generated::FlatPoint::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable DBFlatArgs *)create {
+    try {
+        auto r = ::testsuite::FlatArgs::create();
+        return ::djinni_generated::FlatArgs::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSDate *)later:(nonnull NSDate *)d
+                   millis:(int64_t)millis {
+    try {
+        auto r = ::testsuite::FlatArgs::later(::djinni::Date::toCpp(d),
+                                              ::djinni::I64::toCpp(millis));
+        return ::djinni::Date::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull DBFlatPoint *)translateWith:(nullable id<DBFlatArgsCallback>)cb
+                                     p:(nonnull DBFlatPoint *)p
+                                    dx:(double)dx
+                                    dy:(double)dy {
+    try {
+        auto r = ::testsuite::FlatArgs::translate_with(::djinni_generated::FlatArgsCallback::toCpp(cb),
+                                                       ::djinni_generated::FlatPoint::toCpp(p),
+                                                       ::djinni::F64::toCpp(dx),
+                                                       ::djinni::F64::toCpp(dy));
+        return ::djinni_generated::FlatPoint::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSDate *)laterWith:(nullable id<DBFlatArgsCallback>)cb
+                            d:(nonnull NSDate *)d
+                       millis:(int64_t)millis {
+    try {
+        auto r = ::testsuite::FlatArgs::later_with(::djinni_generated::FlatArgsCallback::toCpp(cb),
+                                                   ::djinni::Date::toCpp(d),
+                                                   ::djinni::I64::toCpp(millis));
+        return ::djinni::Date::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto FlatArgs::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto FlatArgs::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBFlatArgs>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
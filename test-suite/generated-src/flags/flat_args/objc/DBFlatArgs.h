@@ -0,0 +1,35 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatPoint.h"
+#import <Foundation/Foundation.h>
+@class DBFlatArgs;
+@protocol DBFlatArgsCallback;
+
+
+/** Records and dates passed across JNI as primitive arguments */
+@interface DBFlatArgs : NSObject
+
+/** Returns p moved by (dx, dy) */
+- (nonnull DBFlatPoint *)translate:(nonnull DBFlatPoint *)p
+                                dx:(double)dx
+                                dy:(double)dy;
+
++ (nullable DBFlatArgs *)create;
+
+/** Returns d moved by the given number of milliseconds */
++ (nonnull NSDate *)later:(nonnull NSDate *)d
+                   millis:(int64_t)millis;
+
+/** Calls cb.translate() from C++ */
++ (nonnull DBFlatPoint *)translateWith:(nullable id<DBFlatArgsCallback>)cb
+                                     p:(nonnull DBFlatPoint *)p
+                                    dx:(double)dx
+                                    dy:(double)dy;
+
+/** Calls cb.later() from C++ */
++ (nonnull NSDate *)laterWith:(nullable id<DBFlatArgsCallback>)cb
+                            d:(nonnull NSDate *)d
+                       millis:(int64_t)millis;
+
+@end
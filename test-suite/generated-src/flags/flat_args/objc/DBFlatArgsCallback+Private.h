@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#include "flat_args_callback.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBFlatArgsCallback;
+
+namespace djinni_generated {
+
+class FlatArgsCallback
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::FlatArgsCallback>;
+    using ObjcType = id<DBFlatArgsCallback>;
+
+    using Boxed = FlatArgsCallback;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,59 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatArgsCallback+Private.h"
+#import "DBFlatArgsCallback.h"
+#import "DBFlatPoint+Private.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class FlatArgsCallback::ObjcProxy final
+: public ::testsuite::FlatArgsCallback
+, public ::djinni::ObjcProxyCache::Handle<ObjcType>
+{
+public:
+    using Handle::Handle;
+    ::testsuite::FlatPoint translate(const ::testsuite::FlatPoint & c_p, double c_dx, double c_dy) override
+    {
+        @autoreleasepool {
+            auto r = [Handle::get() translate:(::djinni_generated::FlatPoint::fromCpp(c_p))
+                                           dx:(::djinni::F64::fromCpp(c_dx))
+                                           dy:(::djinni::F64::fromCpp(c_dy))];
+            return ::djinni_generated::FlatPoint::toCpp(r);
+        }
+    }
+    std::chrono::system_clock::time_point later(const std::chrono::system_clock::time_point & c_d, int64_t c_millis) override
+    {
+        @autoreleasepool {
+            auto r = [Handle::get() later:(::djinni::Date::fromCpp(c_d))
+                                   millis:(::djinni::I64::fromCpp(c_millis))];
+            return ::djinni::Date::toCpp(r);
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto FlatArgsCallback::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::get_objc_proxy<ObjcProxy>(objc);
+}
+
+auto FlatArgsCallback::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,20 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatPoint.h"
+#import <Foundation/Foundation.h>
+
+
+/** Implemented in Java and called from C++ with flattened arguments */
+@protocol DBFlatArgsCallback
+
+/** Returns p moved by (dx, dy) */
+- (nonnull DBFlatPoint *)translate:(nonnull DBFlatPoint *)p
+                                dx:(double)dx
+                                dy:(double)dy;
+
+/** Returns d moved by the given number of milliseconds */
+- (nonnull NSDate *)later:(nonnull NSDate *)d
+                   millis:(int64_t)millis;
+
+@end
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatPoint.h"
+#include "flat_point.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBFlatPoint;
+
+namespace djinni_generated {
+
+struct FlatPoint
+{
+    using CppType = ::testsuite::FlatPoint;
+    using ObjcType = DBFlatPoint*;
+
+    using Boxed = FlatPoint;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,23 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatPoint+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto FlatPoint::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::F64::toCpp(obj.x),
+            ::djinni::F64::toCpp(obj.y)};
+}
+
+auto FlatPoint::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBFlatPoint alloc] initWithX:(::djinni::F64::fromCpp(cpp.x))
+                                        y:(::djinni::F64::fromCpp(cpp.y))];
+}
+
+}  // namespace djinni_generated
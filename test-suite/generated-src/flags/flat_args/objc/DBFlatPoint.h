@@ -0,0 +1,17 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import <Foundation/Foundation.h>
+
+/** Passed to and from Java as two doubles with --jni-flatten-args */
+@interface DBFlatPoint : NSObject
+- (nonnull instancetype)initWithX:(double)x
+                                y:(double)y;
++ (nonnull instancetype)flatPointWithX:(double)x
+                                     y:(double)y;
+
+@property (nonatomic, readonly) double x;
+
+@property (nonatomic, readonly) double y;
+
+@end
@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_args.djinni
+
+#import "DBFlatPoint.h"
+
+
+@implementation DBFlatPoint
+
+- (nonnull instancetype)initWithX:(double)x
+                                y:(double)y
+{
+    if (self = [super init]) {
+        _x = x;
+        _y = y;
+    }
+    return self;
+}
+
++ (nonnull instancetype)flatPointWithX:(double)x
+                                     y:(double)y
+{
+    return [[self alloc] initWithX:x
+                                 y:y];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p x:%@ y:%@>", self.class, self, @(self.x), @(self.y)];
+}
+
+@end
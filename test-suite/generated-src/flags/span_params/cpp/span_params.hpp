@@ -0,0 +1,22 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+#pragma once
+
+#include "djinni_span.hpp"
+#include <cstdint>
+
+namespace testsuite {
+
+/** Generated with --cpp-span-params, so C++ borrows primitive list parameters as spans */
+class SpanParams {
+public:
+    virtual ~SpanParams() {}
+
+    static int64_t sum_i32_list(::djinni::span<const int32_t> values);
+
+    /** Borrows two spans at once */
+    static double dot_f64_lists(::djinni::span<const double> a, ::djinni::span<const double> b);
+};
+
+}  // namespace testsuite
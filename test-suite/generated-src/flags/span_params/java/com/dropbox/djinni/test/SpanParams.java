@@ -0,0 +1,52 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CppProxyRegistry;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Generated with --cpp-span-params, so C++ borrows primitive list parameters as spans */
+public abstract class SpanParams {
+    public static native long sumI32List(@Nonnull int[] values);
+
+    /** Borrows two spans at once */
+    public static native double dotF64Lists(@Nonnull double[] a, @Nonnull double[] b);
+
+    private static final class CppProxy extends SpanParams
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+    }
+}
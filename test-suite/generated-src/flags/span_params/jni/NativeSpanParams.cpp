@@ -0,0 +1,49 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+#include "NativeSpanParams.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeSpanParams::NativeSpanParams() : ::djinni::JniInterface<::testsuite::SpanParams, NativeSpanParams>("com/dropbox/djinni/test/SpanParams$CppProxy") {}
+
+NativeSpanParams::~NativeSpanParams() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_SpanParams_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::SpanParams>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_SpanParams_sumI32List(JNIEnv* jniEnv, jobject /*this*/, jintArray j_values)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_values = ::djinni::PrimitiveSpan<::djinni::I32>::toCpp(jniEnv, j_values);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::SpanParams::sum_i32_list(c_values);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jdouble JNICALL Java_com_dropbox_djinni_test_SpanParams_dotF64Lists(JNIEnv* jniEnv, jobject /*this*/, jdoubleArray j_a, jdoubleArray j_b)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_a = ::djinni::PrimitiveSpan<::djinni::F64>::toCpp(jniEnv, j_a);
+        auto c_b = ::djinni::PrimitiveSpan<::djinni::F64>::toCpp(jniEnv, j_b);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::SpanParams::dot_f64_lists(c_a, c_b);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::F64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "span_params.hpp"
+
+namespace djinni_generated {
+
+class NativeSpanParams final : ::djinni::JniInterface<::testsuite::SpanParams, NativeSpanParams> {
+public:
+    using CppType = std::shared_ptr<::testsuite::SpanParams>;
+    using JniType = jobject;
+
+    using Boxed = NativeSpanParams;
+
+    ~NativeSpanParams();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeSpanParams>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeSpanParams>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeSpanParams>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeSpanParams>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeSpanParams();
+    friend ::djinni::JniClass<NativeSpanParams>;
+    friend ::djinni::JniInterface<::testsuite::SpanParams, NativeSpanParams>;
+
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+#include "span_params.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBSpanParams;
+
+namespace djinni_generated {
+
+class SpanParams
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::SpanParams>;
+    using ObjcType = DBSpanParams*;
+
+    using Boxed = SpanParams;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
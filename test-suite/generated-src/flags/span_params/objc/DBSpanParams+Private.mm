@@ -0,0 +1,68 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+#import "DBSpanParams+Private.h"
+#import "DBSpanParams.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBSpanParams ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::SpanParams>&)cppRef;
+
+@end
+
+@implementation DBSpanParams {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::SpanParams>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::SpanParams>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (int64_t)sumI32List:(nonnull NSArray<NSNumber *> *)values {
+    try {
+        auto r = ::testsuite::SpanParams::sum_i32_list(::djinni::PrimitiveSpan<::djinni::I32>::toCpp(values));
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (double)dotF64Lists:(nonnull NSArray<NSNumber *> *)a
+                    b:(nonnull NSArray<NSNumber *> *)b {
+    try {
+        auto r = ::testsuite::SpanParams::dot_f64_lists(::djinni::PrimitiveSpan<::djinni::F64>::toCpp(a),
+                                                        ::djinni::PrimitiveSpan<::djinni::F64>::toCpp(b));
+        return ::djinni::F64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto SpanParams::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto SpanParams::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBSpanParams>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from span_params.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** Generated with --cpp-span-params, so C++ borrows primitive list parameters as spans */
+@interface DBSpanParams : NSObject
+
++ (int64_t)sumI32List:(nonnull NSArray<NSNumber *> *)values;
+
+/** Borrows two spans at once */
++ (double)dotF64Lists:(nonnull NSArray<NSNumber *> *)a
+                    b:(nonnull NSArray<NSNumber *> *)b;
+
+@end
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <experimental/string_view>
+#include <string>
+
+namespace testsuite {
+
+/** Generated with --cpp-string-view-params, so C++ receives string parameters as views */
+class StringViewParams {
+public:
+    virtual ~StringViewParams() {}
+
+    /** Length of s in UTF-8 bytes, as seen by C++ */
+    static int32_t utf8_length(std::experimental::string_view s);
+
+    /** Returns s, copied into a std::string by the implementation */
+    static std::string echo(std::experimental::string_view s);
+};
+
+}  // namespace testsuite
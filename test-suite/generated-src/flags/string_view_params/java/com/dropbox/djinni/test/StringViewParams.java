@@ -0,0 +1,54 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CppProxyRegistry;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Generated with --cpp-string-view-params, so C++ receives string parameters as views */
+public abstract class StringViewParams {
+    /** Length of s in UTF-8 bytes, as seen by C++ */
+    public static native int utf8Length(@Nonnull String s);
+
+    /** Returns s, copied into a std::string by the implementation */
+    @Nonnull
+    public static native String echo(@Nonnull String s);
+
+    private static final class CppProxy extends StringViewParams
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+    }
+}
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+#include "NativeStringViewParams.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeStringViewParams::NativeStringViewParams() : ::djinni::JniInterface<::testsuite::StringViewParams, NativeStringViewParams>("com/dropbox/djinni/test/StringViewParams$CppProxy") {}
+
+NativeStringViewParams::~NativeStringViewParams() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_StringViewParams_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::StringViewParams>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_StringViewParams_utf8Length(JNIEnv* jniEnv, jobject /*this*/, jstring j_s)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_s = ::djinni::StringView<std::experimental::string_view>::toCpp(jniEnv, j_s);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::StringViewParams::utf8_length(c_s);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_StringViewParams_echo(JNIEnv* jniEnv, jobject /*this*/, jstring j_s)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_s = ::djinni::StringView<std::experimental::string_view>::toCpp(jniEnv, j_s);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::StringViewParams::echo(c_s);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
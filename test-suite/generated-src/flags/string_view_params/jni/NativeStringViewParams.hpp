@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "string_view_params.hpp"
+
+namespace djinni_generated {
+
+class NativeStringViewParams final : ::djinni::JniInterface<::testsuite::StringViewParams, NativeStringViewParams> {
+public:
+    using CppType = std::shared_ptr<::testsuite::StringViewParams>;
+    using JniType = jobject;
+
+    using Boxed = NativeStringViewParams;
+
+    ~NativeStringViewParams();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeStringViewParams>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeStringViewParams>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeStringViewParams>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeStringViewParams>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeStringViewParams();
+    friend ::djinni::JniClass<NativeStringViewParams>;
+    friend ::djinni::JniInterface<::testsuite::StringViewParams, NativeStringViewParams>;
+
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+#include "string_view_params.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBStringViewParams;
+
+namespace djinni_generated {
+
+class StringViewParams
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::StringViewParams>;
+    using ObjcType = DBStringViewParams*;
+
+    using Boxed = StringViewParams;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,66 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+#import "DBStringViewParams+Private.h"
+#import "DBStringViewParams.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBStringViewParams ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::StringViewParams>&)cppRef;
+
+@end
+
+@implementation DBStringViewParams {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::StringViewParams>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::StringViewParams>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (int32_t)utf8Length:(nonnull NSString *)s {
+    try {
+        auto r = ::testsuite::StringViewParams::utf8_length(::djinni::StringView<std::experimental::string_view>::toCpp(s));
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSString *)echo:(nonnull NSString *)s {
+    try {
+        auto r = ::testsuite::StringViewParams::echo(::djinni::StringView<std::experimental::string_view>::toCpp(s));
+        return ::djinni::String::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto StringViewParams::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto StringViewParams::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBStringViewParams>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from string_view_params.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** Generated with --cpp-string-view-params, so C++ receives string parameters as views */
+@interface DBStringViewParams : NSObject
+
+/** Length of s in UTF-8 bytes, as seen by C++ */
++ (int32_t)utf8Length:(nonnull NSString *)s;
+
+/** Returns s, copied into a std::string by the implementation */
++ (nonnull NSString *)echo:(nonnull NSString *)s;
+
+@end
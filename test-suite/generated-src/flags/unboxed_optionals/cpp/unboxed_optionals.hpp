@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#pragma once
+
+#include "unboxed_optionals_record.hpp"
+#include <cstdint>
+#include <experimental/optional>
+#include <memory>
+
+namespace testsuite {
+
+class UnboxedOptionalsCallback;
+
+/** Generated with --jni-unboxed-optionals, so optional primitives cross JNI as a flag and a value */
+class UnboxedOptionals {
+public:
+    virtual ~UnboxedOptionals() {}
+
+    static UnboxedOptionalsRecord record_id(const UnboxedOptionalsRecord & rec);
+
+    /** Returns v times factor, or nothing if either is missing */
+    static std::experimental::optional<double> scale(std::experimental::optional<double> v, std::experimental::optional<int32_t> factor);
+
+    /** Calls cb.scale() from C++ */
+    static std::experimental::optional<double> scale_with(const std::shared_ptr<UnboxedOptionalsCallback> & cb, std::experimental::optional<double> v, std::experimental::optional<int32_t> factor);
+};
+
+}  // namespace testsuite
@@ -0,0 +1,20 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <experimental/optional>
+
+namespace testsuite {
+
+/** Implemented in Java and called from C++ with unboxed optional arguments */
+class UnboxedOptionalsCallback {
+public:
+    virtual ~UnboxedOptionalsCallback() {}
+
+    /** Returns v times factor, or nothing if either is missing */
+    virtual std::experimental::optional<double> scale(std::experimental::optional<double> v, std::experimental::optional<int32_t> factor) = 0;
+};
+
+}  // namespace testsuite
@@ -0,0 +1,33 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <experimental/optional>
+#include <string>
+#include <utility>
+
+namespace testsuite {
+
+struct UnboxedOptionalsRecord final {
+    int32_t count;
+    std::experimental::optional<bool> o_flag;
+    std::experimental::optional<int64_t> o_total;
+    std::experimental::optional<double> o_ratio;
+    std::experimental::optional<std::string> o_name;
+
+    UnboxedOptionalsRecord(int32_t count_,
+                           std::experimental::optional<bool> o_flag_,
+                           std::experimental::optional<int64_t> o_total_,
+                           std::experimental::optional<double> o_ratio_,
+                           std::experimental::optional<std::string> o_name_)
+    : count(std::move(count_))
+    , o_flag(std::move(o_flag_))
+    , o_total(std::move(o_total_))
+    , o_ratio(std::move(o_ratio_))
+    , o_name(std::move(o_name_))
+    {}
+};
+
+}  // namespace testsuite
@@ -0,0 +1,66 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CppProxyRegistry;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Generated with --jni-unboxed-optionals, so optional primitives cross JNI as a flag and a value */
+public abstract class UnboxedOptionals {
+    @Nonnull
+    public static native UnboxedOptionalsRecord recordId(@Nonnull UnboxedOptionalsRecord rec);
+
+    /** Returns v times factor, or nothing if either is missing */
+    @CheckForNull
+    public static Double scale(@CheckForNull Double v, @CheckForNull Integer factor)
+    {
+        return native_scale(v != null, v != null ? v : 0, factor != null, factor != null ? factor : 0);
+    }
+    private static native Double native_scale(boolean hasV, double v, boolean hasFactor, int factor);
+
+    /** Calls cb.scale() from C++ */
+    @CheckForNull
+    public static Double scaleWith(@CheckForNull UnboxedOptionalsCallback cb, @CheckForNull Double v, @CheckForNull Integer factor)
+    {
+        return native_scaleWith(cb, v != null, v != null ? v : 0, factor != null, factor != null ? factor : 0);
+    }
+    private static native Double native_scaleWith(UnboxedOptionalsCallback cb, boolean hasV, double v, boolean hasFactor, int factor);
+
+    private static final class CppProxy extends UnboxedOptionals
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+    }
+}
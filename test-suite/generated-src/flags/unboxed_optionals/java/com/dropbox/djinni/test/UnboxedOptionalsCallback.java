@@ -0,0 +1,19 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Implemented in Java and called from C++ with unboxed optional arguments */
+public abstract class UnboxedOptionalsCallback {
+    /** Returns v times factor, or nothing if either is missing */
+    @CheckForNull
+    public abstract Double scale(@CheckForNull Double v, @CheckForNull Integer factor);
+
+    private Double scaleFlat(boolean hasV, double v, boolean hasFactor, int factor)
+    {
+        return scale(hasV ? v : null, hasFactor ? factor : null);
+    }
+}
@@ -0,0 +1,95 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class UnboxedOptionalsRecord {
+
+
+    /*package*/ final int mCount;
+
+    /*package*/ final boolean mHasOFlag;
+    /*package*/ final boolean mOFlag;
+
+    /*package*/ final boolean mHasOTotal;
+    /*package*/ final long mOTotal;
+
+    /*package*/ final boolean mHasORatio;
+    /*package*/ final double mORatio;
+
+    /*package*/ final String mOName;
+
+    public UnboxedOptionalsRecord(
+            int count,
+            @CheckForNull Boolean oFlag,
+            @CheckForNull Long oTotal,
+            @CheckForNull Double oRatio,
+            @CheckForNull String oName) {
+        this.mCount = count;
+        this.mHasOFlag = oFlag != null;
+        this.mOFlag = oFlag != null ? oFlag : false;
+        this.mHasOTotal = oTotal != null;
+        this.mOTotal = oTotal != null ? oTotal : 0;
+        this.mHasORatio = oRatio != null;
+        this.mORatio = oRatio != null ? oRatio : 0;
+        this.mOName = oName;
+    }
+
+    /*package*/ UnboxedOptionalsRecord(
+            int count,
+            boolean hasOFlag,
+            boolean oFlag,
+            boolean hasOTotal,
+            long oTotal,
+            boolean hasORatio,
+            double oRatio,
+            @CheckForNull String oName) {
+        this.mCount = count;
+        this.mHasOFlag = hasOFlag;
+        this.mOFlag = oFlag;
+        this.mHasOTotal = hasOTotal;
+        this.mOTotal = oTotal;
+        this.mHasORatio = hasORatio;
+        this.mORatio = oRatio;
+        this.mOName = oName;
+    }
+
+    public int getCount() {
+        return mCount;
+    }
+
+    @CheckForNull
+    public Boolean getOFlag() {
+        return mHasOFlag ? mOFlag : null;
+    }
+
+    @CheckForNull
+    public Long getOTotal() {
+        return mHasOTotal ? mOTotal : null;
+    }
+
+    @CheckForNull
+    public Double getORatio() {
+        return mHasORatio ? mORatio : null;
+    }
+
+    @CheckForNull
+    public String getOName() {
+        return mOName;
+    }
+
+    @Override
+    public String toString() {
+        return "UnboxedOptionalsRecord{" +
+                "mCount=" + mCount +
+                "," + "mOFlag=" + (mHasOFlag ? mOFlag : null) +
+                "," + "mOTotal=" + (mHasOTotal ? mOTotal : null) +
+                "," + "mORatio=" + (mHasORatio ? mORatio : null) +
+                "," + "mOName=" + mOName +
+        "}";
+    }
+
+}
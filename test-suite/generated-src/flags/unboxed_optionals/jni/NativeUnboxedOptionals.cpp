@@ -0,0 +1,65 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#include "NativeUnboxedOptionals.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeUnboxedOptionalsCallback.hpp"
+#include "NativeUnboxedOptionalsRecord.hpp"
+
+namespace djinni_generated {
+
+NativeUnboxedOptionals::NativeUnboxedOptionals() : ::djinni::JniInterface<::testsuite::UnboxedOptionals, NativeUnboxedOptionals>("com/dropbox/djinni/test/UnboxedOptionals$CppProxy") {}
+
+NativeUnboxedOptionals::~NativeUnboxedOptionals() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_UnboxedOptionals_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::UnboxedOptionals>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_UnboxedOptionals_recordId(JNIEnv* jniEnv, jobject /*this*/, jobject j_rec)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_rec = ::djinni_generated::NativeUnboxedOptionalsRecord::toCpp(jniEnv, j_rec);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::UnboxedOptionals::record_id(c_rec);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeUnboxedOptionalsRecord::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_UnboxedOptionals_native_1scale(JNIEnv* jniEnv, jobject /*this*/, jboolean j_hasV, jdouble j_v, jboolean j_hasFactor, jint j_factor)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_v = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::toCpp(jniEnv, j_hasV, j_v);
+        auto c_factor = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I32>::toCpp(jniEnv, j_hasFactor, j_factor);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::UnboxedOptionals::scale(c_v, c_factor);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_UnboxedOptionals_native_1scaleWith(JNIEnv* jniEnv, jobject /*this*/, jobject j_cb, jboolean j_hasV, jdouble j_v, jboolean j_hasFactor, jint j_factor)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_cb = ::djinni_generated::NativeUnboxedOptionalsCallback::toCpp(jniEnv, j_cb);
+        auto c_v = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::toCpp(jniEnv, j_hasV, j_v);
+        auto c_factor = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I32>::toCpp(jniEnv, j_hasFactor, j_factor);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::UnboxedOptionals::scale_with(c_cb, c_v, c_factor);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
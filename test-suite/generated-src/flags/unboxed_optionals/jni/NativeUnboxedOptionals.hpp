@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "unboxed_optionals.hpp"
+
+namespace djinni_generated {
+
+class NativeUnboxedOptionals final : ::djinni::JniInterface<::testsuite::UnboxedOptionals, NativeUnboxedOptionals> {
+public:
+    using CppType = std::shared_ptr<::testsuite::UnboxedOptionals>;
+    using JniType = jobject;
+
+    using Boxed = NativeUnboxedOptionals;
+
+    ~NativeUnboxedOptionals();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeUnboxedOptionals>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeUnboxedOptionals>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeUnboxedOptionals>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeUnboxedOptionals>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeUnboxedOptionals();
+    friend ::djinni::JniClass<NativeUnboxedOptionals>;
+    friend ::djinni::JniInterface<::testsuite::UnboxedOptionals, NativeUnboxedOptionals>;
+
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,37 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#include "NativeUnboxedOptionalsCallback.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeUnboxedOptionalsCallback::NativeUnboxedOptionalsCallback() : ::djinni::JniInterface<::testsuite::UnboxedOptionalsCallback, NativeUnboxedOptionalsCallback>() {}
+
+NativeUnboxedOptionalsCallback::~NativeUnboxedOptionalsCallback() = default;
+
+NativeUnboxedOptionalsCallback::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+NativeUnboxedOptionalsCallback::JavaProxy::~JavaProxy() = default;
+
+std::experimental::optional<double> NativeUnboxedOptionalsCallback::JavaProxy::scale(std::experimental::optional<double> c_v, std::experimental::optional<int32_t> c_factor) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.UnboxedOptionalsCallback.scale");
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeUnboxedOptionalsCallback>::get();
+    auto j_hasV = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::present(c_v);
+    auto j_v = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::fromCpp(jniEnv, c_v);
+    auto j_hasFactor = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I32>::present(c_factor);
+    auto j_factor = ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I32>::fromCpp(jniEnv, c_factor);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+    auto jret = jniEnv->CallObjectMethod(Handle::get().get(), data.method_scale,
+                                         ::djinni::get(j_hasV),
+                                         ::djinni::get(j_v),
+                                         ::djinni::get(j_hasFactor),
+                                         ::djinni::get(j_factor));
+    ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
+    return ::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(jniEnv, jret);
+}
+
+}  // namespace djinni_generated
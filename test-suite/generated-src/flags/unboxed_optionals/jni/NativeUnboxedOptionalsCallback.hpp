@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "unboxed_optionals_callback.hpp"
+
+namespace djinni_generated {
+
+class NativeUnboxedOptionalsCallback final : ::djinni::JniInterface<::testsuite::UnboxedOptionalsCallback, NativeUnboxedOptionalsCallback> {
+public:
+    using CppType = std::shared_ptr<::testsuite::UnboxedOptionalsCallback>;
+    using JniType = jobject;
+
+    using Boxed = NativeUnboxedOptionalsCallback;
+
+    ~NativeUnboxedOptionalsCallback();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeUnboxedOptionalsCallback>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeUnboxedOptionalsCallback>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeUnboxedOptionalsCallback>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeUnboxedOptionalsCallback>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeUnboxedOptionalsCallback();
+    friend ::djinni::JniClass<NativeUnboxedOptionalsCallback>;
+    friend ::djinni::JniInterface<::testsuite::UnboxedOptionalsCallback, NativeUnboxedOptionalsCallback>;
+
+    class JavaProxy final : ::djinni::JavaProxyCacheEntry, public ::testsuite::UnboxedOptionalsCallback
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        std::experimental::optional<double> scale(std::experimental::optional<double> v, std::experimental::optional<int32_t> factor) override;
+
+    private:
+        friend ::djinni::JniInterface<::testsuite::UnboxedOptionalsCallback, ::djinni_generated::NativeUnboxedOptionalsCallback>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/UnboxedOptionalsCallback") };
+    const jmethodID method_scale { ::djinni::jniGetMethodID(clazz.get(), "scaleFlat", "(ZDZI)Ljava/lang/Double;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#include "NativeUnboxedOptionalsRecord.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeUnboxedOptionalsRecord::NativeUnboxedOptionalsRecord() = default;
+
+NativeUnboxedOptionalsRecord::~NativeUnboxedOptionalsRecord() = default;
+
+auto NativeUnboxedOptionalsRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    const auto& data = ::djinni::JniClass<NativeUnboxedOptionalsRecord>::get();
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.count)),
+                                                           ::djinni::get(::djinni::UnboxedOptional<std::experimental::optional, ::djinni::Bool>::present(c.o_flag)),
+                                                           ::djinni::get(::djinni::UnboxedOptional<std::experimental::optional, ::djinni::Bool>::fromCpp(jniEnv, c.o_flag)),
+                                                           ::djinni::get(::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I64>::present(c.o_total)),
+                                                           ::djinni::get(::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I64>::fromCpp(jniEnv, c.o_total)),
+                                                           ::djinni::get(::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::present(c.o_ratio)),
+                                                           ::djinni::get(::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::fromCpp(jniEnv, c.o_ratio)),
+                                                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(jniEnv, c.o_name)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeUnboxedOptionalsRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, 6);
+    assert(j != nullptr);
+    const auto& data = ::djinni::JniClass<NativeUnboxedOptionalsRecord>::get();
+    return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mCount)),
+            ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::Bool>::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mHasOFlag), jniEnv->GetBooleanField(j, data.field_mOFlag)),
+            ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::I64>::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mHasOTotal), jniEnv->GetLongField(j, data.field_mOTotal)),
+            ::djinni::UnboxedOptional<std::experimental::optional, ::djinni::F64>::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mHasORatio), jniEnv->GetDoubleField(j, data.field_mORatio)),
+            ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mOName))};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "unboxed_optionals_record.hpp"
+
+namespace djinni_generated {
+
+class NativeUnboxedOptionalsRecord final {
+public:
+    using CppType = ::testsuite::UnboxedOptionalsRecord;
+    using JniType = jobject;
+
+    using Boxed = NativeUnboxedOptionalsRecord;
+
+    ~NativeUnboxedOptionalsRecord();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+
+private:
+    NativeUnboxedOptionalsRecord();
+    friend ::djinni::JniClass<NativeUnboxedOptionalsRecord>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/UnboxedOptionalsRecord") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(IZZZJZDLjava/lang/String;)V") };
+    const jfieldID field_mCount { ::djinni::jniGetFieldID(clazz.get(), "mCount", "I") };
+    const jfieldID field_mHasOFlag { ::djinni::jniGetFieldID(clazz.get(), "mHasOFlag", "Z") };
+    const jfieldID field_mOFlag { ::djinni::jniGetFieldID(clazz.get(), "mOFlag", "Z") };
+    const jfieldID field_mHasOTotal { ::djinni::jniGetFieldID(clazz.get(), "mHasOTotal", "Z") };
+    const jfieldID field_mOTotal { ::djinni::jniGetFieldID(clazz.get(), "mOTotal", "J") };
+    const jfieldID field_mHasORatio { ::djinni::jniGetFieldID(clazz.get(), "mHasORatio", "Z") };
+    const jfieldID field_mORatio { ::djinni::jniGetFieldID(clazz.get(), "mORatio", "D") };
+    const jfieldID field_mOName { ::djinni::jniGetFieldID(clazz.get(), "mOName", "Ljava/lang/String;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#include "unboxed_optionals.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBUnboxedOptionals;
+
+namespace djinni_generated {
+
+class UnboxedOptionals
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::UnboxedOptionals>;
+    using ObjcType = DBUnboxedOptionals*;
+
+    using Boxed = UnboxedOptionals;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
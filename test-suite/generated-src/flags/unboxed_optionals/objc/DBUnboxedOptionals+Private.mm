@@ -0,0 +1,81 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import "DBUnboxedOptionals+Private.h"
+#import "DBUnboxedOptionals.h"
+#import "DBUnboxedOptionalsCallback+Private.h"
+#import "DBUnboxedOptionalsRecord+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBUnboxedOptionals ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::UnboxedOptionals>&)cppRef;
+
+@end
+
+@implementation DBUnboxedOptionals {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::UnboxedOptionals>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::UnboxedOptionals>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nonnull DBUnboxedOptionalsRecord *)recordId:(nonnull DBUnboxedOptionalsRecord *)rec {
+    try {
+        auto r = ::testsuite::UnboxedOptionals::record_id(::djinni_generated::UnboxedOptionalsRecord::toCpp(rec));
+        return ::djinni_generated::UnboxedOptionalsRecord::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable NSNumber *)scale:(nullable NSNumber *)v
+                      factor:(nullable NSNumber *)factor {
+    try {
+        auto r = ::testsuite::UnboxedOptionals::scale(::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(v),
+                                                      ::djinni::Optional<std::experimental::optional, ::djinni::I32>::toCpp(factor));
+        return ::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable NSNumber *)scaleWith:(nullable id<DBUnboxedOptionalsCallback>)cb
+                               v:(nullable NSNumber *)v
+                          factor:(nullable NSNumber *)factor {
+    try {
+        auto r = ::testsuite::UnboxedOptionals::scale_with(::djinni_generated::UnboxedOptionalsCallback::toCpp(cb),
+                                                           ::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(v),
+                                                           ::djinni::Optional<std::experimental::optional, ::djinni::I32>::toCpp(factor));
+        return ::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto UnboxedOptionals::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto UnboxedOptionals::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBUnboxedOptionals>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
@@ -0,0 +1,23 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import "DBUnboxedOptionalsRecord.h"
+#import <Foundation/Foundation.h>
+@protocol DBUnboxedOptionalsCallback;
+
+
+/** Generated with --jni-unboxed-optionals, so optional primitives cross JNI as a flag and a value */
+@interface DBUnboxedOptionals : NSObject
+
++ (nonnull DBUnboxedOptionalsRecord *)recordId:(nonnull DBUnboxedOptionalsRecord *)rec;
+
+/** Returns v times factor, or nothing if either is missing */
++ (nullable NSNumber *)scale:(nullable NSNumber *)v
+                      factor:(nullable NSNumber *)factor;
+
+/** Calls cb.scale() from C++ */
++ (nullable NSNumber *)scaleWith:(nullable id<DBUnboxedOptionalsCallback>)cb
+                               v:(nullable NSNumber *)v
+                          factor:(nullable NSNumber *)factor;
+
+@end
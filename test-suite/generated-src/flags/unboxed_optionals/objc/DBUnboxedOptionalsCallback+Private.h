@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#include "unboxed_optionals_callback.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBUnboxedOptionalsCallback;
+
+namespace djinni_generated {
+
+class UnboxedOptionalsCallback
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::UnboxedOptionalsCallback>;
+    using ObjcType = id<DBUnboxedOptionalsCallback>;
+
+    using Boxed = UnboxedOptionalsCallback;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,49 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import "DBUnboxedOptionalsCallback+Private.h"
+#import "DBUnboxedOptionalsCallback.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class UnboxedOptionalsCallback::ObjcProxy final
+: public ::testsuite::UnboxedOptionalsCallback
+, public ::djinni::ObjcProxyCache::Handle<ObjcType>
+{
+public:
+    using Handle::Handle;
+    std::experimental::optional<double> scale(std::experimental::optional<double> c_v, std::experimental::optional<int32_t> c_factor) override
+    {
+        @autoreleasepool {
+            auto r = [Handle::get() scale:(::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(c_v))
+                                   factor:(::djinni::Optional<std::experimental::optional, ::djinni::I32>::fromCpp(c_factor))];
+            return ::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(r);
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto UnboxedOptionalsCallback::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::get_objc_proxy<ObjcProxy>(objc);
+}
+
+auto UnboxedOptionalsCallback::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
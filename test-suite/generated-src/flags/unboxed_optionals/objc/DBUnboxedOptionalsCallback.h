@@ -0,0 +1,14 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** Implemented in Java and called from C++ with unboxed optional arguments */
+@protocol DBUnboxedOptionalsCallback
+
+/** Returns v times factor, or nothing if either is missing */
+- (nullable NSNumber *)scale:(nullable NSNumber *)v
+                      factor:(nullable NSNumber *)factor;
+
+@end
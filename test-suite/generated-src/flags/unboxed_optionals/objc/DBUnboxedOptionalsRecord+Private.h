@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import "DBUnboxedOptionalsRecord.h"
+#include "unboxed_optionals_record.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBUnboxedOptionalsRecord;
+
+namespace djinni_generated {
+
+struct UnboxedOptionalsRecord
+{
+    using CppType = ::testsuite::UnboxedOptionalsRecord;
+    using ObjcType = DBUnboxedOptionalsRecord*;
+
+    using Boxed = UnboxedOptionalsRecord;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import "DBUnboxedOptionalsRecord+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto UnboxedOptionalsRecord::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I32::toCpp(obj.count),
+            ::djinni::Optional<std::experimental::optional, ::djinni::Bool>::toCpp(obj.oFlag),
+            ::djinni::Optional<std::experimental::optional, ::djinni::I64>::toCpp(obj.oTotal),
+            ::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(obj.oRatio),
+            ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(obj.oName)};
+}
+
+auto UnboxedOptionalsRecord::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBUnboxedOptionalsRecord alloc] initWithCount:(::djinni::I32::fromCpp(cpp.count))
+                                                     oFlag:(::djinni::Optional<std::experimental::optional, ::djinni::Bool>::fromCpp(cpp.o_flag))
+                                                    oTotal:(::djinni::Optional<std::experimental::optional, ::djinni::I64>::fromCpp(cpp.o_total))
+                                                    oRatio:(::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(cpp.o_ratio))
+                                                     oName:(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(cpp.o_name))];
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import <Foundation/Foundation.h>
+
+@interface DBUnboxedOptionalsRecord : NSObject
+- (nonnull instancetype)initWithCount:(int32_t)count
+                                oFlag:(nullable NSNumber *)oFlag
+                               oTotal:(nullable NSNumber *)oTotal
+                               oRatio:(nullable NSNumber *)oRatio
+                                oName:(nullable NSString *)oName;
++ (nonnull instancetype)unboxedOptionalsRecordWithCount:(int32_t)count
+                                                  oFlag:(nullable NSNumber *)oFlag
+                                                 oTotal:(nullable NSNumber *)oTotal
+                                                 oRatio:(nullable NSNumber *)oRatio
+                                                  oName:(nullable NSString *)oName;
+
+@property (nonatomic, readonly) int32_t count;
+
+@property (nonatomic, readonly, nullable) NSNumber * oFlag;
+
+@property (nonatomic, readonly, nullable) NSNumber * oTotal;
+
+@property (nonatomic, readonly, nullable) NSNumber * oRatio;
+
+@property (nonatomic, readonly, nullable) NSString * oName;
+
+@end
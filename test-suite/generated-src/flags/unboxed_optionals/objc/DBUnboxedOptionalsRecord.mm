@@ -0,0 +1,43 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unboxed_optionals.djinni
+
+#import "DBUnboxedOptionalsRecord.h"
+
+
+@implementation DBUnboxedOptionalsRecord
+
+- (nonnull instancetype)initWithCount:(int32_t)count
+                                oFlag:(nullable NSNumber *)oFlag
+                               oTotal:(nullable NSNumber *)oTotal
+                               oRatio:(nullable NSNumber *)oRatio
+                                oName:(nullable NSString *)oName
+{
+    if (self = [super init]) {
+        _count = count;
+        _oFlag = oFlag;
+        _oTotal = oTotal;
+        _oRatio = oRatio;
+        _oName = [oName copy];
+    }
+    return self;
+}
+
++ (nonnull instancetype)unboxedOptionalsRecordWithCount:(int32_t)count
+                                                  oFlag:(nullable NSNumber *)oFlag
+                                                 oTotal:(nullable NSNumber *)oTotal
+                                                 oRatio:(nullable NSNumber *)oRatio
+                                                  oName:(nullable NSString *)oName
+{
+    return [[self alloc] initWithCount:count
+                                 oFlag:oFlag
+                                oTotal:oTotal
+                                oRatio:oRatio
+                                 oName:oName];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p count:%@ oFlag:%@ oTotal:%@ oRatio:%@ oName:%@>", self.class, self, @(self.count), self.oFlag, self.oTotal, self.oRatio, self.oName];
+}
+
+@end
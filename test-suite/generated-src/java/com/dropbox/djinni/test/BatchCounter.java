@@ -0,0 +1,181 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CallBatch;
+import com.dropbox.djinni.CppProxyRegistry;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Small calls that Java can make in bulk through BatchCounter.Batch */
+public abstract class BatchCounter {
+    /** Ignored while disabled */
+    public abstract void add(int amount);
+
+    public abstract long total();
+
+    public abstract void setScale(float scale);
+
+    public abstract double scaledTotal();
+
+    public abstract void setEnabled(boolean enabled);
+
+    public abstract boolean isEnabled();
+
+    /** Not batched: returns a string */
+    @Nonnull
+    public abstract String describe();
+
+    @CheckForNull
+    public static native BatchCounter create();
+
+    private static final class CppProxy extends BatchCounter
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+
+        @Override
+        public void add(int amount)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_add(this.nativeRef, amount);
+        }
+        private native void native_add(long _nativeRef, int amount);
+
+        @Override
+        public long total()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_total(this.nativeRef);
+        }
+        private native long native_total(long _nativeRef);
+
+        @Override
+        public void setScale(float scale)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_setScale(this.nativeRef, scale);
+        }
+        private native void native_setScale(long _nativeRef, float scale);
+
+        @Override
+        public double scaledTotal()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_scaledTotal(this.nativeRef);
+        }
+        private native double native_scaledTotal(long _nativeRef);
+
+        @Override
+        public void setEnabled(boolean enabled)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_setEnabled(this.nativeRef, enabled);
+        }
+        private native void native_setEnabled(long _nativeRef, boolean enabled);
+
+        @Override
+        public boolean isEnabled()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_isEnabled(this.nativeRef);
+        }
+        private native boolean native_isEnabled(long _nativeRef);
+
+        @Override
+        public String describe()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_describe(this.nativeRef);
+        }
+        private native String native_describe(long _nativeRef);
+    }
+
+    /**
+     * Records calls to the methods of a C++ object that take and return only
+     * primitives, and makes them all in one native call when run. Methods that
+     * return a value return a ticket for looking it up in the results instead.
+     */
+    public static final class Batch extends CallBatch
+    {
+        private final CppProxy target;
+
+        public Batch(BatchCounter target)
+        {
+            if (!(target instanceof CppProxy)) throw new IllegalArgumentException("target is not implemented in C++");
+            this.target = (CppProxy) target;
+        }
+
+        public void add(int amount)
+        {
+            call(0);
+            putLong(amount);
+        }
+
+        public int total()
+        {
+            return callForResult(1);
+        }
+
+        public void setScale(float scale)
+        {
+            call(2);
+            putFloat(scale);
+        }
+
+        public int scaledTotal()
+        {
+            return callForResult(3);
+        }
+
+        public void setEnabled(boolean enabled)
+        {
+            call(4);
+            putBoolean(enabled);
+        }
+
+        public int isEnabled()
+        {
+            return callForResult(5);
+        }
+
+        @Override
+        protected void runNative(long[] calls, int size, long[] results)
+        {
+            assert !target.destroyed.get() : "trying to use a destroyed object";
+            nativeRun(target.nativeRef, calls, size, results);
+        }
+        private static native void nativeRun(long nativeRef, long[] calls, int size, long[] results);
+    }
+}
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** One-shot callback implemented by the client, not cached on the Java side */
+public abstract class ClientCallback {
+    public abstract void onResult(@Nonnull String result);
+}
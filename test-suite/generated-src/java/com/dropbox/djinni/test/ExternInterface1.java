@@ -3,6 +3,7 @@
 
 package com.dropbox.djinni.test;
 
+import com.dropbox.djinni.CppProxyRegistry;
 import java.util.concurrent.atomic.AtomicBoolean;
 
 public abstract class ExternInterface1 {
@@ -17,13 +18,24 @@ public abstract class ExternInterface1 {
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
         }
 
         private native void nativeDestroy(long nativeRef);
         public void destroy()
         {
             boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
         }
         protected void finalize() throws java.lang.Throwable
         {
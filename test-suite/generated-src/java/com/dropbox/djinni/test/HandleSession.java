@@ -0,0 +1,68 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CppProxyRegistry;
+import com.dropbox.djinni.Handle;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** C++ state that Java and Objective-C only hold on to and pass back, see handle<T> */
+public abstract class HandleSession {
+    @Nonnull
+    public abstract String name();
+
+    @Nonnull
+    public static native Handle<HandleSession> open(@Nonnull String name);
+
+    @Nonnull
+    public static native String nameOf(@Nonnull Handle<HandleSession> session);
+
+    /** Number of sessions that haven't been destroyed yet */
+    public static native int liveCount();
+
+    private static final class CppProxy extends HandleSession
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+
+        @Override
+        public String name()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_name(this.nativeRef);
+        }
+        private native String native_name(long _nativeRef);
+    }
+}
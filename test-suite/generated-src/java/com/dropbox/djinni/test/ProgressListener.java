@@ -0,0 +1,17 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Progress reported by C++, which doesn't wait for Java to handle it */
+public abstract class ProgressListener {
+    public abstract void started(@Nonnull String task);
+
+    /** Only the latest progress matters, so progress Java hasn't received yet is replaced */
+    public abstract void progress(int done, int total);
+
+    public abstract void finished();
+}
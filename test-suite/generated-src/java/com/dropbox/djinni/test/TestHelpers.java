@@ -3,6 +3,11 @@
 
 package com.dropbox.djinni.test;
 
+import com.dropbox.djinni.CppProxyRegistry;
+import com.dropbox.djinni.MappedRegion;
+import com.dropbox.djinni.SharedBinary;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.concurrent.atomic.AtomicBoolean;
 import javax.annotation.CheckForNull;
@@ -54,6 +59,8 @@ public abstract class TestHelpers {
 
     public static native void checkClientInterfaceNonascii(@CheckForNull ClientInterface i);
 
+    public static native void callClientCallback(@CheckForNull ClientCallback cb, @Nonnull String result);
+
     public static native void checkEnumMap(@Nonnull HashMap<Color, String> m);
 
     public static native void checkEnum(@Nonnull Color c);
@@ -64,12 +71,33 @@ public abstract class TestHelpers {
     @CheckForNull
     public static native UserToken createCppToken();
 
+    @CheckForNull
+    public static native UserToken createLargeCppToken(long nativeBytes);
+
     public static native void checkCppToken(@CheckForNull UserToken t);
 
     public static native long cppTokenId(@CheckForNull UserToken t);
 
     public static native void checkTokenType(@CheckForNull UserToken t, @Nonnull String type);
 
+    @Nonnull
+    public static native ArrayList<UserToken> tokenListId(@Nonnull ArrayList<UserToken> l);
+
+    @Nonnull
+    public static native ArrayList<UserToken> createCppTokenList(int count);
+
+    /** One new C++ token, `count` times */
+    @Nonnull
+    public static native ArrayList<UserToken> createRepeatedCppTokenList(int count);
+
+    public static native void holdCallback(@CheckForNull ClientCallback cb);
+
+    public static native void releaseHeldCallbackOnNativeThread();
+
+    public static native void holdToken(@CheckForNull UserToken t);
+
+    public static native void releaseHeldTokenOnNativeThread();
+
     @CheckForNull
     public static native Integer returnNone();
 
@@ -80,6 +108,34 @@ public abstract class TestHelpers {
     @Nonnull
     public static native byte[] idBinary(@Nonnull byte[] b);
 
+    @Nonnull
+    public static native SharedBinary idSharedBinary(@Nonnull SharedBinary b);
+
+    @Nonnull
+    public static native SharedBinary createSharedBinary(int size);
+
+    /** Address of the bytes, to check that they weren't copied */
+    public static native long sharedBinaryData(@Nonnull SharedBinary b);
+
+    @Nonnull
+    public static native MappedRegion mapFileRegion(@Nonnull String path, long offset, long length);
+
+    /** Sum of the bytes, read in C++ */
+    public static native long mappedRegionSum(@Nonnull MappedRegion region);
+
+    /** Address of the bytes, to check that they weren't copied */
+    public static native long mappedRegionData(@Nonnull MappedRegion region);
+
+    /** Writes bytes 0, 1, 2, ... into buf, or returns the size needed if it doesn't fit */
+    public static native int fillOutBuffer(@Nonnull ByteBuffer buf, int size);
+
+    /** Appends s to strings; both are moved into the implementation rather than copied */
+    @Nonnull
+    public static native ArrayList<String> appendString(@Nonnull ArrayList<String> strings, @Nonnull String s);
+
+    /** Reports a task of the given number of steps to the listener */
+    public static native void reportProgress(@CheckForNull ProgressListener listener, @Nonnull String task, int steps);
+
     private static final class CppProxy extends TestHelpers
     {
         private final long nativeRef;
@@ -89,13 +145,24 @@ public abstract class TestHelpers {
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
         }
 
         private native void nativeDestroy(long nativeRef);
         public void destroy()
         {
             boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
         }
         protected void finalize() throws java.lang.Throwable
         {
@@ -0,0 +1,57 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CppProxyRegistry;
+import com.dropbox.djinni.ListDelta;
+import java.util.ArrayList;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Lists updated through deltas instead of being copied whole. */
+public abstract class TestListDelta {
+    /** Applies delta to list in C++ */
+    @Nonnull
+    public static native ArrayList<String> apply(@Nonnull ArrayList<String> list, @Nonnull ListDelta<String> delta);
+
+    /** Edits list through an observable_list and returns the recorded delta */
+    @Nonnull
+    public static native ListDelta<String> edit(@Nonnull ArrayList<String> list);
+
+    private static final class CppProxy extends TestListDelta
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            CppProxyRegistry.register(nativeRef, this);
+        }
+
+        private static void newProxies(long[] nativeRefs, Object[] proxies)
+        {
+            for (int i = 0; i < nativeRefs.length; ++i) {
+                proxies[i] = new CppProxy(nativeRefs[i]);
+            }
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                CppProxyRegistry.unregister(this.nativeRef);
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+    }
+}
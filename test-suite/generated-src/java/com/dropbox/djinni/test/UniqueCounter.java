@@ -0,0 +1,53 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Owned by the one proxy it's returned to, without reference counting or a proxy cache */
+public abstract class UniqueCounter {
+    public abstract int increment();
+
+    @CheckForNull
+    public static native UniqueCounter create(int start);
+
+    /** Number of counters that haven't been destroyed yet */
+    public static native int liveCount();
+
+    private static final class CppProxy extends UniqueCounter
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+        }
+
+        private native void nativeDestroy(long nativeRef);
+        public void destroy()
+        {
+            boolean destroyed = this.destroyed.getAndSet(true);
+            if (!destroyed) {
+                nativeDestroy(this.nativeRef);
+            }
+        }
+        protected void finalize() throws java.lang.Throwable
+        {
+            destroy();
+            super.finalize();
+        }
+
+        @Override
+        public int increment()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_increment(this.nativeRef);
+        }
+        private native int native_increment(long _nativeRef);
+    }
+}
@@ -0,0 +1,165 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#include "NativeBatchCounter.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeBatchCounter.hpp"
+
+namespace djinni_generated {
+
+NativeBatchCounter::NativeBatchCounter() : ::djinni::JniInterface<::testsuite::BatchCounter, NativeBatchCounter>("com/dropbox/djinni/test/BatchCounter$CppProxy") {}
+
+NativeBatchCounter::~NativeBatchCounter() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::BatchCounter>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1add(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_amount)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        auto c_amount = ::djinni::I32::toCpp(jniEnv, j_amount);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ref->add(c_amount);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1total(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->total();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1setScale(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jfloat j_scale)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        auto c_scale = ::djinni::F32::toCpp(jniEnv, j_scale);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ref->set_scale(c_scale);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jdouble JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1scaledTotal(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->scaled_total();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::F64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1setEnabled(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jboolean j_enabled)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        auto c_enabled = ::djinni::Bool::toCpp(jniEnv, j_enabled);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ref->set_enabled(c_enabled);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1isEnabled(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->is_enabled();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024CppProxy_native_1describe(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->describe();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BatchCounter_create(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::BatchCounter::create();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeBatchCounter::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_BatchCounter_00024Batch_nativeRun(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlongArray j_calls, jint j_size, jlongArray j_results)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::BatchCounter>(nativeRef);
+        ::djinni::JniCallBatch batch(jniEnv, j_calls, j_size, j_results);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        while (!batch.done()) {
+            switch (batch.method()) {
+                case 0: {
+                    auto c_amount = ::djinni::I32::toCpp(jniEnv, batch.arg<jint>());
+                    ref->add(c_amount);
+                    break;
+                }
+                case 1: {
+                    batch.result(::djinni::I64::fromCpp(jniEnv, ref->total()));
+                    break;
+                }
+                case 2: {
+                    auto c_scale = ::djinni::F32::toCpp(jniEnv, batch.arg<jfloat>());
+                    ref->set_scale(c_scale);
+                    break;
+                }
+                case 3: {
+                    batch.result(::djinni::F64::fromCpp(jniEnv, ref->scaled_total()));
+                    break;
+                }
+                case 4: {
+                    auto c_enabled = ::djinni::Bool::toCpp(jniEnv, batch.arg<jboolean>());
+                    ref->set_enabled(c_enabled);
+                    break;
+                }
+                case 5: {
+                    batch.result(::djinni::Bool::fromCpp(jniEnv, ref->is_enabled()));
+                    break;
+                }
+                default:
+                    DJINNI_ASSERT_MSG(false, jniEnv, "unknown method in call batch");
+            }
+        }
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        batch.finish();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+}  // namespace djinni_generated
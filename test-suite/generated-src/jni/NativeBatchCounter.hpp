@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "batch_counter.hpp"
+
+namespace djinni_generated {
+
+class NativeBatchCounter final : ::djinni::JniInterface<::testsuite::BatchCounter, NativeBatchCounter> {
+public:
+    using CppType = std::shared_ptr<::testsuite::BatchCounter>;
+    using JniType = jobject;
+
+    using Boxed = NativeBatchCounter;
+
+    ~NativeBatchCounter();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeBatchCounter>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeBatchCounter>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeBatchCounter>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeBatchCounter>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeBatchCounter();
+    friend ::djinni::JniClass<NativeBatchCounter>;
+    friend ::djinni::JniInterface<::testsuite::BatchCounter, NativeBatchCounter>;
+
+};
+
+}  // namespace djinni_generated
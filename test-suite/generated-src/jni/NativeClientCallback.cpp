@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#include "NativeClientCallback.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeClientCallback::NativeClientCallback() : ::djinni::JniInterface<::testsuite::ClientCallback, NativeClientCallback>() {}
+
+NativeClientCallback::~NativeClientCallback() = default;
+
+NativeClientCallback::JavaProxy::JavaProxy(JniType j) : JavaProxyUncachedEntry(::djinni::jniGetThreadEnv(), j) { }
+
+NativeClientCallback::JavaProxy::~JavaProxy() = default;
+
+void NativeClientCallback::JavaProxy::on_result(const std::string & c_result) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ClientCallback.onResult");
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeClientCallback>::get();
+    auto j_result = ::djinni::String::fromCpp(jniEnv, c_result);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+    jniEnv->CallVoidMethod(JavaProxyUncachedEntry::get().get(), data.method_onResult,
+                           ::djinni::get(j_result));
+    ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
+}
+
+}  // namespace djinni_generated
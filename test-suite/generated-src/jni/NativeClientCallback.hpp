@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#pragma once
+
+#include "client_callback.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeClientCallback final : ::djinni::JniInterface<::testsuite::ClientCallback, NativeClientCallback> {
+public:
+    using CppType = std::shared_ptr<::testsuite::ClientCallback>;
+    using JniType = jobject;
+
+    using Boxed = NativeClientCallback;
+
+    ~NativeClientCallback();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeClientCallback>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeClientCallback>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeClientCallback>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeClientCallback>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeClientCallback();
+    friend ::djinni::JniClass<NativeClientCallback>;
+    friend ::djinni::JniInterface<::testsuite::ClientCallback, NativeClientCallback>;
+
+    class JavaProxy final : ::djinni::JavaProxyUncachedEntry, public ::testsuite::ClientCallback
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void on_result(const std::string & result) override;
+
+    private:
+        friend ::djinni::JniInterface<::testsuite::ClientCallback, ::djinni_generated::NativeClientCallback>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/ClientCallback") };
+    const jmethodID method_onResult { ::djinni::jniGetMethodID(clazz.get(), "onResult", "(Ljava/lang/String;)V") };
+};
+
+}  // namespace djinni_generated
@@ -16,33 +16,48 @@ NativeClientInterface::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGet
 NativeClientInterface::JavaProxy::~JavaProxy() = default;
 
 ::testsuite::ClientReturnedRecord NativeClientInterface::JavaProxy::get_record(int64_t c_record_id, const std::string & c_utf8string, const std::experimental::optional<std::string> & c_misc) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ClientInterface.getRecord");
     auto jniEnv = ::djinni::jniGetThreadEnv();
     ::djinni::JniLocalScope jscope(jniEnv, 10);
     const auto& data = ::djinni::JniClass<::djinni_generated::NativeClientInterface>::get();
+    auto j_recordId = ::djinni::I64::fromCpp(jniEnv, c_record_id);
+    auto j_utf8string = ::djinni::String::fromCpp(jniEnv, c_utf8string);
+    auto j_misc = ::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(jniEnv, c_misc);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
     auto jret = jniEnv->CallObjectMethod(Handle::get().get(), data.method_getRecord,
-                                         ::djinni::get(::djinni::I64::fromCpp(jniEnv, c_record_id)),
-                                         ::djinni::get(::djinni::String::fromCpp(jniEnv, c_utf8string)),
-                                         ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(jniEnv, c_misc)));
+                                         ::djinni::get(j_recordId),
+                                         ::djinni::get(j_utf8string),
+                                         ::djinni::get(j_misc));
     ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
     return ::djinni_generated::NativeClientReturnedRecord::toCpp(jniEnv, jret);
 }
 double NativeClientInterface::JavaProxy::identifier_check(const std::vector<uint8_t> & c_data, int32_t c_r, int64_t c_jret) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ClientInterface.identifierCheck");
     auto jniEnv = ::djinni::jniGetThreadEnv();
     ::djinni::JniLocalScope jscope(jniEnv, 10);
     const auto& data = ::djinni::JniClass<::djinni_generated::NativeClientInterface>::get();
+    auto j_data = ::djinni::Binary::fromCpp(jniEnv, c_data);
+    auto j_r = ::djinni::I32::fromCpp(jniEnv, c_r);
+    auto j_jret = ::djinni::I64::fromCpp(jniEnv, c_jret);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
     auto jret = jniEnv->CallDoubleMethod(Handle::get().get(), data.method_identifierCheck,
-                                         ::djinni::get(::djinni::Binary::fromCpp(jniEnv, c_data)),
-                                         ::djinni::get(::djinni::I32::fromCpp(jniEnv, c_r)),
-                                         ::djinni::get(::djinni::I64::fromCpp(jniEnv, c_jret)));
+                                         ::djinni::get(j_data),
+                                         ::djinni::get(j_r),
+                                         ::djinni::get(j_jret));
     ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
     return ::djinni::F64::toCpp(jniEnv, jret);
 }
 std::string NativeClientInterface::JavaProxy::return_str() {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ClientInterface.returnStr");
     auto jniEnv = ::djinni::jniGetThreadEnv();
     ::djinni::JniLocalScope jscope(jniEnv, 10);
     const auto& data = ::djinni::JniClass<::djinni_generated::NativeClientInterface>::get();
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
     auto jret = (jstring)jniEnv->CallObjectMethod(Handle::get().get(), data.method_returnStr);
     ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
     return ::djinni::String::toCpp(jniEnv, jret);
 }
 
@@ -15,7 +15,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ConstantsInterface_00024Cpp
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::ConstantsInterface>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -24,7 +26,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ConstantsInterface_00024Cpp
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
         const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::ConstantsInterface>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         ref->dummy();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -16,7 +16,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CppException_00024CppProxy_
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::CppException>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -25,7 +27,9 @@ CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_CppException_00024CppProxy_
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
         const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::CppException>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ref->throw_an_exception();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -34,7 +38,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_CppException_get(JNIEnv*
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::CppException::get();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeCppException::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -16,7 +16,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ExternInterface1_00024CppPr
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         delete reinterpret_cast<djinni::CppProxyHandle<::ExternInterface1>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -25,7 +27,10 @@ CJNIEXPORT ::djinni_generated::NativeClientReturnedRecord::JniType JNICALL Java_
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
         const auto& ref = ::djinni::objectFromHandleAddress<::ExternInterface1>(nativeRef);
-        auto r = ref->foo(::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_i));
+        auto c_i = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_i);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->foo(c_i);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeClientReturnedRecord::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -16,12 +16,16 @@ NativeExternInterface2::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGe
 NativeExternInterface2::JavaProxy::~JavaProxy() = default;
 
 ::ExternRecordWithDerivings NativeExternInterface2::JavaProxy::foo(const std::shared_ptr<::testsuite::TestHelpers> & c_i) {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ExternInterface2.foo");
     auto jniEnv = ::djinni::jniGetThreadEnv();
     ::djinni::JniLocalScope jscope(jniEnv, 10);
     const auto& data = ::djinni::JniClass<::djinni_generated::NativeExternInterface2>::get();
+    auto j_i = ::djinni_generated::NativeTestHelpers::fromCpp(jniEnv, c_i);
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
     auto jret = jniEnv->CallObjectMethod(Handle::get().get(), data.method_foo,
-                                         ::djinni::get(::djinni_generated::NativeTestHelpers::fromCpp(jniEnv, c_i)));
+                                         ::djinni::get(j_i));
     ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
     return ::djinni_generated::NativeExternRecordWithDerivings::toCpp(jniEnv, jret);
 }
 
@@ -0,0 +1,72 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+#include "NativeHandleSession.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeHandleSession.hpp"
+
+namespace djinni_generated {
+
+NativeHandleSession::NativeHandleSession() : ::djinni::JniInterface<::testsuite::HandleSession, NativeHandleSession>("com/dropbox/djinni/test/HandleSession$CppProxy") {}
+
+NativeHandleSession::~NativeHandleSession() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_HandleSession_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::HandleSession>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_HandleSession_00024CppProxy_native_1name(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::HandleSession>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->name();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_HandleSession_open(JNIEnv* jniEnv, jobject /*this*/, jstring j_name)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_name = ::djinni::String::toCpp(jniEnv, j_name);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::HandleSession::open(c_name);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Handle<std::shared_ptr<::testsuite::HandleSession>>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_HandleSession_nameOf(JNIEnv* jniEnv, jobject /*this*/, jobject j_session)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_session = ::djinni::Handle<std::shared_ptr<::testsuite::HandleSession>>::toCpp(jniEnv, j_session);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::HandleSession::name_of(c_session);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_HandleSession_liveCount(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::HandleSession::live_count();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "handle_session.hpp"
+
+namespace djinni_generated {
+
+class NativeHandleSession final : ::djinni::JniInterface<::testsuite::HandleSession, NativeHandleSession> {
+public:
+    using CppType = std::shared_ptr<::testsuite::HandleSession>;
+    using JniType = jobject;
+
+    using Boxed = NativeHandleSession;
+
+    ~NativeHandleSession();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeHandleSession>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeHandleSession>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeHandleSession>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeHandleSession>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeHandleSession();
+    friend ::djinni::JniClass<NativeHandleSession>;
+    friend ::djinni::JniInterface<::testsuite::HandleSession, NativeHandleSession>;
+
+};
+
+}  // namespace djinni_generated
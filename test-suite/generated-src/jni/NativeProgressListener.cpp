@@ -0,0 +1,60 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#include "NativeProgressListener.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeProgressListener::NativeProgressListener() : ::djinni::JniInterface<::testsuite::ProgressListener, NativeProgressListener>() {}
+
+NativeProgressListener::~NativeProgressListener() = default;
+
+NativeProgressListener::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+NativeProgressListener::JavaProxy::~JavaProxy() = default;
+
+void NativeProgressListener::JavaProxy::started(const std::string & c_task) {
+    auto self = shared_from_this();
+    ::djinni::JavaOnewayDispatcher::post([self, c_task](JNIEnv * jniEnv) {
+        DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ProgressListener.started");
+        ::djinni::JniLocalScope jscope(jniEnv, 10);
+        const auto& data = ::djinni::JniClass<::djinni_generated::NativeProgressListener>::get();
+        auto j_task = ::djinni::String::fromCpp(jniEnv, c_task);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        jniEnv->CallVoidMethod(self->Handle::get().get(), data.method_started,
+                               ::djinni::get(j_task));
+        ::djinni::jniExceptionCheck(jniEnv);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    });
+}
+void NativeProgressListener::JavaProxy::progress(int32_t c_done, int32_t c_total) {
+    auto self = shared_from_this();
+    ::djinni::JavaOnewayDispatcher::postCoalesced(this, 1, [self, c_done, c_total](JNIEnv * jniEnv) {
+        DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ProgressListener.progress");
+        ::djinni::JniLocalScope jscope(jniEnv, 10);
+        const auto& data = ::djinni::JniClass<::djinni_generated::NativeProgressListener>::get();
+        auto j_done = ::djinni::I32::fromCpp(jniEnv, c_done);
+        auto j_total = ::djinni::I32::fromCpp(jniEnv, c_total);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        jniEnv->CallVoidMethod(self->Handle::get().get(), data.method_progress,
+                               ::djinni::get(j_done),
+                               ::djinni::get(j_total));
+        ::djinni::jniExceptionCheck(jniEnv);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    });
+}
+void NativeProgressListener::JavaProxy::finished() {
+    auto self = shared_from_this();
+    ::djinni::JavaOnewayDispatcher::post([self](JNIEnv * jniEnv) {
+        DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.ProgressListener.finished");
+        ::djinni::JniLocalScope jscope(jniEnv, 10);
+        const auto& data = ::djinni::JniClass<::djinni_generated::NativeProgressListener>::get();
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        jniEnv->CallVoidMethod(self->Handle::get().get(), data.method_finished);
+        ::djinni::jniExceptionCheck(jniEnv);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    });
+}
+
+}  // namespace djinni_generated
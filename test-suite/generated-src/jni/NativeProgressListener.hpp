@@ -0,0 +1,50 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "progress_listener.hpp"
+
+namespace djinni_generated {
+
+class NativeProgressListener final : ::djinni::JniInterface<::testsuite::ProgressListener, NativeProgressListener> {
+public:
+    using CppType = std::shared_ptr<::testsuite::ProgressListener>;
+    using JniType = jobject;
+
+    using Boxed = NativeProgressListener;
+
+    ~NativeProgressListener();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeProgressListener>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeProgressListener>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeProgressListener>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeProgressListener>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeProgressListener();
+    friend ::djinni::JniClass<NativeProgressListener>;
+    friend ::djinni::JniInterface<::testsuite::ProgressListener, NativeProgressListener>;
+
+    class JavaProxy final : ::djinni::JavaProxyCacheEntry, public ::testsuite::ProgressListener, public std::enable_shared_from_this<JavaProxy>
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void started(const std::string & task) override;
+        void progress(int32_t done, int32_t total) override;
+        void finished() override;
+
+    private:
+        friend ::djinni::JniInterface<::testsuite::ProgressListener, ::djinni_generated::NativeProgressListener>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/ProgressListener") };
+    const jmethodID method_started { ::djinni::jniGetMethodID(clazz.get(), "started", "(Ljava/lang/String;)V") };
+    const jmethodID method_progress { ::djinni::jniGetMethodID(clazz.get(), "progress", "(II)V") };
+    const jmethodID method_finished { ::djinni::jniGetMethodID(clazz.get(), "finished", "()V") };
+};
+
+}  // namespace djinni_generated
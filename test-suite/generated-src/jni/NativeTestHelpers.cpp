@@ -4,11 +4,13 @@
 #include "NativeTestHelpers.hpp"  // my header
 #include "Marshal.hpp"
 #include "NativeAssortedPrimitives.hpp"
+#include "NativeClientCallback.hpp"
 #include "NativeClientInterface.hpp"
 #include "NativeColor.hpp"
 #include "NativeMapListRecord.hpp"
 #include "NativeNestedCollection.hpp"
 #include "NativePrimitiveList.hpp"
+#include "NativeProgressListener.hpp"
 #include "NativeSetRecord.hpp"
 #include "NativeUserToken.hpp"
 
@@ -23,7 +25,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_00024CppProxy_n
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::TestHelpers>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -31,7 +35,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getSetRecord
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::get_set_record();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeSetRecord::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -40,7 +46,10 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkSetRec
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::check_set_record(::djinni_generated::NativeSetRecord::toCpp(jniEnv, j_rec));
+        auto c_rec = ::djinni_generated::NativeSetRecord::toCpp(jniEnv, j_rec);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::check_set_record(c_rec);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -49,7 +58,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getPrimitive
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::get_primitive_list();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativePrimitiveList::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -58,7 +69,10 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkPrimit
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::check_primitive_list(::djinni_generated::NativePrimitiveList::toCpp(jniEnv, j_pl));
+        auto c_pl = ::djinni_generated::NativePrimitiveList::toCpp(jniEnv, j_pl);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::check_primitive_list(c_pl);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -67,7 +81,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getNestedCol
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::get_nested_collection();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeNestedCollection::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -76,7 +92,10 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkNested
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::check_nested_collection(::djinni_generated::NativeNestedCollection::toCpp(jniEnv, j_nc));
+        auto c_nc = ::djinni_generated::NativeNestedCollection::toCpp(jniEnv, j_nc);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::check_nested_collection(c_nc);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -85,7 +104,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMap(JNIEn
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::get_map();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -94,7 +115,10 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMap(JN
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::check_map(::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, j_m));
+        auto c_m = ::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, j_m);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::check_map(c_m);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -103,7 +127,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getEmptyMap(
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::get_empty_map();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -112,7 +138,10 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEmptyM
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::check_empty_map(::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, j_m));
+        auto c_m = ::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, j_m);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::check_empty_map(c_m);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -121,7 +150,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMapListRe
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::get_map_list_record();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeMapListRecord::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -130,7 +161,10 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMapLis
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::check_map_list_record(::djinni_generated::NativeMapListRecord::toCpp(jniEnv, j_m));
+        auto c_m = ::djinni_generated::NativeMapListRecord::toCpp(jniEnv, j_m);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::check_map_list_record(c_m);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -139,7 +173,10 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInte
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        ::testsuite::TestHelpers::check_client_interface_ascii(::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_i));
+        auto c_i = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_i);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::check_client_interface_ascii(c_i);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -147,7 +184,22 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInte
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        ::testsuite::TestHelpers::check_client_interface_nonascii(::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_i));
+        auto c_i = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_i);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::check_client_interface_nonascii(c_i);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_callClientCallback(JNIEnv* jniEnv, jobject /*this*/, jobject j_cb, jstring j_result)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_cb = ::djinni_generated::NativeClientCallback::toCpp(jniEnv, j_cb);
+        auto c_result = ::djinni::String::toCpp(jniEnv, j_result);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::call_client_callback(c_cb, c_result);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -155,7 +207,10 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnumMap(JN
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        ::testsuite::TestHelpers::check_enum_map(::djinni::Map<::djinni_generated::NativeColor, ::djinni::String>::toCpp(jniEnv, j_m));
+        auto c_m = ::djinni::Map<::djinni_generated::NativeColor, ::djinni::String>::toCpp(jniEnv, j_m);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::check_enum_map(c_m);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -163,7 +218,10 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnum(JNIEn
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        ::testsuite::TestHelpers::check_enum(::djinni_generated::NativeColor::toCpp(jniEnv, j_c));
+        auto c_c = ::djinni_generated::NativeColor::toCpp(jniEnv, j_c);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::check_enum(c_c);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -171,7 +229,10 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_tokenId(JNIE
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::token_id(::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t));
+        auto c_t = ::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::token_id(c_t);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeUserToken::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -180,7 +241,21 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createCppTok
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::create_cpp_token();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeUserToken::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createLargeCppToken(JNIEnv* jniEnv, jobject /*this*/, jlong j_nativeBytes)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_nativeBytes = ::djinni::I64::toCpp(jniEnv, j_nativeBytes);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::create_large_cpp_token(c_nativeBytes);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeUserToken::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -189,7 +264,10 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkCppToken(J
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        ::testsuite::TestHelpers::check_cpp_token(::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t));
+        auto c_t = ::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::check_cpp_token(c_t);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -197,7 +275,10 @@ CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_cppTokenId(JNI
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::cpp_token_id(::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t));
+        auto c_t = ::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::cpp_token_id(c_t);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -206,8 +287,89 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkTokenType(
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        ::testsuite::TestHelpers::check_token_type(::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t),
-                                                   ::djinni::String::toCpp(jniEnv, j_type));
+        auto c_t = ::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t);
+        auto c_type = ::djinni::String::toCpp(jniEnv, j_type);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::check_token_type(c_t, c_type);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_tokenListId(JNIEnv* jniEnv, jobject /*this*/, jobject j_l)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_l = ::djinni::List<::djinni_generated::NativeUserToken>::toCpp(jniEnv, j_l);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::token_list_id(c_l);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::List<::djinni_generated::NativeUserToken>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createCppTokenList(JNIEnv* jniEnv, jobject /*this*/, jint j_count)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_count = ::djinni::I32::toCpp(jniEnv, j_count);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::create_cpp_token_list(c_count);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::List<::djinni_generated::NativeUserToken>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createRepeatedCppTokenList(JNIEnv* jniEnv, jobject /*this*/, jint j_count)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_count = ::djinni::I32::toCpp(jniEnv, j_count);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::create_repeated_cpp_token_list(c_count);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::List<::djinni_generated::NativeUserToken>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_holdCallback(JNIEnv* jniEnv, jobject /*this*/, jobject j_cb)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_cb = ::djinni_generated::NativeClientCallback::toCpp(jniEnv, j_cb);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::hold_callback(c_cb);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_releaseHeldCallbackOnNativeThread(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::release_held_callback_on_native_thread();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_holdToken(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_t = ::djinni_generated::NativeUserToken::toCpp(jniEnv, j_t);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::hold_token(c_t);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_releaseHeldTokenOnNativeThread(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::release_held_token_on_native_thread();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -215,7 +377,9 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_returnNone(J
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ::testsuite::TestHelpers::return_none();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Optional<std::experimental::optional, ::djinni::I32>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -224,7 +388,10 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_assortedPrim
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::assorted_primitives_id(::djinni_generated::NativeAssortedPrimitives::toCpp(jniEnv, j_i));
+        auto c_i = ::djinni_generated::NativeAssortedPrimitives::toCpp(jniEnv, j_i);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::assorted_primitives_id(c_i);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni_generated::NativeAssortedPrimitives::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -233,9 +400,125 @@ CJNIEXPORT jbyteArray JNICALL Java_com_dropbox_djinni_test_TestHelpers_idBinary(
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
-        auto r = ::testsuite::TestHelpers::id_binary(::djinni::Binary::toCpp(jniEnv, j_b));
+        auto c_b = ::djinni::Binary::toCpp(jniEnv, j_b);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::id_binary(c_b);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::Binary::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_idSharedBinary(JNIEnv* jniEnv, jobject /*this*/, jobject j_b)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_b = ::djinni::SharedBinary::toCpp(jniEnv, j_b);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::id_shared_binary(c_b);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::SharedBinary::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createSharedBinary(JNIEnv* jniEnv, jobject /*this*/, jint j_size)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_size = ::djinni::I32::toCpp(jniEnv, j_size);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::create_shared_binary(c_size);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::SharedBinary::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_sharedBinaryData(JNIEnv* jniEnv, jobject /*this*/, jobject j_b)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_b = ::djinni::SharedBinary::toCpp(jniEnv, j_b);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::shared_binary_data(c_b);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_mapFileRegion(JNIEnv* jniEnv, jobject /*this*/, jstring j_path, jlong j_offset, jlong j_length)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_path = ::djinni::String::toCpp(jniEnv, j_path);
+        auto c_offset = ::djinni::I64::toCpp(jniEnv, j_offset);
+        auto c_length = ::djinni::I64::toCpp(jniEnv, j_length);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::map_file_region(c_path, c_offset, c_length);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::MappedRegion::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_mappedRegionSum(JNIEnv* jniEnv, jobject /*this*/, jobject j_region)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_region = ::djinni::MappedRegion::toCpp(jniEnv, j_region);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::mapped_region_sum(c_region);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_mappedRegionData(JNIEnv* jniEnv, jobject /*this*/, jobject j_region)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_region = ::djinni::MappedRegion::toCpp(jniEnv, j_region);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::mapped_region_data(c_region);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_TestHelpers_fillOutBuffer(JNIEnv* jniEnv, jobject /*this*/, jobject j_buf, jint j_size)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_buf = ::djinni::OutBuffer::toCpp(jniEnv, j_buf);
+        auto c_size = ::djinni::I32::toCpp(jniEnv, j_size);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::fill_out_buffer(c_buf, c_size);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_appendString(JNIEnv* jniEnv, jobject /*this*/, jobject j_strings, jstring j_s)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_strings = ::djinni::List<::djinni::String>::toCpp(jniEnv, j_strings);
+        auto c_s = ::djinni::String::toCpp(jniEnv, j_s);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestHelpers::append_string(std::move(c_strings), std::move(c_s));
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::List<::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_reportProgress(JNIEnv* jniEnv, jobject /*this*/, jobject j_listener, jstring j_task, jint j_steps)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_listener = ::djinni_generated::NativeProgressListener::toCpp(jniEnv, j_listener);
+        auto c_task = ::djinni::String::toCpp(jniEnv, j_task);
+        auto c_steps = ::djinni::I32::toCpp(jniEnv, j_steps);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestHelpers::report_progress(c_listener, c_task, c_steps);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 }  // namespace djinni_generated
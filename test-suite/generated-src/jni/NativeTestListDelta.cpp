@@ -0,0 +1,49 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+#include "NativeTestListDelta.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeTestListDelta::NativeTestListDelta() : ::djinni::JniInterface<::testsuite::TestListDelta, NativeTestListDelta>("com/dropbox/djinni/test/TestListDelta$CppProxy") {}
+
+NativeTestListDelta::~NativeTestListDelta() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestListDelta_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::TestListDelta>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestListDelta_apply(JNIEnv* jniEnv, jobject /*this*/, jobject j_list, jobject j_delta)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_list = ::djinni::List<::djinni::String>::toCpp(jniEnv, j_list);
+        auto c_delta = ::djinni::ListDelta<::djinni::String>::toCpp(jniEnv, j_delta);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestListDelta::apply(c_list, c_delta);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::List<::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestListDelta_edit(JNIEnv* jniEnv, jobject /*this*/, jobject j_list)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_list = ::djinni::List<::djinni::String>::toCpp(jniEnv, j_list);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestListDelta::edit(c_list);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::ListDelta<::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "test_list_delta.hpp"
+
+namespace djinni_generated {
+
+class NativeTestListDelta final : ::djinni::JniInterface<::testsuite::TestListDelta, NativeTestListDelta> {
+public:
+    using CppType = std::shared_ptr<::testsuite::TestListDelta>;
+    using JniType = jobject;
+
+    using Boxed = NativeTestListDelta;
+
+    ~NativeTestListDelta();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTestListDelta>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeTestListDelta>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeTestListDelta>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeTestListDelta>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeTestListDelta();
+    friend ::djinni::JniClass<NativeTestListDelta>;
+    friend ::djinni::JniInterface<::testsuite::TestListDelta, NativeTestListDelta>;
+
+};
+
+}  // namespace djinni_generated
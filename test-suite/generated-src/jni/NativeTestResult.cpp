@@ -0,0 +1,70 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from result.djinni
+
+#include "NativeTestResult.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeTestResult::NativeTestResult() : ::djinni::JniInterface<::testsuite::TestResult, NativeTestResult>("com/dropbox/djinni/test/TestResult$CppProxy") {}
+
+NativeTestResult::~NativeTestResult() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestResult_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::TestResult>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestResult_makeOk(JNIEnv* jniEnv, jobject /*this*/, jstring j_value)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_value = ::djinni::String::toCpp(jniEnv, j_value);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestResult::make_ok(c_value);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Result<::djinni::String, ::djinni::I32>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestResult_makeError(JNIEnv* jniEnv, jobject /*this*/, jint j_code)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_code = ::djinni::I32::toCpp(jniEnv, j_code);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestResult::make_error(c_code);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::Result<::djinni::String, ::djinni::I32>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_TestResult_describe(JNIEnv* jniEnv, jobject /*this*/, jobject j_res)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_res = ::djinni::Result<::djinni::String, ::djinni::I32>::toCpp(jniEnv, j_res);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::TestResult::describe(c_res);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestResult_checkThrowingMoveAssignment(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        ::testsuite::TestResult::check_throwing_move_assignment();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from result.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "test_result.hpp"
+
+namespace djinni_generated {
+
+class NativeTestResult final : ::djinni::JniInterface<::testsuite::TestResult, NativeTestResult> {
+public:
+    using CppType = std::shared_ptr<::testsuite::TestResult>;
+    using JniType = jobject;
+
+    using Boxed = NativeTestResult;
+
+    ~NativeTestResult();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTestResult>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeTestResult>::get()._toJava(jniEnv, c)}; }
+    static void toCppBatch(JNIEnv* jniEnv, const JniType* j, size_t count, CppType* c) { ::djinni::JniClass<NativeTestResult>::get()._fromJavaBatch(jniEnv, j, count, c); }
+    static void fromCppBatch(JNIEnv* jniEnv, const CppType* c, size_t count, JniType* j) { ::djinni::JniClass<NativeTestResult>::get()._toJavaBatch(jniEnv, c, count, j); }
+
+private:
+    NativeTestResult();
+    friend ::djinni::JniClass<NativeTestResult>;
+    friend ::djinni::JniInterface<::testsuite::TestResult, NativeTestResult>;
+
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,60 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+#include "NativeUniqueCounter.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeUniqueCounter.hpp"
+
+namespace djinni_generated {
+
+NativeUniqueCounter::NativeUniqueCounter() : ::djinni::JniUniqueInterface<::testsuite::UniqueCounter, NativeUniqueCounter>("com/dropbox/djinni/test/UniqueCounter$CppProxy") {}
+
+NativeUniqueCounter::~NativeUniqueCounter() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_UniqueCounter_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        delete ::djinni::objectFromUniqueHandleAddress<::testsuite::UniqueCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_UniqueCounter_00024CppProxy_native_1increment(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromUniqueHandleAddress<::testsuite::UniqueCounter>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ref->increment();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_UniqueCounter_create(JNIEnv* jniEnv, jobject /*this*/, jint j_start)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto c_start = ::djinni::I32::toCpp(jniEnv, j_start);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::UniqueCounter::create(c_start);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni_generated::NativeUniqueCounter::fromCpp(jniEnv, std::move(r)));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_UniqueCounter_liveCount(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
+        auto r = ::testsuite::UniqueCounter::live_count();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+}  // namespace djinni_generated
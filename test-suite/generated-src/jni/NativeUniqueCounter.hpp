@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "unique_counter.hpp"
+
+namespace djinni_generated {
+
+class NativeUniqueCounter final : ::djinni::JniUniqueInterface<::testsuite::UniqueCounter, NativeUniqueCounter> {
+public:
+    using CppType = std::unique_ptr<::testsuite::UniqueCounter>;
+    using JniType = jobject;
+
+    using Boxed = NativeUniqueCounter;
+
+    ~NativeUniqueCounter();
+
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, CppType c) { return {jniEnv, ::djinni::JniClass<NativeUniqueCounter>::get()._toJava(jniEnv, std::move(c))}; }
+
+private:
+    NativeUniqueCounter();
+    friend ::djinni::JniClass<NativeUniqueCounter>;
+    friend ::djinni::JniUniqueInterface<::testsuite::UniqueCounter, NativeUniqueCounter>;
+
+};
+
+}  // namespace djinni_generated
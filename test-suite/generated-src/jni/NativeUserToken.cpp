@@ -15,11 +15,14 @@ NativeUserToken::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThread
 NativeUserToken::JavaProxy::~JavaProxy() = default;
 
 std::string NativeUserToken::JavaProxy::whoami() {
+    DJINNI_JAVA_PROXY_PROLOGUE("com.dropbox.djinni.test.UserToken.whoami");
     auto jniEnv = ::djinni::jniGetThreadEnv();
     ::djinni::JniLocalScope jscope(jniEnv, 10);
     const auto& data = ::djinni::JniClass<::djinni_generated::NativeUserToken>::get();
+    DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
     auto jret = (jstring)jniEnv->CallObjectMethod(Handle::get().get(), data.method_whoami);
     ::djinni::jniExceptionCheck(jniEnv);
+    DJINNI_FUNCTION_BODY_END(jniEnv);
     return ::djinni::String::toCpp(jniEnv, jret);
 }
 
@@ -27,7 +30,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_UserToken_00024CppProxy_nat
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         delete reinterpret_cast<djinni::CppProxyHandle<::testsuite::UserToken>*>(nativeRef);
+        DJINNI_FUNCTION_BODY_END(jniEnv);
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
@@ -36,7 +41,9 @@ CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_UserToken_00024CppProxy_
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
         const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::UserToken>(nativeRef);
+        DJINNI_FUNCTION_BODY_BEGIN(jniEnv);
         auto r = ref->whoami();
+        DJINNI_FUNCTION_BODY_END(jniEnv);
         return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
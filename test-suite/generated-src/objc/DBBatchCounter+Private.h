@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#include "batch_counter.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBBatchCounter;
+
+namespace djinni_generated {
+
+class BatchCounter
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::BatchCounter>;
+    using ObjcType = DBBatchCounter*;
+
+    using Boxed = BatchCounter;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
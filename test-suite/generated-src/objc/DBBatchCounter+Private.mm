@@ -0,0 +1,106 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#import "DBBatchCounter+Private.h"
+#import "DBBatchCounter.h"
+#import "DBBatchCounter+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBBatchCounter ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::BatchCounter>&)cppRef;
+
+@end
+
+@implementation DBBatchCounter {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::BatchCounter>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::BatchCounter>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (void)add:(int32_t)amount {
+    try {
+        _cppRefHandle.get()->add(::djinni::I32::toCpp(amount));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (int64_t)total {
+    try {
+        auto r = _cppRefHandle.get()->total();
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (void)setScale:(float)scale {
+    try {
+        _cppRefHandle.get()->set_scale(::djinni::F32::toCpp(scale));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (double)scaledTotal {
+    try {
+        auto r = _cppRefHandle.get()->scaled_total();
+        return ::djinni::F64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (void)setEnabled:(BOOL)enabled {
+    try {
+        _cppRefHandle.get()->set_enabled(::djinni::Bool::toCpp(enabled));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (BOOL)isEnabled {
+    try {
+        auto r = _cppRefHandle.get()->is_enabled();
+        return ::djinni::Bool::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull NSString *)describe {
+    try {
+        auto r = _cppRefHandle.get()->describe();
+        return ::djinni::String::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable DBBatchCounter *)create {
+    try {
+        auto r = ::testsuite::BatchCounter::create();
+        return ::djinni_generated::BatchCounter::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto BatchCounter::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto BatchCounter::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBBatchCounter>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
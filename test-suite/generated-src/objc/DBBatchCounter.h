@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#import <Foundation/Foundation.h>
+@class DBBatchCounter;
+
+
+/** Small calls that Java can make in bulk through BatchCounter.Batch */
+@interface DBBatchCounter : NSObject
+
+/** Ignored while disabled */
+- (void)add:(int32_t)amount;
+
+- (int64_t)total;
+
+- (void)setScale:(float)scale;
+
+- (double)scaledTotal;
+
+- (void)setEnabled:(BOOL)enabled;
+
+- (BOOL)isEnabled;
+
+/** Not batched: returns a string */
+- (nonnull NSString *)describe;
+
++ (nullable DBBatchCounter *)create;
+
+@end
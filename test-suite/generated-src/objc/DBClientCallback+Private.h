@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#include "client_callback.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBClientCallback;
+
+namespace djinni_generated {
+
+class ClientCallback
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::ClientCallback>;
+    using ObjcType = id<DBClientCallback>;
+
+    using Boxed = ClientCallback;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
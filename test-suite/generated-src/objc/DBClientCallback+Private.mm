@@ -0,0 +1,47 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#import "DBClientCallback+Private.h"
+#import "DBClientCallback.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class ClientCallback::ObjcProxy final
+: public ::testsuite::ClientCallback
+, public ::djinni::ObjcProxyCache::Handle<ObjcType>
+{
+public:
+    using Handle::Handle;
+    void on_result(const std::string & c_result) override
+    {
+        @autoreleasepool {
+            [Handle::get() onResult:(::djinni::String::fromCpp(c_result))];
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto ClientCallback::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::get_objc_proxy<ObjcProxy>(objc);
+}
+
+auto ClientCallback::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** One-shot callback implemented by the client, not cached on the Java side */
+@protocol DBClientCallback
+
+- (void)onResult:(nonnull NSString *)result;
+
+@end
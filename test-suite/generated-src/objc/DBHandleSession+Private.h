@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+#include "handle_session.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBHandleSession;
+
+namespace djinni_generated {
+
+class HandleSession
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::HandleSession>;
+    using ObjcType = DBHandleSession*;
+
+    using Boxed = HandleSession;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
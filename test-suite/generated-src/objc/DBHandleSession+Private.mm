@@ -0,0 +1,81 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+#import "DBHandleSession+Private.h"
+#import "DBHandleSession.h"
+#import "DBHandleSession+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBHandleSession ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::HandleSession>&)cppRef;
+
+@end
+
+@implementation DBHandleSession {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::HandleSession>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::HandleSession>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (nonnull NSString *)name {
+    try {
+        auto r = _cppRefHandle.get()->name();
+        return ::djinni::String::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull DBHandleSession *)open:(nonnull NSString *)name {
+    try {
+        auto r = ::testsuite::HandleSession::open(::djinni::String::toCpp(name));
+        return ::djinni_generated::HandleSession::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSString *)nameOf:(nonnull DBHandleSession *)session {
+    try {
+        auto r = ::testsuite::HandleSession::name_of(::djinni_generated::HandleSession::toCpp(session));
+        return ::djinni::String::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int32_t)liveCount {
+    try {
+        auto r = ::testsuite::HandleSession::live_count();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto HandleSession::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto HandleSession::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBHandleSession>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
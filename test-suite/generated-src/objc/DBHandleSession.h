@@ -0,0 +1,20 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from handle.djinni
+
+#import <Foundation/Foundation.h>
+@class DBHandleSession;
+
+
+/** C++ state that Java and Objective-C only hold on to and pass back, see handle<T> */
+@interface DBHandleSession : NSObject
+
+- (nonnull NSString *)name;
+
++ (nonnull DBHandleSession *)open:(nonnull NSString *)name;
+
++ (nonnull NSString *)nameOf:(nonnull DBHandleSession *)session;
+
+/** Number of sessions that haven't been destroyed yet */
++ (int32_t)liveCount;
+
+@end
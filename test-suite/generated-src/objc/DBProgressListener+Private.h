@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#include "progress_listener.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBProgressListener;
+
+namespace djinni_generated {
+
+class ProgressListener
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::ProgressListener>;
+    using ObjcType = id<DBProgressListener>;
+
+    using Boxed = ProgressListener;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
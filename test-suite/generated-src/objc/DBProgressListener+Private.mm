@@ -0,0 +1,60 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#import "DBProgressListener+Private.h"
+#import "DBProgressListener.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class ProgressListener::ObjcProxy final
+: public ::testsuite::ProgressListener
+, public ::djinni::ObjcProxyCache::Handle<ObjcType>
+{
+public:
+    using Handle::Handle;
+    void started(const std::string & c_task) override
+    {
+        @autoreleasepool {
+            [Handle::get() started:(::djinni::String::fromCpp(c_task))];
+        }
+    }
+    void progress(int32_t c_done, int32_t c_total) override
+    {
+        @autoreleasepool {
+            [Handle::get() progress:(::djinni::I32::fromCpp(c_done))
+                              total:(::djinni::I32::fromCpp(c_total))];
+        }
+    }
+    void finished() override
+    {
+        @autoreleasepool {
+            [Handle::get() finished];
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto ProgressListener::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::get_objc_proxy<ObjcProxy>(objc);
+}
+
+auto ProgressListener::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,18 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from client_interface.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** Progress reported by C++, which doesn't wait for Java to handle it */
+@protocol DBProgressListener
+
+- (void)started:(nonnull NSString *)task;
+
+/** Only the latest progress matters, so progress Java hasn't received yet is replaced */
+- (void)progress:(int32_t)done
+           total:(int32_t)total;
+
+- (void)finished;
+
+@end
@@ -4,10 +4,12 @@
 #import "DBTestHelpers+Private.h"
 #import "DBTestHelpers.h"
 #import "DBAssortedPrimitives+Private.h"
+#import "DBClientCallback+Private.h"
 #import "DBClientInterface+Private.h"
 #import "DBMapListRecord+Private.h"
 #import "DBNestedCollection+Private.h"
 #import "DBPrimitiveList+Private.h"
+#import "DBProgressListener+Private.h"
 #import "DBSetRecord+Private.h"
 #import "DBUserToken+Private.h"
 #import "DJICppWrapperCache+Private.h"
@@ -132,6 +134,14 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
++ (void)callClientCallback:(nullable id<DBClientCallback>)cb
+                    result:(nonnull NSString *)result {
+    try {
+        ::testsuite::TestHelpers::call_client_callback(::djinni_generated::ClientCallback::toCpp(cb),
+                                                       ::djinni::String::toCpp(result));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 + (void)checkEnumMap:(nonnull NSDictionary<NSNumber *, NSString *> *)m {
     try {
         ::testsuite::TestHelpers::check_enum_map(::djinni::Map<::djinni::Enum<::testsuite::color, DBColor>, ::djinni::String>::toCpp(m));
@@ -158,6 +168,13 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
++ (nullable id<DBUserToken>)createLargeCppToken:(int64_t)nativeBytes {
+    try {
+        auto r = ::testsuite::TestHelpers::create_large_cpp_token(::djinni::I64::toCpp(nativeBytes));
+        return ::djinni_generated::UserToken::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 + (void)checkCppToken:(nullable id<DBUserToken>)t {
     try {
         ::testsuite::TestHelpers::check_cpp_token(::djinni_generated::UserToken::toCpp(t));
@@ -179,6 +196,51 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
++ (nonnull NSArray<id<DBUserToken>> *)tokenListId:(nonnull NSArray<id<DBUserToken>> *)l {
+    try {
+        auto r = ::testsuite::TestHelpers::token_list_id(::djinni::List<::djinni_generated::UserToken>::toCpp(l));
+        return ::djinni::List<::djinni_generated::UserToken>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSArray<id<DBUserToken>> *)createCppTokenList:(int32_t)count {
+    try {
+        auto r = ::testsuite::TestHelpers::create_cpp_token_list(::djinni::I32::toCpp(count));
+        return ::djinni::List<::djinni_generated::UserToken>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSArray<id<DBUserToken>> *)createRepeatedCppTokenList:(int32_t)count {
+    try {
+        auto r = ::testsuite::TestHelpers::create_repeated_cpp_token_list(::djinni::I32::toCpp(count));
+        return ::djinni::List<::djinni_generated::UserToken>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)holdCallback:(nullable id<DBClientCallback>)cb {
+    try {
+        ::testsuite::TestHelpers::hold_callback(::djinni_generated::ClientCallback::toCpp(cb));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)releaseHeldCallbackOnNativeThread {
+    try {
+        ::testsuite::TestHelpers::release_held_callback_on_native_thread();
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)holdToken:(nullable id<DBUserToken>)t {
+    try {
+        ::testsuite::TestHelpers::hold_token(::djinni_generated::UserToken::toCpp(t));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)releaseHeldTokenOnNativeThread {
+    try {
+        ::testsuite::TestHelpers::release_held_token_on_native_thread();
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 + (nullable NSNumber *)returnNone {
     try {
         auto r = ::testsuite::TestHelpers::return_none();
@@ -200,6 +262,80 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
++ (nonnull NSData *)idSharedBinary:(nonnull NSData *)b {
+    try {
+        auto r = ::testsuite::TestHelpers::id_shared_binary(::djinni::SharedBinary::toCpp(b));
+        return ::djinni::SharedBinary::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSData *)createSharedBinary:(int32_t)size {
+    try {
+        auto r = ::testsuite::TestHelpers::create_shared_binary(::djinni::I32::toCpp(size));
+        return ::djinni::SharedBinary::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int64_t)sharedBinaryData:(nonnull NSData *)b {
+    try {
+        auto r = ::testsuite::TestHelpers::shared_binary_data(::djinni::SharedBinary::toCpp(b));
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSData *)mapFileRegion:(nonnull NSString *)path
+                           offset:(int64_t)offset
+                           length:(int64_t)length {
+    try {
+        auto r = ::testsuite::TestHelpers::map_file_region(::djinni::String::toCpp(path),
+                                                           ::djinni::I64::toCpp(offset),
+                                                           ::djinni::I64::toCpp(length));
+        return ::djinni::MappedRegion::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int64_t)mappedRegionSum:(nonnull NSData *)region {
+    try {
+        auto r = ::testsuite::TestHelpers::mapped_region_sum(::djinni::MappedRegion::toCpp(region));
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int64_t)mappedRegionData:(nonnull NSData *)region {
+    try {
+        auto r = ::testsuite::TestHelpers::mapped_region_data(::djinni::MappedRegion::toCpp(region));
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int32_t)fillOutBuffer:(nonnull NSMutableData *)buf
+                    size:(int32_t)size {
+    try {
+        auto r = ::testsuite::TestHelpers::fill_out_buffer(::djinni::OutBuffer::toCpp(buf),
+                                                           ::djinni::I32::toCpp(size));
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSArray<NSString *> *)appendString:(nonnull NSArray<NSString *> *)strings
+                                            s:(nonnull NSString *)s {
+    try {
+        auto r = ::testsuite::TestHelpers::append_string(::djinni::List<::djinni::String>::toCpp(strings),
+                                                         ::djinni::String::toCpp(s));
+        return ::djinni::List<::djinni::String>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)reportProgress:(nullable id<DBProgressListener>)listener
+                  task:(nonnull NSString *)task
+                 steps:(int32_t)steps {
+    try {
+        ::testsuite::TestHelpers::report_progress(::djinni_generated::ProgressListener::toCpp(listener),
+                                                  ::djinni::String::toCpp(task),
+                                                  ::djinni::I32::toCpp(steps));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 namespace djinni_generated {
 
 auto TestHelpers::toCpp(ObjcType objc) -> CppType
@@ -8,7 +8,9 @@
 #import "DBPrimitiveList.h"
 #import "DBSetRecord.h"
 #import <Foundation/Foundation.h>
+@protocol DBClientCallback;
 @protocol DBClientInterface;
+@protocol DBProgressListener;
 @protocol DBUserToken;
 
 
@@ -53,6 +55,9 @@
 
 + (void)checkClientInterfaceNonascii:(nullable id<DBClientInterface>)i;
 
++ (void)callClientCallback:(nullable id<DBClientCallback>)cb
+                    result:(nonnull NSString *)result;
+
 + (void)checkEnumMap:(nonnull NSDictionary<NSNumber *, NSString *> *)m;
 
 + (void)checkEnum:(DBColor)c;
@@ -61,6 +66,8 @@
 
 + (nullable id<DBUserToken>)createCppToken;
 
++ (nullable id<DBUserToken>)createLargeCppToken:(int64_t)nativeBytes;
+
 + (void)checkCppToken:(nullable id<DBUserToken>)t;
 
 + (int64_t)cppTokenId:(nullable id<DBUserToken>)t;
@@ -68,6 +75,21 @@
 + (void)checkTokenType:(nullable id<DBUserToken>)t
                   type:(nonnull NSString *)type;
 
++ (nonnull NSArray<id<DBUserToken>> *)tokenListId:(nonnull NSArray<id<DBUserToken>> *)l;
+
++ (nonnull NSArray<id<DBUserToken>> *)createCppTokenList:(int32_t)count;
+
+/** One new C++ token, `count` times */
++ (nonnull NSArray<id<DBUserToken>> *)createRepeatedCppTokenList:(int32_t)count;
+
++ (void)holdCallback:(nullable id<DBClientCallback>)cb;
+
++ (void)releaseHeldCallbackOnNativeThread;
+
++ (void)holdToken:(nullable id<DBUserToken>)t;
+
++ (void)releaseHeldTokenOnNativeThread;
+
 + (nullable NSNumber *)returnNone;
 
 /** Ensures that we generate integer translation code */
@@ -75,4 +97,34 @@
 
 + (nonnull NSData *)idBinary:(nonnull NSData *)b;
 
++ (nonnull NSData *)idSharedBinary:(nonnull NSData *)b;
+
++ (nonnull NSData *)createSharedBinary:(int32_t)size;
+
+/** Address of the bytes, to check that they weren't copied */
++ (int64_t)sharedBinaryData:(nonnull NSData *)b;
+
++ (nonnull NSData *)mapFileRegion:(nonnull NSString *)path
+                           offset:(int64_t)offset
+                           length:(int64_t)length;
+
+/** Sum of the bytes, read in C++ */
++ (int64_t)mappedRegionSum:(nonnull NSData *)region;
+
+/** Address of the bytes, to check that they weren't copied */
++ (int64_t)mappedRegionData:(nonnull NSData *)region;
+
+/** Writes bytes 0, 1, 2, ... into buf, or returns the size needed if it doesn't fit */
++ (int32_t)fillOutBuffer:(nonnull NSMutableData *)buf
+                    size:(int32_t)size;
+
+/** Appends s to strings; both are moved into the implementation rather than copied */
++ (nonnull NSArray<NSString *> *)appendString:(nonnull NSArray<NSString *> *)strings
+                                            s:(nonnull NSString *)s;
+
+/** Reports a task of the given number of steps to the listener */
++ (void)reportProgress:(nullable id<DBProgressListener>)listener
+                  task:(nonnull NSString *)task
+                 steps:(int32_t)steps;
+
 @end
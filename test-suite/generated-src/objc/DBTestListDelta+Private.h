@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+#include "test_list_delta.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTestListDelta;
+
+namespace djinni_generated {
+
+class TestListDelta
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::TestListDelta>;
+    using ObjcType = DBTestListDelta*;
+
+    using Boxed = TestListDelta;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,68 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+#import "DBTestListDelta+Private.h"
+#import "DBTestListDelta.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTestListDelta ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestListDelta>&)cppRef;
+
+@end
+
+@implementation DBTestListDelta {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::TestListDelta>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestListDelta>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nonnull NSArray<NSString *> *)apply:(nonnull NSArray<NSString *> *)list
+                                 delta:(nonnull DJIListDelta<NSString *> *)delta {
+    try {
+        auto r = ::testsuite::TestListDelta::apply(::djinni::List<::djinni::String>::toCpp(list),
+                                                   ::djinni::ListDelta<::djinni::String>::toCpp(delta));
+        return ::djinni::List<::djinni::String>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull DJIListDelta<NSString *> *)edit:(nonnull NSArray<NSString *> *)list {
+    try {
+        auto r = ::testsuite::TestListDelta::edit(::djinni::List<::djinni::String>::toCpp(list));
+        return ::djinni::ListDelta<::djinni::String>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto TestListDelta::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto TestListDelta::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBTestListDelta>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
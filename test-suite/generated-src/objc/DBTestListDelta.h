@@ -0,0 +1,18 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from list_delta.djinni
+
+#import "DJIListDelta.h"
+#import <Foundation/Foundation.h>
+
+
+/** Lists updated through deltas instead of being copied whole. */
+@interface DBTestListDelta : NSObject
+
+/** Applies delta to list in C++ */
++ (nonnull NSArray<NSString *> *)apply:(nonnull NSArray<NSString *> *)list
+                                 delta:(nonnull DJIListDelta<NSString *> *)delta;
+
+/** Edits list through an observable_list and returns the recorded delta */
++ (nonnull DJIListDelta<NSString *> *)edit:(nonnull NSArray<NSString *> *)list;
+
+@end
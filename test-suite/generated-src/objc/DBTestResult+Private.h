@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from result.djinni
+
+#include "test_result.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTestResult;
+
+namespace djinni_generated {
+
+class TestResult
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::TestResult>;
+    using ObjcType = DBTestResult*;
+
+    using Boxed = TestResult;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
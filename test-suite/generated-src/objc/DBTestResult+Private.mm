@@ -0,0 +1,79 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from result.djinni
+
+#import "DBTestResult+Private.h"
+#import "DBTestResult.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTestResult ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestResult>&)cppRef;
+
+@end
+
+@implementation DBTestResult {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::TestResult>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestResult>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nonnull DJIResult<NSString *, NSNumber *> *)makeOk:(nonnull NSString *)value {
+    try {
+        auto r = ::testsuite::TestResult::make_ok(::djinni::String::toCpp(value));
+        return ::djinni::Result<::djinni::String, ::djinni::I32>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull DJIResult<NSString *, NSNumber *> *)makeError:(int32_t)code {
+    try {
+        auto r = ::testsuite::TestResult::make_error(::djinni::I32::toCpp(code));
+        return ::djinni::Result<::djinni::String, ::djinni::I32>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSString *)describe:(nonnull DJIResult<NSString *, NSNumber *> *)res {
+    try {
+        auto r = ::testsuite::TestResult::describe(::djinni::Result<::djinni::String, ::djinni::I32>::toCpp(res));
+        return ::djinni::String::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)checkThrowingMoveAssignment {
+    try {
+        ::testsuite::TestResult::check_throwing_move_assignment();
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto TestResult::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto TestResult::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBTestResult>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
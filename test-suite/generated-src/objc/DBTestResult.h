@@ -0,0 +1,20 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from result.djinni
+
+#import "DJIResult.h"
+#import <Foundation/Foundation.h>
+
+
+/** Errors returned as values instead of being thrown. */
+@interface DBTestResult : NSObject
+
++ (nonnull DJIResult<NSString *, NSNumber *> *)makeOk:(nonnull NSString *)value;
+
++ (nonnull DJIResult<NSString *, NSNumber *> *)makeError:(int32_t)code;
+
++ (nonnull NSString *)describe:(nonnull DJIResult<NSString *, NSNumber *> *)res;
+
+/** Throws unless an expected<T, E> assignment whose move constructor throws leaves its target unchanged */
++ (void)checkThrowingMoveAssignment;
+
+@end
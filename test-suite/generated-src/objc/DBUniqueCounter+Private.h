@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+#include "unique_counter.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBUniqueCounter;
+
+namespace djinni_generated {
+
+class UniqueCounter
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::UniqueCounter>;
+    using ObjcType = DBUniqueCounter*;
+
+    using Boxed = UniqueCounter;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,74 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+#import "DBUniqueCounter+Private.h"
+#import "DBUniqueCounter.h"
+#import "DBUniqueCounter+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBUniqueCounter ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::UniqueCounter>&)cppRef;
+
+@end
+
+@implementation DBUniqueCounter {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::UniqueCounter>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::UniqueCounter>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (int32_t)increment {
+    try {
+        auto r = _cppRefHandle.get()->increment();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable DBUniqueCounter *)create:(int32_t)start {
+    try {
+        auto r = ::testsuite::UniqueCounter::create(::djinni::I32::toCpp(start));
+        return ::djinni_generated::UniqueCounter::fromCpp(std::move(r));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int32_t)liveCount {
+    try {
+        auto r = ::testsuite::UniqueCounter::live_count();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto UniqueCounter::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto UniqueCounter::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBUniqueCounter>(cpp);
+}
+
+}  // namespace djinni_generated
+
+@end
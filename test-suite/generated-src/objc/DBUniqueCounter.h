@@ -0,0 +1,18 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from unique.djinni
+
+#import <Foundation/Foundation.h>
+@class DBUniqueCounter;
+
+
+/** Owned by the one proxy it's returned to, without reference counting or a proxy cache */
+@interface DBUniqueCounter : NSObject
+
+- (int32_t)increment;
+
++ (nullable DBUniqueCounter *)create:(int32_t)start;
+
+/** Number of counters that haven't been destroyed yet */
++ (int32_t)liveCount;
+
+@end
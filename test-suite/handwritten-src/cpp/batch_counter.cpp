@@ -0,0 +1,39 @@
+#include "batch_counter.hpp"
+
+namespace testsuite {
+
+namespace {
+
+class BatchCounterImpl final : public BatchCounter {
+public:
+    void add(int32_t amount) override {
+        if (m_enabled) {
+            m_total += amount;
+        }
+    }
+
+    int64_t total() override { return m_total; }
+
+    void set_scale(float scale) override { m_scale = scale; }
+
+    double scaled_total() override { return m_total * static_cast<double>(m_scale); }
+
+    void set_enabled(bool enabled) override { m_enabled = enabled; }
+
+    bool is_enabled() override { return m_enabled; }
+
+    std::string describe() override { return std::to_string(m_total); }
+
+private:
+    int64_t m_total = 0;
+    float m_scale = 1;
+    bool m_enabled = true;
+};
+
+} // namespace
+
+std::shared_ptr<BatchCounter> BatchCounter::create() {
+    return std::make_shared<BatchCounterImpl>();
+}
+
+} // namespace testsuite
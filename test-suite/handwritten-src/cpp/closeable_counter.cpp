@@ -0,0 +1,54 @@
+#include "closeable_counter.hpp"
+#include "closeable_unique_counter.hpp"
+#include <atomic>
+
+namespace testsuite {
+
+namespace {
+
+std::atomic<int32_t> s_live_count { 0 };
+std::atomic<int32_t> s_live_unique_count { 0 };
+
+class CloseableCounterImpl final : public CloseableCounter {
+public:
+    CloseableCounterImpl() { ++s_live_count; }
+    ~CloseableCounterImpl() { --s_live_count; }
+
+    void add(int32_t amount) override { m_total += amount; }
+
+    int64_t total() override { return m_total; }
+
+private:
+    int64_t m_total = 0;
+};
+
+class CloseableUniqueCounterImpl final : public CloseableUniqueCounter {
+public:
+    CloseableUniqueCounterImpl(int32_t start) : m_value(start) { ++s_live_unique_count; }
+    ~CloseableUniqueCounterImpl() { --s_live_unique_count; }
+
+    int32_t increment() override { return ++m_value; }
+
+private:
+    int32_t m_value;
+};
+
+} // namespace
+
+std::shared_ptr<CloseableCounter> CloseableCounter::create() {
+    return std::make_shared<CloseableCounterImpl>();
+}
+
+int32_t CloseableCounter::live_count() {
+    return s_live_count;
+}
+
+std::unique_ptr<CloseableUniqueCounter> CloseableUniqueCounter::create(int32_t start) {
+    return std::unique_ptr<CloseableUniqueCounter>(new CloseableUniqueCounterImpl(start));
+}
+
+int32_t CloseableUniqueCounter::live_count() {
+    return s_live_unique_count;
+}
+
+} // namespace testsuite
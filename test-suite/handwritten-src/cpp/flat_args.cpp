@@ -0,0 +1,37 @@
+#include "flat_args.hpp"
+#include "flat_args_callback.hpp"
+
+namespace testsuite {
+
+namespace {
+
+class FlatArgsImpl final : public FlatArgs {
+public:
+    FlatPoint translate(const FlatPoint & p, double dx, double dy) override {
+        return {p.x + dx, p.y + dy};
+    }
+};
+
+} // namespace
+
+std::shared_ptr<FlatArgs> FlatArgs::create() {
+    return std::make_shared<FlatArgsImpl>();
+}
+
+std::chrono::system_clock::time_point FlatArgs::later(const std::chrono::system_clock::time_point & d,
+                                                      int64_t millis) {
+    return d + std::chrono::milliseconds(millis);
+}
+
+FlatPoint FlatArgs::translate_with(const std::shared_ptr<FlatArgsCallback> & cb, const FlatPoint & p,
+                                   double dx, double dy) {
+    return cb->translate(p, dx, dy);
+}
+
+std::chrono::system_clock::time_point FlatArgs::later_with(const std::shared_ptr<FlatArgsCallback> & cb,
+                                                           const std::chrono::system_clock::time_point & d,
+                                                           int64_t millis) {
+    return cb->later(d, millis);
+}
+
+} // namespace testsuite
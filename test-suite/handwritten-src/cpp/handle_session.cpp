@@ -0,0 +1,35 @@
+#include "handle_session.hpp"
+#include <atomic>
+
+namespace testsuite {
+
+namespace {
+
+std::atomic<int32_t> s_live_count { 0 };
+
+class HandleSessionImpl final : public HandleSession {
+public:
+    HandleSessionImpl(std::string name) : m_name(std::move(name)) { ++s_live_count; }
+    ~HandleSessionImpl() { --s_live_count; }
+
+    std::string name() override { return m_name; }
+
+private:
+    const std::string m_name;
+};
+
+} // namespace
+
+std::shared_ptr<HandleSession> HandleSession::open(const std::string & name) {
+    return std::make_shared<HandleSessionImpl>(name);
+}
+
+std::string HandleSession::name_of(const std::shared_ptr<HandleSession> & session) {
+    return session->name();
+}
+
+int32_t HandleSession::live_count() {
+    return s_live_count;
+}
+
+} // namespace testsuite
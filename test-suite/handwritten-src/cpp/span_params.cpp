@@ -0,0 +1,25 @@
+#include "span_params.hpp"
+#include <stdexcept>
+
+namespace testsuite {
+
+int64_t SpanParams::sum_i32_list(::djinni::span<const int32_t> values) {
+    int64_t sum = 0;
+    for (int32_t value : values) {
+        sum += value;
+    }
+    return sum;
+}
+
+double SpanParams::dot_f64_lists(::djinni::span<const double> a, ::djinni::span<const double> b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot_f64_lists: lists of different sizes");
+    }
+    double dot = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        dot += a[i] * b[i];
+    }
+    return dot;
+}
+
+} // namespace testsuite
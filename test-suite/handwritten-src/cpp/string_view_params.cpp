@@ -0,0 +1,13 @@
+#include "string_view_params.hpp"
+
+namespace testsuite {
+
+int32_t StringViewParams::utf8_length(std::experimental::string_view s) {
+    return static_cast<int32_t>(s.size());
+}
+
+std::string StringViewParams::echo(std::experimental::string_view s) {
+    return std::string(s);
+}
+
+} // namespace testsuite
@@ -1,8 +1,13 @@
 #include "test_helpers.hpp"
 #include "client_returned_record.hpp"
 #include "client_interface.hpp"
+#include "client_callback.hpp"
+#include "progress_listener.hpp"
 #include "user_token.hpp"
+#include "djinni_native_memory.hpp"
 #include <exception>
+#include <stdexcept>
+#include <thread>
 
 namespace testsuite {
 
@@ -88,6 +93,10 @@ void TestHelpers::check_client_interface_nonascii(const std::shared_ptr<ClientIn
     }
 }
 
+void TestHelpers::call_client_callback(const std::shared_ptr<ClientCallback> & cb, const std::string & result) {
+    cb->on_result(result);
+}
+
 std::shared_ptr<UserToken> TestHelpers::token_id(const std::shared_ptr<UserToken> & in) {
     return in;
 }
@@ -100,6 +109,15 @@ std::shared_ptr<UserToken> TestHelpers::create_cpp_token() {
     return std::make_shared<CppToken>();
 }
 
+class LargeCppToken : public CppToken, public djinni::NativeMemoryReporter {
+public:
+    LargeCppToken(int64_t bytes) { set_native_bytes(static_cast<size_t>(bytes)); }
+};
+
+std::shared_ptr<UserToken> TestHelpers::create_large_cpp_token(int64_t native_bytes) {
+    return std::make_shared<LargeCppToken>(native_bytes);
+}
+
 void TestHelpers::check_cpp_token(const std::shared_ptr<UserToken> & in) {
     // Throws bad_cast if type is wrong
     (void)dynamic_cast<CppToken &>(*in);
@@ -115,6 +133,43 @@ void TestHelpers::check_token_type(const std::shared_ptr<UserToken> &t, const st
     }
 }
 
+std::vector<std::shared_ptr<UserToken>> TestHelpers::token_list_id(const std::vector<std::shared_ptr<UserToken>> & l) {
+    return l;
+}
+
+std::vector<std::shared_ptr<UserToken>> TestHelpers::create_cpp_token_list(int32_t count) {
+    std::vector<std::shared_ptr<UserToken>> tokens;
+    for (int32_t i = 0; i < count; ++i) {
+        tokens.push_back(std::make_shared<CppToken>());
+    }
+    return tokens;
+}
+
+std::vector<std::shared_ptr<UserToken>> TestHelpers::create_repeated_cpp_token_list(int32_t count) {
+    return std::vector<std::shared_ptr<UserToken>>(count, std::make_shared<CppToken>());
+}
+
+static std::shared_ptr<ClientCallback> s_heldCallback;
+
+void TestHelpers::hold_callback(const std::shared_ptr<ClientCallback> & cb) {
+    s_heldCallback = cb;
+}
+
+void TestHelpers::release_held_callback_on_native_thread() {
+    // Drops the last reference on a thread that was never attached to the JVM.
+    std::thread([cb = std::move(s_heldCallback)] () mutable { cb.reset(); }).join();
+}
+
+static std::shared_ptr<UserToken> s_heldToken;
+
+void TestHelpers::hold_token(const std::shared_ptr<UserToken> & t) {
+    s_heldToken = t;
+}
+
+void TestHelpers::release_held_token_on_native_thread() {
+    std::thread([t = std::move(s_heldToken)] () mutable { t.reset(); }).join();
+}
+
 std::experimental::optional<int32_t> TestHelpers::return_none() {
     return {};
 }
@@ -145,4 +200,58 @@ std::vector<uint8_t> TestHelpers::id_binary(const std::vector<uint8_t> & v) {
     return v;
 }
 
+std::shared_ptr<const std::vector<uint8_t>> TestHelpers::id_shared_binary(const std::shared_ptr<const std::vector<uint8_t>> & b) {
+    return b;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> TestHelpers::create_shared_binary(int32_t size) {
+    auto bytes = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(size));
+    for (int32_t i = 0; i < size; ++i) {
+        (*bytes)[static_cast<size_t>(i)] = static_cast<uint8_t>(i);
+    }
+    return bytes;
+}
+
+int64_t TestHelpers::shared_binary_data(const std::shared_ptr<const std::vector<uint8_t>> & b) {
+    return static_cast<int64_t>(reinterpret_cast<uintptr_t>(b->data()));
+}
+
+::djinni::mapped_region TestHelpers::map_file_region(const std::string & path, int64_t offset, int64_t length) {
+    return ::djinni::mapped_region::map_file(path, static_cast<uint64_t>(offset), static_cast<size_t>(length));
+}
+
+int64_t TestHelpers::mapped_region_sum(const ::djinni::mapped_region & region) {
+    int64_t sum = 0;
+    for (uint8_t byte : region) {
+        sum += byte;
+    }
+    return sum;
+}
+
+int64_t TestHelpers::mapped_region_data(const ::djinni::mapped_region & region) {
+    return static_cast<int64_t>(reinterpret_cast<uintptr_t>(region.data()));
+}
+
+int32_t TestHelpers::fill_out_buffer(::djinni::out_buffer buf, int32_t size) {
+    if (buf.fits(static_cast<size_t>(size))) {
+        for (int32_t i = 0; i < size; ++i) {
+            buf.data()[i] = static_cast<uint8_t>(i);
+        }
+    }
+    return size;
+}
+
+std::vector<std::string> TestHelpers::append_string(std::vector<std::string> strings, std::string s) {
+    strings.push_back(std::move(s));
+    return strings;
+}
+
+void TestHelpers::report_progress(const std::shared_ptr<ProgressListener> & listener, const std::string & task, int32_t steps) {
+    listener->started(task);
+    for (int32_t done = 1; done <= steps; ++done) {
+        listener->progress(done, steps);
+    }
+    listener->finished();
+}
+
 } // namespace testsuite
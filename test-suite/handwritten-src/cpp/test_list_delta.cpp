@@ -0,0 +1,20 @@
+#include "test_list_delta.hpp"
+
+namespace testsuite {
+
+std::vector<std::string> TestListDelta::apply(const std::vector<std::string> & list,
+                                              const djinni::list_delta<std::string> & delta) {
+    auto result = list;
+    delta.apply_to(result);
+    return result;
+}
+
+djinni::list_delta<std::string> TestListDelta::edit(const std::vector<std::string> & list) {
+    djinni::observable_list<std::string> observable(list);
+    observable.push_back("end");
+    observable.set(0, "start");
+    observable.erase(1);
+    return observable.take_delta();
+}
+
+} // namespace testsuite
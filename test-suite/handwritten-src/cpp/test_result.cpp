@@ -0,0 +1,72 @@
+#include "test_result.hpp"
+#include <stdexcept>
+
+namespace testsuite {
+
+namespace {
+
+// Throws from its move constructor if asked to.
+struct ThrowingMove {
+    explicit ThrowingMove(bool throws) : throws(throws) {}
+    ThrowingMove(ThrowingMove && other) : throws(other.throws) {
+        if (throws) {
+            throw std::runtime_error("move failed");
+        }
+    }
+    ThrowingMove & operator=(ThrowingMove && other) = default;
+    bool throws;
+};
+
+// Can only be moved, and only without throwing, so assignment never needs a backup copy.
+struct MoveOnly {
+    MoveOnly() = default;
+    MoveOnly(MoveOnly &&) noexcept = default;
+    MoveOnly & operator=(MoveOnly &&) noexcept = default;
+    MoveOnly(const MoveOnly &) = delete;
+};
+
+static_assert(std::is_nothrow_move_constructible<djinni::expected<std::string, int32_t>>::value,
+              "expected should move without throwing when T and E do");
+static_assert(!std::is_nothrow_move_constructible<djinni::expected<ThrowingMove, int32_t>>::value,
+              "expected should not claim a nothrow move when T can throw");
+
+} // namespace
+
+djinni::expected<std::string, int32_t> TestResult::make_ok(const std::string & value) {
+    return value;
+}
+
+djinni::expected<std::string, int32_t> TestResult::make_error(int32_t code) {
+    return djinni::make_unexpected(code);
+}
+
+std::string TestResult::describe(const djinni::expected<std::string, int32_t> & res) {
+    return res ? "ok: " + *res : "error: " + std::to_string(res.error());
+}
+
+void TestResult::check_throwing_move_assignment() {
+    djinni::expected<ThrowingMove, std::string> target = djinni::make_unexpected(std::string("kept"));
+    djinni::expected<ThrowingMove, std::string> source {ThrowingMove(false)};
+    source->throws = true;
+    bool threw = false;
+    try {
+        target = std::move(source);
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    if (!threw || target.has_value() || target.error() != "kept") {
+        throw std::logic_error("failed assignment changed its target");
+    }
+    source->throws = false;
+    target = std::move(source);
+    if (!target.has_value()) {
+        throw std::logic_error("assignment did not take the value");
+    }
+    djinni::expected<MoveOnly, MoveOnly> move_only = djinni::make_unexpected(MoveOnly());
+    move_only = djinni::expected<MoveOnly, MoveOnly>(MoveOnly());
+    if (!move_only.has_value()) {
+        throw std::logic_error("assignment did not take the move-only value");
+    }
+}
+
+} // namespace testsuite
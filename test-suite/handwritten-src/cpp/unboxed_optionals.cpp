@@ -0,0 +1,24 @@
+#include "unboxed_optionals.hpp"
+#include "unboxed_optionals_callback.hpp"
+
+namespace testsuite {
+
+UnboxedOptionalsRecord UnboxedOptionals::record_id(const UnboxedOptionalsRecord & rec) {
+    return rec;
+}
+
+std::experimental::optional<double> UnboxedOptionals::scale(std::experimental::optional<double> v,
+                                                            std::experimental::optional<int32_t> factor) {
+    if (!v || !factor) {
+        return {};
+    }
+    return *v * *factor;
+}
+
+std::experimental::optional<double> UnboxedOptionals::scale_with(const std::shared_ptr<UnboxedOptionalsCallback> & cb,
+                                                                 std::experimental::optional<double> v,
+                                                                 std::experimental::optional<int32_t> factor) {
+    return cb->scale(v, factor);
+}
+
+} // namespace testsuite
@@ -0,0 +1,31 @@
+#include "unique_counter.hpp"
+#include <atomic>
+
+namespace testsuite {
+
+namespace {
+
+std::atomic<int32_t> s_live_count { 0 };
+
+class UniqueCounterImpl final : public UniqueCounter {
+public:
+    UniqueCounterImpl(int32_t start) : m_value(start) { ++s_live_count; }
+    ~UniqueCounterImpl() { --s_live_count; }
+
+    int32_t increment() override { return ++m_value; }
+
+private:
+    int32_t m_value;
+};
+
+} // namespace
+
+std::unique_ptr<UniqueCounter> UniqueCounter::create(int32_t start) {
+    return std::unique_ptr<UniqueCounter>(new UniqueCounterImpl(start));
+}
+
+int32_t UniqueCounter::live_count() {
+    return s_live_count;
+}
+
+} // namespace testsuite
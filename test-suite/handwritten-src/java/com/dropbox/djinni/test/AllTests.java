@@ -21,6 +21,25 @@ public class AllTests extends TestSuite {
         mySuite.addTestSuite(PrimitivesTest.class);
         mySuite.addTestSuite(TokenTest.class);
         mySuite.addTestSuite(DurationTest.class);
+        mySuite.addTestSuite(ResultTest.class);
+        mySuite.addTestSuite(CallMetricsTest.class);
+        mySuite.addTestSuite(TracingTest.class);
+        mySuite.addTestSuite(JniCallCountersTest.class);
+        mySuite.addTestSuite(JniRefStatsTest.class);
+        mySuite.addTestSuite(SharedBinaryTest.class);
+        mySuite.addTestSuite(MappedRegionTest.class);
+        mySuite.addTestSuite(OutBufferTest.class);
+        mySuite.addTestSuite(SpanParamsTest.class);
+        mySuite.addTestSuite(StringViewParamsTest.class);
+        mySuite.addTestSuite(MoveParamsTest.class);
+        mySuite.addTestSuite(UniqueInterfaceTest.class);
+        mySuite.addTestSuite(HandleTest.class);
+        mySuite.addTestSuite(OnewayTest.class);
+        mySuite.addTestSuite(ListDeltaTest.class);
+        mySuite.addTestSuite(CallBatchTest.class);
+        mySuite.addTestSuite(FlatArgsTest.class);
+        mySuite.addTestSuite(UnboxedOptionalsTest.class);
+        mySuite.addTestSuite(CloseableInterfacesTest.class);
         return mySuite;
     }
 
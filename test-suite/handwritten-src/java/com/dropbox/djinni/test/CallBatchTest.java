@@ -0,0 +1,41 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CallBatch;
+import junit.framework.TestCase;
+
+public class CallBatchTest extends TestCase {
+
+    public void testRunsCallsInOrder() {
+        BatchCounter counter = BatchCounter.create();
+        BatchCounter.Batch batch = new BatchCounter.Batch(counter);
+        for (int i = 1; i <= 100; ++i) {
+            batch.add(i);
+        }
+        int total = batch.total();
+        batch.setEnabled(false);
+        batch.add(1000);
+        int enabled = batch.isEnabled();
+        batch.setScale(0.5f);
+        int scaled = batch.scaledTotal();
+        assertEquals(105, batch.size());
+
+        CallBatch.Results results = batch.run();
+        assertEquals(3, results.size());
+        assertEquals(5050, results.getLong(total));
+        assertFalse(results.getBoolean(enabled));
+        assertEquals(2525.0, results.getDouble(scaled));
+        assertEquals("5050", counter.describe());
+    }
+
+    public void testBatchIsReusable() {
+        BatchCounter counter = BatchCounter.create();
+        BatchCounter.Batch batch = new BatchCounter.Batch(counter);
+        assertEquals(0, batch.run().size());
+        batch.add(2);
+        batch.run();
+        assertTrue(batch.isEmpty());
+        int total = batch.total();
+        assertEquals(0, total);
+        assertEquals(2, batch.run().getLong(total));
+    }
+}
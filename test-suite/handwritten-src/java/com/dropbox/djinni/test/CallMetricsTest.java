@@ -0,0 +1,66 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CallMetrics;
+
+import junit.framework.TestCase;
+
+public class CallMetricsTest extends TestCase {
+
+    private static CallMetrics.Method find(String name) {
+        for (CallMetrics.Method m : CallMetrics.snapshot()) {
+            if (m.name.equals(name)) {
+                return m;
+            }
+        }
+        return null;
+    }
+
+    @Override
+    protected void setUp() {
+        assertTrue(CallMetrics.isEnabled());
+        CallMetrics.reset();
+    }
+
+    public void testJavaToCpp() {
+        TestHelpers.checkSetRecord(TestHelpers.getSetRecord());
+        TestHelpers.checkSetRecord(TestHelpers.getSetRecord());
+        CallMetrics.Method m = find("com.dropbox.djinni.test.TestHelpers.checkSetRecord");
+        assertNotNull(m);
+        assertTrue(m.javaToCpp);
+        assertEquals(2, m.calls);
+        assertEquals(0, m.errors);
+        long histogramCalls = 0;
+        for (long bucket : m.bodyHistogram) {
+            histogramCalls += bucket;
+        }
+        assertEquals(2, histogramCalls);
+    }
+
+    public void testInstanceMethod() {
+        UserToken token = TestHelpers.createCppToken();
+        token.whoami();
+        CallMetrics.Method m = find("com.dropbox.djinni.test.UserToken.whoami");
+        assertNotNull(m);
+        assertTrue(m.javaToCpp);
+        assertEquals(1, m.calls);
+    }
+
+    public void testCppToJava() {
+        TestHelpers.checkClientInterfaceAscii(new ClientInterfaceImpl());
+        CallMetrics.Method m = find("com.dropbox.djinni.test.ClientInterface.getRecord");
+        assertNotNull(m);
+        assertFalse(m.javaToCpp);
+        assertEquals(1, m.calls);
+    }
+
+    public void testError() {
+        try {
+            CppException.get().throwAnException();
+        } catch (RuntimeException e) {
+        }
+        CallMetrics.Method m = find("com.dropbox.djinni.test.CppException.throwAnException");
+        assertNotNull(m);
+        assertEquals(1, m.calls);
+        assertEquals(1, m.errors);
+    }
+}
@@ -0,0 +1,76 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class CloseableInterfacesTest extends TestCase {
+
+    public void testCloseDeletes() {
+        int before = CloseableCounter.liveCount();
+        CloseableCounter counter = CloseableCounter.create();
+        counter.add(2);
+        assertEquals(2, counter.total());
+        assertEquals(before + 1, CloseableCounter.liveCount());
+        counter.close();
+        assertEquals(before, CloseableCounter.liveCount());
+        // Closing twice does nothing
+        counter.close();
+        boolean threw = false;
+        try {
+            counter.total();
+        } catch (IllegalStateException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+
+    public void testTryWithResources() {
+        int before = CloseableCounter.liveCount();
+        try (CloseableCounter counter = CloseableCounter.create()) {
+            assertEquals(before + 1, CloseableCounter.liveCount());
+        }
+        assertEquals(before, CloseableCounter.liveCount());
+    }
+
+    public void testCloseJavaImplementation() {
+        CloseableCounter counter = new CloseableCounter() {
+            private long mTotal;
+            public void add(int amount) { mTotal += amount; }
+            public long total() { return mTotal; }
+        };
+        counter.add(3);
+        counter.close();
+        assertEquals(3, counter.total());
+    }
+
+    public void testCloseUnique() {
+        int before = CloseableUniqueCounter.liveCount();
+        CloseableUniqueCounter counter = CloseableUniqueCounter.create(0);
+        assertEquals(1, counter.increment());
+        assertEquals(before + 1, CloseableUniqueCounter.liveCount());
+        counter.close();
+        assertEquals(before, CloseableUniqueCounter.liveCount());
+        counter.close();
+        boolean threw = false;
+        try {
+            counter.increment();
+        } catch (IllegalStateException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+
+    public void testBatchRejectsClosedTarget() {
+        CloseableCounter counter = CloseableCounter.create();
+        CloseableCounter.Batch batch = new CloseableCounter.Batch(counter);
+        batch.add(1);
+        counter.close();
+        boolean threw = false;
+        try {
+            batch.run();
+        } catch (IllegalStateException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+        assertTrue(batch.isEmpty());
+    }
+}
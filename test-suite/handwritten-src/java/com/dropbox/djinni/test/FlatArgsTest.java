@@ -0,0 +1,49 @@
+package com.dropbox.djinni.test;
+
+import java.util.Date;
+import junit.framework.TestCase;
+
+public class FlatArgsTest extends TestCase {
+
+    static class JavaFlatArgs extends FlatArgsCallback {
+        @Override
+        public FlatPoint translate(FlatPoint p, double dx, double dy) {
+            return new FlatPoint(p.getX() + dx, p.getY() + dy);
+        }
+
+        @Override
+        public Date later(Date d, long millis) {
+            return new Date(d.getTime() + millis);
+        }
+    }
+
+    public void testCppProxyMethod() {
+        FlatArgs args = FlatArgs.create();
+        FlatPoint p = args.translate(new FlatPoint(1.5, -2), 0.5, 4);
+        assertEquals(2.0, p.getX());
+        assertEquals(2.0, p.getY());
+    }
+
+    public void testStaticMethod() {
+        Date d = new Date(1234567890123L);
+        assertEquals(new Date(1234567891123L), FlatArgs.later(d, 1000));
+    }
+
+    public void testJavaProxyMethods() {
+        JavaFlatArgs cb = new JavaFlatArgs();
+        FlatPoint p = FlatArgs.translateWith(cb, new FlatPoint(-1, 1), 3, -3);
+        assertEquals(2.0, p.getX());
+        assertEquals(-2.0, p.getY());
+        assertEquals(new Date(-5000), FlatArgs.laterWith(cb, new Date(-2000), -3000));
+    }
+
+    public void testNullRecordThrows() {
+        FlatArgs args = FlatArgs.create();
+        try {
+            args.translate(null, 0, 0);
+            fail("expected NullPointerException");
+        } catch (NullPointerException e) {
+            // The record is taken apart in Java, before the native call.
+        }
+    }
+}
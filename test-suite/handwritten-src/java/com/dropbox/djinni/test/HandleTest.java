@@ -0,0 +1,42 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.Handle;
+import junit.framework.TestCase;
+
+public class HandleTest extends TestCase {
+
+    public void testRoundTrip() {
+        Handle<HandleSession> session = HandleSession.open("first");
+        assertEquals("first", HandleSession.nameOf(session));
+        assertEquals("first", HandleSession.nameOf(session));
+        session.close();
+    }
+
+    public void testHandlesAreDistinct() {
+        Handle<HandleSession> a = HandleSession.open("a");
+        Handle<HandleSession> b = HandleSession.open("b");
+        assertNotSame(a, b);
+        assertEquals("a", HandleSession.nameOf(a));
+        assertEquals("b", HandleSession.nameOf(b));
+        a.close();
+        b.close();
+    }
+
+    public void testCloseReleases() {
+        int before = HandleSession.liveCount();
+        Handle<HandleSession> session = HandleSession.open("closed");
+        assertEquals(before + 1, HandleSession.liveCount());
+        session.close();
+        assertEquals(before, HandleSession.liveCount());
+        // Closing twice does nothing
+        session.close();
+        assertEquals(before, HandleSession.liveCount());
+        boolean threw = false;
+        try {
+            HandleSession.nameOf(session);
+        } catch (Error e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+}
@@ -0,0 +1,69 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.NativeLibLoader;
+
+import java.util.ArrayList;
+
+/**
+ * Times interfaces crossing the boundary in both directions, one at a time and in lists.
+ * Run with "ant compile benchmark" in test-suite/java. The test library is built with the
+ * JNI call counters enabled, so compare numbers between builds rather than against other code.
+ */
+public class InterfaceBenchmark {
+
+    private static final int LIST_SIZE = 1000;
+    private static final long MIN_NANOS = 500L * 1000 * 1000;
+
+    private static class JavaToken extends UserToken {
+        public String whoami() { return "Java"; }
+    }
+
+    private static void run(String name, int opsPerRun, Runnable r) {
+        // Warm up, then repeat until the timing is long enough to be meaningful.
+        for (int i = 0; i < 1000; ++i) {
+            r.run();
+        }
+        long runs = 0;
+        long start = System.nanoTime();
+        long elapsed;
+        do {
+            for (int i = 0; i < 100; ++i) {
+                r.run();
+            }
+            runs += 100;
+            elapsed = System.nanoTime() - start;
+        } while (elapsed < MIN_NANOS);
+        System.out.println(String.format("%-32s %10.1f ns/interface", name,
+                                         (double) elapsed / (runs * opsPerRun)));
+    }
+
+    private static ArrayList<UserToken> tokens(boolean cpp) {
+        ArrayList<UserToken> list = new ArrayList<UserToken>(LIST_SIZE);
+        for (int i = 0; i < LIST_SIZE; ++i) {
+            list.add(cpp ? TestHelpers.createCppToken() : new JavaToken());
+        }
+        return list;
+    }
+
+    public static void main(String[] args) throws Exception {
+        NativeLibLoader.loadLibs();
+
+        final UserToken cppToken = TestHelpers.createCppToken();
+        final UserToken javaToken = new JavaToken();
+        final ArrayList<UserToken> cppTokens = tokens(true);
+        final ArrayList<UserToken> javaTokens = tokens(false);
+
+        run("C++ token round trip", 1, new Runnable() {
+            public void run() { TestHelpers.tokenId(cppToken); }
+        });
+        run("Java token round trip", 1, new Runnable() {
+            public void run() { TestHelpers.tokenId(javaToken); }
+        });
+        run("C++ token list round trip", LIST_SIZE, new Runnable() {
+            public void run() { TestHelpers.tokenListId(cppTokens); }
+        });
+        run("Java token list round trip", LIST_SIZE, new Runnable() {
+            public void run() { TestHelpers.tokenListId(javaTokens); }
+        });
+    }
+}
@@ -0,0 +1,103 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.JniCallCounters;
+
+import java.util.ArrayList;
+
+import junit.framework.TestCase;
+
+public class JniCallCountersTest extends TestCase {
+
+    // Regression budgets for marshalling. Raise them only knowingly.
+    private static final long MAP_ENTRY_CALL_BUDGET = 10;
+
+    @Override
+    protected void setUp() {
+        assertTrue(JniCallCounters.isEnabled());
+    }
+
+    private static long callsFor(Runnable r) {
+        long before = JniCallCounters.threadCalls();
+        r.run();
+        return JniCallCounters.threadCalls() - before;
+    }
+
+    public void testCountsAreDeterministic() {
+        Runnable getMap = new Runnable() {
+            public void run() { TestHelpers.getMap(); }
+        };
+        long first = callsFor(getMap);
+        assertTrue(first > 0);
+        assertEquals(first, callsFor(getMap));
+    }
+
+    public void testMapEntryBudget() {
+        long empty = callsFor(new Runnable() {
+            public void run() { TestHelpers.getEmptyMap(); }
+        });
+        long full = callsFor(new Runnable() {
+            public void run() { TestHelpers.getMap(); }
+        });
+        // getMap() returns three entries.
+        long perEntry = (full - empty) / 3;
+        assertTrue("JNI calls per map entry: " + perEntry + "\n" + JniCallCounters.threadReport(),
+                   perEntry <= MAP_ENTRY_CALL_BUDGET);
+    }
+
+    public void testCallsToSingleFunction() {
+        long before = JniCallCounters.threadCallsTo("CallStaticObjectMethod");
+        TestHelpers.getPrimitiveList();
+        // One Long.valueOf() per element of [1, 2, 3].
+        assertEquals(3, JniCallCounters.threadCallsTo("CallStaticObjectMethod") - before);
+    }
+
+    public void testCppProxyTransitions() {
+        long newObjects = JniCallCounters.threadCallsTo("NewObject");
+        long lookups = JniCallCounters.threadCallsTo("CallStaticObjectMethod");
+        UserToken token = TestHelpers.createCppToken();
+        // Creating a CppProxy only calls its constructor, which registers it on the Java side.
+        assertEquals(newObjects + 1, JniCallCounters.threadCallsTo("NewObject"));
+        assertEquals(lookups, JniCallCounters.threadCallsTo("CallStaticObjectMethod"));
+
+        assertSame(token, TestHelpers.tokenId(token));
+        // Reusing it is a single lookup in CppProxyRegistry.
+        assertEquals(newObjects + 1, JniCallCounters.threadCallsTo("NewObject"));
+        assertEquals(lookups + 1, JniCallCounters.threadCallsTo("CallStaticObjectMethod"));
+    }
+
+    public void testInterfaceListLocalRefs() {
+        ArrayList<UserToken> tokens = new ArrayList<UserToken>();
+        for (int i = 0; i < 1000; ++i) {
+            tokens.add(TestHelpers.createCppToken());
+        }
+        JniCallCounters.resetThreadLocalRefHighWater();
+        TestHelpers.tokenListId(tokens);
+        // Independent of the list size: elements are converted in batches of 64, and each
+        // batch's references are released before the next one.
+        long highWater = JniCallCounters.threadLocalRefHighWater();
+        assertTrue("local ref high water: " + highWater, highWater < 100);
+    }
+
+    public void testCppProxyListBatches() {
+        long newObjects = JniCallCounters.threadCallsTo("NewObject");
+        long staticCalls = JniCallCounters.threadCallsTo("CallStaticVoidMethod");
+        ArrayList<UserToken> tokens = TestHelpers.createCppTokenList(100);
+        // The ArrayList, then one CppProxy.newProxies() per batch instead of a constructor
+        // call per element.
+        assertEquals(newObjects + 1, JniCallCounters.threadCallsTo("NewObject"));
+        assertEquals(staticCalls + 2, JniCallCounters.threadCallsTo("CallStaticVoidMethod"));
+        assertEquals(100, tokens.size());
+        assertNotSame(tokens.get(0), tokens.get(99));
+        ArrayList<UserToken> same = TestHelpers.tokenListId(tokens);
+        for (int i = 0; i < tokens.size(); ++i) {
+            assertSame(tokens.get(i), same.get(i));
+            TestHelpers.checkCppToken(tokens.get(i));
+        }
+    }
+
+    public void testLocalRefHighWater() {
+        JniCallCounters.resetThreadLocalRefHighWater();
+        TestHelpers.getNestedCollection();
+        assertTrue(JniCallCounters.threadLocalRefHighWater() > 0);
+    }
+}
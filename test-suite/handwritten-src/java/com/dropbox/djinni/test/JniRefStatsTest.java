@@ -0,0 +1,183 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.JniRefStats;
+
+import java.util.ArrayList;
+
+import junit.framework.TestCase;
+
+public class JniRefStatsTest extends TestCase {
+
+    private class JavaToken extends UserToken {
+        public String whoami() { return "Java"; }
+    }
+
+    private static long typeEntries(JniRefStats.Cache cache, String name) {
+        for (int i = 0; i < cache.typeNames.length; ++i) {
+            if (cache.typeNames[i].equals(name)) {
+                return cache.typeEntries[i];
+            }
+        }
+        return 0;
+    }
+
+    @Override
+    protected void tearDown() {
+        JniRefStats.setThreshold(0, null);
+        JniRefStats.setNativeMemoryThreshold(0);
+    }
+
+    public void testCppProxyHit() {
+        UserToken token = TestHelpers.createCppToken();
+        JniRefStats before = JniRefStats.snapshot(10);
+        assertSame(token, TestHelpers.tokenId(token));
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals(before.cppProxyCache.hits + 1, after.cppProxyCache.hits);
+        assertEquals(before.cppProxyCache.misses, after.cppProxyCache.misses);
+        assertTrue(typeEntries(after.cppProxyCache, "testsuite::UserToken") >= 1);
+    }
+
+    public void testJavaProxyMiss() {
+        JniRefStats before = JniRefStats.snapshot(10);
+        UserToken token = new JavaToken();
+        assertSame(token, TestHelpers.tokenId(token));
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals(before.javaProxyCache.misses + 1, after.javaProxyCache.misses);
+    }
+
+    public void testJavaProxyListBatch() {
+        ArrayList<UserToken> tokens = new ArrayList<UserToken>();
+        for (int i = 0; i < 100; ++i) {
+            UserToken token = new JavaToken();
+            // Repeated within a batch, and again in a later one.
+            tokens.add(token);
+            tokens.add(token);
+        }
+        tokens.addAll(new ArrayList<UserToken>(tokens));
+        JniRefStats before = JniRefStats.snapshot(10);
+        ArrayList<UserToken> same = TestHelpers.tokenListId(tokens);
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals(tokens.size(), same.size());
+        for (int i = 0; i < tokens.size(); ++i) {
+            assertSame(tokens.get(i), same.get(i));
+        }
+        assertEquals(before.javaProxyCache.misses + 100, after.javaProxyCache.misses);
+        assertEquals(before.javaProxyCache.hits + 300, after.javaProxyCache.hits);
+    }
+
+    public void testRepeatedCppProxyInList() {
+        JniRefStats before = JniRefStats.snapshot(10);
+        // One new C++ object, so the repeats are found within the batch that creates its proxy.
+        ArrayList<UserToken> tokens = TestHelpers.createRepeatedCppTokenList(3);
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals(3, tokens.size());
+        assertSame(tokens.get(0), tokens.get(1));
+        assertSame(tokens.get(0), tokens.get(2));
+        TestHelpers.checkCppToken(tokens.get(2));
+        assertEquals(before.cppProxyCache.misses + 1, after.cppProxyCache.misses);
+        assertEquals(before.cppProxyCache.hits + 2, after.cppProxyCache.hits);
+    }
+
+    public void testNativeBytes() {
+        JniRefStats.setNativeMemoryThreshold(1 << 20);
+        JniRefStats before = JniRefStats.snapshot(10);
+        UserToken token = TestHelpers.createLargeCppToken(4 << 20);
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals("C++", token.whoami());
+        assertEquals(before.nativeBytes + (4 << 20), after.nativeBytes);
+    }
+
+    public void testReleaseOnDetachedThread() {
+        TestHelpers.holdCallback(new ClientCallback() {
+            public void onResult(String result) {}
+        });
+        JniRefStats before = JniRefStats.snapshot(10);
+        TestHelpers.releaseHeldCallbackOnNativeThread();
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals(before.deferredReleases + 1, after.deferredReleases);
+        JniRefStats.releasePending();
+        assertEquals(0, JniRefStats.snapshot(10).pendingReleases);
+    }
+
+    public void testReleaseCachedProxyOnDetachedThread() {
+        UserToken token = new JavaToken();
+        TestHelpers.holdToken(token);
+        JniRefStats before = JniRefStats.snapshot(10);
+        TestHelpers.releaseHeldTokenOnNativeThread();
+        JniRefStats after = JniRefStats.snapshot(10);
+        // The whole proxy is queued, since leaving the proxy cache needs the JVM too.
+        assertEquals(before.deferredReleases + 1, after.deferredReleases);
+        JniRefStats.releasePending();
+        JniRefStats released = JniRefStats.snapshot(10);
+        assertEquals(0, released.pendingReleases);
+        assertEquals(before.javaProxyCache.liveHandles - 1, released.javaProxyCache.liveHandles);
+        assertSame(token, TestHelpers.tokenId(token));
+    }
+
+    public void testCachedProxyReleasedBeforeCrossing() {
+        TestHelpers.holdToken(new JavaToken());
+        JniRefStats before = JniRefStats.snapshot(10);
+        TestHelpers.releaseHeldTokenOnNativeThread();
+        // Without releasePending(): the queued proxy must not be destroyed while the call
+        // below holds the JavaProxyCache lock to look up its argument.
+        UserToken token = new JavaToken();
+        assertSame(token, TestHelpers.tokenId(token));
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals(0, after.pendingReleases);
+        assertEquals(before.javaProxyCache.liveHandles - 1, after.javaProxyCache.liveHandles);
+    }
+
+    public void testUncachedCallback() {
+        final String[] results = new String[2];
+        ClientCallback callback = new ClientCallback() {
+            public void onResult(String result) {
+                results[results[0] == null ? 0 : 1] = result;
+            }
+        };
+        JniRefStats before = JniRefStats.snapshot(10);
+        TestHelpers.callClientCallback(callback, "first");
+        TestHelpers.callClientCallback(callback, "second");
+        JniRefStats after = JniRefStats.snapshot(10);
+        assertEquals("first", results[0]);
+        assertEquals("second", results[1]);
+        assertEquals(before.javaProxyCache.hits, after.javaProxyCache.hits);
+        assertEquals(before.javaProxyCache.misses, after.javaProxyCache.misses);
+    }
+
+    public void testUncachedProxyRefs() {
+        JniRefStats before = JniRefStats.snapshot(10);
+        TestHelpers.holdCallback(new ClientCallback() {
+            public void onResult(String result) {}
+        });
+        JniRefStats held = JniRefStats.snapshot(10);
+        assertEquals(before.javaProxyRefs + 1, held.javaProxyRefs);
+        assertEquals(before.javaProxyCache.liveHandles, held.javaProxyCache.liveHandles);
+        TestHelpers.releaseHeldCallbackOnNativeThread();
+        JniRefStats.releasePending();
+        assertEquals(before.javaProxyRefs, JniRefStats.snapshot(10).javaProxyRefs);
+    }
+
+    public void testAccounting() {
+        UserToken token = TestHelpers.createCppToken();
+        JniRefStats stats = JniRefStats.snapshot(10);
+        assertTrue(stats.cppProxyCache.liveHandles >= 1);
+        assertEquals(stats.globalRefs, stats.javaProxyRefs + stats.otherGlobalRefs);
+        assertTrue(JniRefStats.report(10).contains("testsuite::UserToken"));
+        TestHelpers.checkCppToken(token);
+    }
+
+    public void testThresholdFiresOnce() {
+        final JniRefStats[] seen = new JniRefStats[1];
+        final int[] calls = new int[1];
+        JniRefStats.setThreshold(1, new JniRefStats.Listener() {
+            public void onThresholdExceeded(JniRefStats stats) {
+                seen[0] = stats;
+                calls[0]++;
+            }
+        });
+        UserToken token = TestHelpers.createCppToken();
+        TestHelpers.tokenId(token);
+        assertEquals(1, calls[0]);
+        assertTrue(seen[0].globalRefs > 1);
+    }
+}
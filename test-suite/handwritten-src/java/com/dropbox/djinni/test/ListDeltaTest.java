@@ -0,0 +1,50 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.ListDelta;
+import java.util.ArrayList;
+import java.util.Arrays;
+import junit.framework.TestCase;
+
+public class ListDeltaTest extends TestCase {
+
+    private static ArrayList<String> list(String... values) {
+        return new ArrayList<String>(Arrays.asList(values));
+    }
+
+    public void testApplyInCpp() {
+        ListDelta<String> delta = new ListDelta<String>()
+                .insert(3, list("d"))
+                .remove(0, 1)
+                .replace(1, list("C"));
+        assertEquals(list("b", "C", "d"), TestListDelta.apply(list("a", "b", "c"), delta));
+    }
+
+    public void testEditInCpp() {
+        ArrayList<String> mirror = list("a", "b", "c");
+        ListDelta<String> delta = TestListDelta.edit(mirror);
+        assertEquals(3, delta.getOps().size());
+        assertEquals(ListDelta.Kind.INSERT, delta.getOps().get(0).getKind());
+        assertEquals(ListDelta.Kind.REPLACE, delta.getOps().get(1).getKind());
+        assertEquals(ListDelta.Kind.REMOVE, delta.getOps().get(2).getKind());
+        delta.applyTo(mirror);
+        assertEquals(list("start", "c", "end"), mirror);
+    }
+
+    public void testMergesAdjacentOps() {
+        ListDelta<String> delta = new ListDelta<String>()
+                .insert(0, list("a"))
+                .insert(1, list("b"))
+                .remove(0, 1)
+                .remove(0, 1);
+        assertEquals(2, delta.getOps().size());
+        assertEquals(list("a", "b"), delta.getOps().get(0).getValues());
+        assertEquals(2, delta.getOps().get(1).getCount());
+        assertEquals(list("x"), TestListDelta.apply(list("x"), delta));
+    }
+
+    public void testEmptyDelta() {
+        ListDelta<String> delta = new ListDelta<String>();
+        assertTrue(delta.isEmpty());
+        assertEquals(list("a"), TestListDelta.apply(list("a"), delta));
+    }
+}
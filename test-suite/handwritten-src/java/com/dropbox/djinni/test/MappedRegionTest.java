@@ -0,0 +1,89 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.MappedRegion;
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+
+import junit.framework.TestCase;
+
+public class MappedRegionTest extends TestCase {
+
+    private File file;
+
+    @Override
+    protected void setUp() throws IOException {
+        // Longer than a page, so that offsets inside the second page are tested too.
+        byte[] bytes = new byte[10000];
+        for (int i = 0; i < bytes.length; ++i) {
+            bytes[i] = (byte) i;
+        }
+        file = File.createTempFile("djinni-mapped-region", ".bin");
+        try (FileOutputStream out = new FileOutputStream(file)) {
+            out.write(bytes);
+        }
+    }
+
+    @Override
+    protected void tearDown() {
+        file.delete();
+    }
+
+    private static long sum(ByteBuffer buffer) {
+        long sum = 0;
+        while (buffer.hasRemaining()) {
+            sum += buffer.get() & 0xff;
+        }
+        return sum;
+    }
+
+    public void testMapWholeFile() {
+        try (MappedRegion r = MappedRegion.map(file.getPath(), 0, 0)) {
+            assertEquals(10000, r.size());
+            ByteBuffer view = r.asByteBuffer();
+            assertTrue(view.isDirect());
+            assertTrue(view.isReadOnly());
+            assertEquals(sum(view), TestHelpers.mappedRegionSum(r));
+        }
+    }
+
+    public void testMapRangeInCpp() {
+        try (MappedRegion r = TestHelpers.mapFileRegion(file.getPath(), 5000, 100)) {
+            assertEquals(100, r.size());
+            assertEquals((byte) 5000, r.asByteBuffer().get(0));
+            assertEquals(sum(r.asByteBuffer()), TestHelpers.mappedRegionSum(r));
+        }
+    }
+
+    public void testBytesAreNotCopied() {
+        try (MappedRegion r = MappedRegion.map(file.getPath(), 0, 0)) {
+            long data = TestHelpers.mappedRegionData(r);
+            assertEquals(data, TestHelpers.mappedRegionData(r));
+        }
+    }
+
+    public void testOutOfRange() {
+        boolean threw = false;
+        try {
+            MappedRegion.map(file.getPath(), 9000, 2000);
+        } catch (RuntimeException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+
+    public void testClose() {
+        MappedRegion r = MappedRegion.map(file.getPath(), 0, 0);
+        r.close();
+        r.close();
+        boolean threw = false;
+        try {
+            r.size();
+        } catch (IllegalStateException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+}
@@ -0,0 +1,19 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import junit.framework.TestCase;
+
+public class MoveParamsTest extends TestCase {
+
+    public void testAppend() {
+        ArrayList<String> strings = new ArrayList<String>(Arrays.asList("a", "b"));
+        assertEquals(Arrays.asList("a", "b", "c"), TestHelpers.appendString(strings, "c"));
+        // The Java list is converted, so moving on the C++ side leaves it alone
+        assertEquals(Arrays.asList("a", "b"), strings);
+    }
+
+    public void testNonAsciiNotBorrowed() {
+        assertEquals(Arrays.asList("caf\u00e9"), TestHelpers.appendString(new ArrayList<String>(), "caf\u00e9"));
+    }
+}
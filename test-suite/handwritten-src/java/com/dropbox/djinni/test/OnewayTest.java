@@ -0,0 +1,60 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import junit.framework.TestCase;
+
+public class OnewayTest extends TestCase {
+
+    // Blocks in started() until released. Its calls all come from the dispatcher thread, and
+    // are only read after the finished() latch.
+    private static class BlockingListener extends ProgressListener {
+        final CountDownLatch release = new CountDownLatch(1);
+        final CountDownLatch finished = new CountDownLatch(1);
+        final ArrayList<String> calls = new ArrayList<String>();
+        Thread thread;
+
+        @Override
+        public void started(String task) {
+            thread = Thread.currentThread();
+            calls.add("started " + task);
+            try {
+                release.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+        }
+
+        @Override
+        public void progress(int done, int total) {
+            calls.add("progress " + done + "/" + total);
+        }
+
+        @Override
+        public void finished() {
+            calls.add("finished");
+            finished.countDown();
+        }
+    }
+
+    public void testReturnsBeforeDelivery() throws InterruptedException {
+        BlockingListener listener = new BlockingListener();
+        // Would never return if C++ waited for started()
+        TestHelpers.reportProgress(listener, "copy", 10);
+        assertEquals(1, listener.finished.getCount());
+        listener.release.countDown();
+        assertTrue(listener.finished.await(10, TimeUnit.SECONDS));
+        assertNotSame(Thread.currentThread(), listener.thread);
+    }
+
+    public void testCoalescesPendingProgress() throws InterruptedException {
+        BlockingListener listener = new BlockingListener();
+        TestHelpers.reportProgress(listener, "copy", 1000);
+        listener.release.countDown();
+        assertTrue(listener.finished.await(10, TimeUnit.SECONDS));
+        // Every progress call was queued while started() blocked, so only the last one is left.
+        assertEquals(Arrays.asList("started copy", "progress 1000/1000", "finished"), listener.calls);
+    }
+}
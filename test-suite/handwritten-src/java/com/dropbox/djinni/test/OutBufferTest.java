@@ -0,0 +1,49 @@
+package com.dropbox.djinni.test;
+
+import java.nio.ByteBuffer;
+
+import junit.framework.TestCase;
+
+public class OutBufferTest extends TestCase {
+
+    public void testWriteIntoBuffer() {
+        ByteBuffer buf = ByteBuffer.allocateDirect(16);
+        assertEquals(10, TestHelpers.fillOutBuffer(buf, 10));
+        for (int i = 0; i < 10; ++i) {
+            assertEquals((byte) i, buf.get(i));
+        }
+        assertEquals(0, buf.position());
+    }
+
+    public void testReuseBuffer() {
+        ByteBuffer buf = ByteBuffer.allocateDirect(256);
+        for (int size = 0; size <= 256; ++size) {
+            assertEquals(size, TestHelpers.fillOutBuffer(buf, size));
+            if (size > 0) {
+                assertEquals((byte) (size - 1), buf.get(size - 1));
+            }
+        }
+    }
+
+    public void testBufferTooSmall() {
+        ByteBuffer buf = ByteBuffer.allocateDirect(4);
+        int needed = TestHelpers.fillOutBuffer(buf, 20);
+        assertEquals(20, needed);
+        assertTrue(needed > buf.capacity());
+        assertEquals(0, buf.get(0));
+
+        buf = ByteBuffer.allocateDirect(needed);
+        assertEquals(20, TestHelpers.fillOutBuffer(buf, 20));
+        assertEquals((byte) 19, buf.get(19));
+    }
+
+    public void testHeapBufferRejected() {
+        boolean threw = false;
+        try {
+            TestHelpers.fillOutBuffer(ByteBuffer.allocate(16), 10);
+        } catch (Error e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+}
@@ -10,4 +10,15 @@ public class PrimitivesTest extends TestCase {
         assertEquals(p, TestHelpers.assortedPrimitivesId(p));
     }
 
+    public void testAbsentOptionalPrimitives() {
+        AssortedPrimitives p = new AssortedPrimitives(false, (byte)0, (short)0, 0, 0, 0, 0,
+                                                      null, (byte)0, null, 0, null, 0.0f, null);
+        AssortedPrimitives q = TestHelpers.assortedPrimitivesId(p);
+        assertEquals(p, q);
+        assertNull(q.getOB());
+        assertEquals(Byte.valueOf((byte)0), q.getOEight());
+        assertNull(q.getOSixtyfour());
+        assertEquals(Float.valueOf(0.0f), q.getOFthirtytwo());
+    }
+
 }
@@ -0,0 +1,36 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.Result;
+
+import junit.framework.TestCase;
+
+public class ResultTest extends TestCase {
+
+    public void testOkFromCpp() {
+        Result<String, Integer> r = TestResult.makeOk("hello");
+        assertTrue(r.isOk());
+        assertEquals("hello", r.getValue());
+    }
+
+    public void testErrorFromCpp() {
+        Result<String, Integer> r = TestResult.makeError(42);
+        assertTrue(r.isError());
+        assertEquals(Integer.valueOf(42), r.getError());
+    }
+
+    public void testToCpp() {
+        assertEquals("ok: hello", TestResult.describe(Result.<String, Integer>ok("hello")));
+        assertEquals("error: 7", TestResult.describe(Result.<String, Integer>error(7)));
+    }
+
+    public void testEquality() {
+        assertEquals(Result.<String, Integer>ok("a"), TestResult.makeOk("a"));
+        assertEquals(Result.<String, Integer>error(3), TestResult.makeError(3));
+        assertFalse(TestResult.makeOk("3").equals(TestResult.makeError(3)));
+    }
+
+    public void testThrowingMoveAssignment() {
+        TestResult.checkThrowingMoveAssignment();
+    }
+
+}
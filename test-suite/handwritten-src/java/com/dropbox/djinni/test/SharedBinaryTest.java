@@ -0,0 +1,53 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.SharedBinary;
+
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+
+import junit.framework.TestCase;
+
+public class SharedBinaryTest extends TestCase {
+
+    public void testRoundTripSharesBytes() {
+        byte[] bytes = { 1, 2, 3 };
+        try (SharedBinary b = SharedBinary.copyOf(bytes);
+             SharedBinary same = TestHelpers.idSharedBinary(b)) {
+            assertNotSame(b, same);
+            assertEquals(TestHelpers.sharedBinaryData(b), TestHelpers.sharedBinaryData(same));
+            assertTrue(Arrays.equals(bytes, same.toByteArray()));
+        }
+    }
+
+    public void testByteBufferView() {
+        try (SharedBinary b = TestHelpers.createSharedBinary(256)) {
+            assertEquals(256, b.size());
+            ByteBuffer view = b.asByteBuffer();
+            assertTrue(view.isDirect());
+            assertTrue(view.isReadOnly());
+            assertEquals(256, view.remaining());
+            assertEquals((byte) 255, view.get(255));
+        }
+    }
+
+    public void testEmpty() {
+        try (SharedBinary b = TestHelpers.createSharedBinary(0)) {
+            assertEquals(0, b.size());
+            assertEquals(0, b.asByteBuffer().remaining());
+            assertEquals(0, TestHelpers.idSharedBinary(b).toByteArray().length);
+        }
+    }
+
+    public void testClose() {
+        SharedBinary b = SharedBinary.copyOf(new byte[] { 1 });
+        b.close();
+        b.close();
+        boolean threw = false;
+        try {
+            b.size();
+        } catch (IllegalStateException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+    }
+}
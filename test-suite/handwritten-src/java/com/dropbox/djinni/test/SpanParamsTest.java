@@ -0,0 +1,39 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class SpanParamsTest extends TestCase {
+
+    public void testSum() {
+        assertEquals(0, SpanParams.sumI32List(new int[0]));
+        assertEquals(6, SpanParams.sumI32List(new int[] { 1, 2, 3 }));
+        assertEquals(2L * Integer.MAX_VALUE, SpanParams.sumI32List(new int[] { Integer.MAX_VALUE, Integer.MAX_VALUE }));
+    }
+
+    public void testLargeArrayAndReuse() {
+        int[] values = new int[100000];
+        for (int i = 0; i < values.length; ++i) {
+            values[i] = i;
+        }
+        long expected = (long) values.length * (values.length - 1) / 2;
+        for (int i = 0; i < 10; ++i) {
+            assertEquals(expected, SpanParams.sumI32List(values));
+        }
+        assertEquals(3, SpanParams.sumI32List(new int[] { 1, 2 }));
+    }
+
+    public void testTwoSpans() {
+        assertEquals(32.0, SpanParams.dotF64Lists(new double[] { 1, 2, 3 }, new double[] { 4, 5, 6 }));
+    }
+
+    public void testExceptionReleasesScratch() {
+        boolean threw = false;
+        try {
+            SpanParams.dotF64Lists(new double[] { 1 }, new double[] { 1, 2 });
+        } catch (RuntimeException e) {
+            threw = true;
+        }
+        assertTrue(threw);
+        assertEquals(1.0, SpanParams.dotF64Lists(new double[] { 1 }, new double[] { 1 }));
+    }
+}
@@ -0,0 +1,36 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class StringViewParamsTest extends TestCase {
+
+    public void testAscii() {
+        assertEquals(0, StringViewParams.utf8Length(""));
+        assertEquals(5, StringViewParams.utf8Length("hello"));
+    }
+
+    public void testNonAscii() {
+        assertEquals(6, StringViewParams.utf8Length("h\u00e9llo"));
+        assertEquals(3, StringViewParams.utf8Length("\u20ac"));
+        // Surrogate pair, encoded as one four-byte sequence
+        assertEquals(4, StringViewParams.utf8Length("\ud83d\ude00"));
+        // Embedded NUL is part of the view, not a terminator
+        assertEquals(3, StringViewParams.utf8Length("a\u0000b"));
+    }
+
+    public void testLargeStringAndReuse() {
+        StringBuilder sb = new StringBuilder();
+        for (int i = 0; i < 100000; ++i) {
+            sb.append('\u00e9');
+        }
+        String s = sb.toString();
+        for (int i = 0; i < 10; ++i) {
+            assertEquals(200000, StringViewParams.utf8Length(s));
+        }
+        assertEquals(2, StringViewParams.utf8Length("ab"));
+    }
+
+    public void testConvertedInImplementation() {
+        assertEquals("caf\u00e9", StringViewParams.echo("caf\u00e9"));
+    }
+}
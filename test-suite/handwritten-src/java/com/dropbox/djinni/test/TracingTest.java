@@ -0,0 +1,61 @@
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.Tracing;
+
+import junit.framework.TestCase;
+
+public class TracingTest extends TestCase {
+
+    @Override
+    protected void setUp() {
+        Tracing.clear();
+    }
+
+    @Override
+    protected void tearDown() {
+        Tracing.setEnabled(false);
+        Tracing.clear();
+    }
+
+    public void testDisabledByDefault() {
+        assertFalse(Tracing.isEnabled());
+        TestHelpers.checkSetRecord(TestHelpers.getSetRecord());
+        assertFalse(Tracing.dump().contains("TestHelpers"));
+    }
+
+    public void testCrossingsInBothDirections() {
+        Tracing.setEnabled(true);
+        TestHelpers.checkClientInterfaceAscii(new ClientInterfaceImpl());
+        String trace = Tracing.dump();
+        assertTrue(trace.startsWith("{"));
+        assertTrue(trace.contains("\"com.dropbox.djinni.test.TestHelpers.checkClientInterfaceAscii\""));
+        assertTrue(trace.contains("\"com.dropbox.djinni.test.ClientInterface.getRecord\""));
+        assertTrue(trace.contains("\"marshal args\""));
+    }
+
+    public void testSpansOutliveTheirThread() throws InterruptedException {
+        Tracing.setEnabled(true);
+        // The second thread takes over the buffer of the first, which has exited.
+        for (int i = 0; i < 2; ++i) {
+            Thread thread = new Thread(new Runnable() {
+                @Override
+                public void run() {
+                    TestHelpers.checkSetRecord(TestHelpers.getSetRecord());
+                }
+            });
+            thread.start();
+            thread.join();
+        }
+        String trace = Tracing.dump();
+        int first = trace.indexOf("\"com.dropbox.djinni.test.TestHelpers.checkSetRecord\"");
+        assertTrue(first >= 0);
+        assertTrue(trace.indexOf("\"com.dropbox.djinni.test.TestHelpers.checkSetRecord\"", first + 1) >= 0);
+    }
+
+    public void testClear() {
+        Tracing.setEnabled(true);
+        TestHelpers.checkSetRecord(TestHelpers.getSetRecord());
+        Tracing.clear();
+        assertFalse(Tracing.dump().contains("TestHelpers"));
+    }
+}
@@ -0,0 +1,45 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class UnboxedOptionalsTest extends TestCase {
+
+    static class JavaScale extends UnboxedOptionalsCallback {
+        @Override
+        public Double scale(Double v, Integer factor) {
+            return v != null && factor != null ? v * factor : null;
+        }
+    }
+
+    public void testRecord() {
+        UnboxedOptionalsRecord r = UnboxedOptionals.recordId(new UnboxedOptionalsRecord(3, true, 1234567890123L, 0.5, "name"));
+        assertEquals(3, r.getCount());
+        assertEquals(Boolean.TRUE, r.getOFlag());
+        assertEquals(Long.valueOf(1234567890123L), r.getOTotal());
+        assertEquals(Double.valueOf(0.5), r.getORatio());
+        assertEquals("name", r.getOName());
+    }
+
+    public void testAbsentAndZeroFields() {
+        UnboxedOptionalsRecord r = UnboxedOptionals.recordId(new UnboxedOptionalsRecord(0, false, null, 0.0, null));
+        // An absent value and a present zero cross JNI as the same value with different flags.
+        assertEquals(Boolean.FALSE, r.getOFlag());
+        assertNull(r.getOTotal());
+        assertEquals(Double.valueOf(0.0), r.getORatio());
+        assertNull(r.getOName());
+    }
+
+    public void testStaticMethod() {
+        assertEquals(7.5, UnboxedOptionals.scale(2.5, 3));
+        assertEquals(0.0, UnboxedOptionals.scale(0.0, 0));
+        assertNull(UnboxedOptionals.scale(2.5, null));
+        assertNull(UnboxedOptionals.scale(null, 3));
+    }
+
+    public void testJavaProxyMethod() {
+        JavaScale cb = new JavaScale();
+        assertEquals(-7.5, UnboxedOptionals.scaleWith(cb, 2.5, -3));
+        assertEquals(0.0, UnboxedOptionals.scaleWith(cb, 0.0, 0));
+        assertNull(UnboxedOptionals.scaleWith(cb, null, -3));
+    }
+}
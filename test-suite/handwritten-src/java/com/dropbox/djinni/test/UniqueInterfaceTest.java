@@ -0,0 +1,21 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class UniqueInterfaceTest extends TestCase {
+
+    public void testCalls() {
+        UniqueCounter counter = UniqueCounter.create(10);
+        assertEquals(11, counter.increment());
+        assertEquals(12, counter.increment());
+    }
+
+    public void testProxiesAreDistinct() {
+        UniqueCounter a = UniqueCounter.create(0);
+        UniqueCounter b = UniqueCounter.create(0);
+        assertNotSame(a, b);
+        assertEquals(1, a.increment());
+        assertEquals(2, a.increment());
+        assertEquals(1, b.increment());
+    }
+}
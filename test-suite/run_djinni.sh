@@ -30,6 +30,7 @@ jni_out="$base_dir/generated-src/jni"
 objc_out="$base_dir/generated-src/objc"
 java_out="$base_dir/generated-src/java/com/dropbox/djinni/test"
 yaml_out="$base_dir/generated-src/yaml"
+flags_out="$base_dir/generated-src/flags"
 
 java_package="com.dropbox.djinni.test"
 
@@ -44,7 +45,7 @@ elif [ $# -eq 1 ]; then
         echo "Unexpected arguemnt: \"$command\"." 1>&2
         exit 1
     fi
-    for dir in "$temp_out" "$cpp_out" "$jni_out" "$java_out"; do
+    for dir in "$temp_out" "$cpp_out" "$jni_out" "$java_out" "$flags_out"; do
         if [ -e "$dir" ]; then
             echo "Deleting \"$dir\"..."
             rm -r "$dir"
@@ -112,6 +113,46 @@ cp "$base_dir/djinni/yaml-test.djinni" "$temp_out/yaml"
     \
     --idl "$temp_out/yaml/yaml-test.djinni"
 
+# Options that change the generated code are each tested on a small IDL file of
+# their own in djinni/flags, so that the rest of the suite uses the defaults.
+run_flags_test() {
+    local name="$1" ; shift
+    (cd "$base_dir" && \
+    "$base_dir/../src/run-assume-built" \
+        --java-out "$temp_out_relative/flags/$name/java" \
+        --java-package $java_package \
+        --java-nullable-annotation "javax.annotation.CheckForNull" \
+        --java-nonnull-annotation "javax.annotation.Nonnull" \
+        --ident-java-field mFooBar \
+        \
+        --cpp-out "$temp_out_relative/flags/$name/cpp" \
+        --cpp-namespace testsuite \
+        --ident-cpp-enum-type foo_bar \
+        --cpp-optional-template "std::experimental::optional" \
+        --cpp-optional-header "<experimental/optional>" \
+        \
+        --jni-out "$temp_out_relative/flags/$name/jni" \
+        --ident-jni-class NativeFooBar \
+        --ident-jni-file NativeFooBar \
+        \
+        --objc-out "$temp_out_relative/flags/$name/objc" \
+        --objcpp-out "$temp_out_relative/flags/$name/objc" \
+        --objc-type-prefix DB \
+        \
+        --idl "djinni/flags/$name.djinni" \
+        "$@" \
+    )
+}
+
+run_flags_test closeable --java-closeable-interfaces true
+run_flags_test flat_args --jni-flatten-args true
+run_flags_test span_params --cpp-span-params true
+run_flags_test string_view_params \
+    --cpp-string-view-params true \
+    --cpp-string-view-type "std::experimental::string_view" \
+    --cpp-string-view-header "<experimental/string_view>"
+run_flags_test unboxed_optionals --jni-unboxed-optionals true
+
 # Copy changes from "$temp_output" to final dir.
 
 mirror() {
@@ -127,6 +168,13 @@ mirror "cpp" "$temp_out/cpp" "$cpp_out"
 mirror "java" "$temp_out/java" "$java_out"
 mirror "jni" "$temp_out/jni" "$jni_out"
 mirror "objc" "$temp_out/objc" "$objc_out"
+for dir in "$temp_out/flags"/*; do
+    name=`basename "$dir"`
+    mirror "flags/$name/cpp" "$dir/cpp" "$flags_out/$name/cpp"
+    mirror "flags/$name/java" "$dir/java" "$flags_out/$name/java/com/dropbox/djinni/test"
+    mirror "flags/$name/jni" "$dir/jni" "$flags_out/$name/jni"
+    mirror "flags/$name/objc" "$dir/objc" "$flags_out/$name/objc"
+done
 
 date > "$gen_stamp"
 